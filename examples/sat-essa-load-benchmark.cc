@@ -0,0 +1,162 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <chrono>
+#include <sstream>
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/satellite-module.h"
+#include "ns3/applications-module.h"
+#include "ns3/traffic-module.h"
+
+using namespace ns3;
+
+/**
+ * \file sat-essa-load-benchmark.cc
+ * \ingroup satellite
+ *
+ * \brief Benchmark for the E-SSA window processing of the return link.
+ *
+ * The example runs the E-SSA scenario of sat-essa-example with SIC enabled
+ * and without statistics, and prints the wall clock time of the simulation
+ * run. The offered load is set with the number of UTs per beam, so the
+ * scaling of the window processing is seen by sweeping it, e.g.
+ *
+ *     $ for uts in 50 100 200 400 800; do
+ *         ./waf --run="sat-essa-load-benchmark --utsPerBeam=$uts"; done
+ */
+
+NS_LOG_COMPONENT_DEFINE ("sat-essa-load-benchmark");
+
+int
+main (int argc, char *argv[])
+{
+  std::string beams = "8";
+  uint32_t nbUtsPerBeam = 100;
+  Time simLength = Seconds (10.0);
+  uint32_t sicIterations = 5;
+  bool sicEnabled = true;
+  bool flatInterference = false;
+
+  uint32_t packetSize = 64;
+  std::string dataRate = "5kbps";
+  std::string onTime = "0.2";
+  std::string offTime = "0.8";
+
+  Ptr<SimulationHelper> simulationHelper = CreateObject<SimulationHelper> ("example-essa-load-benchmark");
+
+  CommandLine cmd;
+  cmd.AddValue ("utsPerBeam", "Number of UTs per spot-beam", nbUtsPerBeam);
+  cmd.AddValue ("simLength", "Simulation duration in seconds", simLength);
+  cmd.AddValue ("sicIterations", "Number of SIC iterations per window", sicIterations);
+  cmd.AddValue ("sic", "Enable SIC", sicEnabled);
+  cmd.AddValue ("flatInterference", "Use the flat interference timeline", flatInterference);
+  cmd.AddValue ("dataRate", "Data rate of each UT (e.g. 5kbps)", dataRate);
+  simulationHelper->AddDefaultUiArguments (cmd);
+  cmd.Parse (argc, argv);
+
+  Config::SetDefault ("ns3::SatEnvVariables::EnableSimulationOutputOverwrite", BooleanValue (true));
+
+  // Superframe configuration
+  Config::SetDefault ("ns3::SatConf::SuperFrameConfForSeq0", EnumValue (SatSuperframeConf::SUPER_FRAME_CONFIG_4));
+  Config::SetDefault ("ns3::SatSuperframeConf4::FrameConfigType", EnumValue (SatSuperframeConf::CONFIG_TYPE_4));
+  Config::SetDefault ("ns3::SatSuperframeConf4::Frame0_AllocatedBandwidthHz", DoubleValue (15000));
+  Config::SetDefault ("ns3::SatSuperframeConf4::Frame0_CarrierAllocatedBandwidthHz", DoubleValue (15000));
+  Config::SetDefault ("ns3::SatSuperframeConf4::Frame0_CarrierRollOff", DoubleValue (0.22));
+  Config::SetDefault ("ns3::SatSuperframeConf4::Frame0_CarrierSpacing", DoubleValue (0));
+  Config::SetDefault ("ns3::SatSuperframeConf4::Frame0_SpreadingFactor", UintegerValue (256));
+
+  // E-SSA only
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::DaServiceCount", UintegerValue (4));
+  for (uint32_t i = 0; i < 4; ++i)
+    {
+      std::ostringstream service;
+      service << "ns3::SatLowerLayerServiceConf::DaService" << i << "_";
+      Config::SetDefault (service.str () + "ConstantAssignmentProvided", BooleanValue (false));
+      Config::SetDefault (service.str () + "RbdcAllowed", BooleanValue (false));
+      Config::SetDefault (service.str () + "VolumeAllowed", BooleanValue (false));
+    }
+
+  Config::SetDefault ("ns3::SatBeamHelper::RandomAccessModel", EnumValue (SatEnums::RA_MODEL_ESSA));
+  if (flatInterference)
+    {
+      Config::SetDefault ("ns3::SatBeamHelper::RaInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_PER_FRAGMENT_FLAT));
+    }
+  else
+    {
+      Config::SetDefault ("ns3::SatBeamHelper::RaInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_PER_FRAGMENT));
+    }
+  Config::SetDefault ("ns3::SatBeamHelper::RaInterferenceEliminationModel", EnumValue (SatPhyRxCarrierConf::SIC_RESIDUAL));
+  Config::SetDefault ("ns3::SatBeamHelper::RaCollisionModel", EnumValue (SatPhyRxCarrierConf::RA_COLLISION_CHECK_AGAINST_SINR));
+  Config::SetDefault ("ns3::SatBeamHelper::ReturnLinkLinkResults", EnumValue (SatEnums::LR_FSIM));
+  Config::SetDefault ("ns3::SatWaveformConf::DefaultWfId", UintegerValue (2));
+  Config::SetDefault ("ns3::SatHelper::RtnLinkWaveformConfFileName", StringValue ("fSimWaveforms.txt"));
+
+  Config::SetDefault ("ns3::SatPhyRxCarrierPerWindow::WindowDuration", StringValue ("600ms"));
+  Config::SetDefault ("ns3::SatPhyRxCarrierPerWindow::WindowStep", StringValue ("200ms"));
+  Config::SetDefault ("ns3::SatPhyRxCarrierPerWindow::WindowDelay", StringValue ("0s"));
+  Config::SetDefault ("ns3::SatPhyRxCarrierPerWindow::FirstWindow", StringValue ("0s"));
+  Config::SetDefault ("ns3::SatPhyRxCarrierPerWindow::WindowSICIterations", UintegerValue (sicIterations));
+  Config::SetDefault ("ns3::SatPhyRxCarrierPerWindow::SpreadingFactor", UintegerValue (1));
+  Config::SetDefault ("ns3::SatPhyRxCarrierPerWindow::DetectionThreshold", DoubleValue (0));
+  Config::SetDefault ("ns3::SatPhyRxCarrierPerWindow::EnableSIC", BooleanValue (sicEnabled));
+
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_MaximumUniquePayloadPerBlock", UintegerValue (3));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_MaximumConsecutiveBlockAccessed", UintegerValue (6));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_MinimumIdleBlock", UintegerValue (2));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_BackOffTimeInMilliSeconds", UintegerValue (50));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_BackOffProbability", UintegerValue (1));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_HighLoadBackOffProbability", UintegerValue (1));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_AverageNormalizedOfferedLoadThreshold", DoubleValue (0.99));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_NumberOfInstances", UintegerValue (3));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_SlottedAlohaAllowed", BooleanValue (false));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_CrdsaAllowed", BooleanValue (false));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_EssaAllowed", BooleanValue (true));
+
+  simulationHelper->SetSimulationTime (simLength);
+  simulationHelper->SetGwUserCount (1);
+  simulationHelper->SetUtCountPerBeam (nbUtsPerBeam);
+  simulationHelper->SetUserCountPerUt (1);
+  simulationHelper->SetBeams (beams);
+
+  simulationHelper->CreateSatScenario ();
+
+  Config::SetDefault ("ns3::OnOffApplication::PacketSize", UintegerValue (packetSize));
+  Config::SetDefault ("ns3::OnOffApplication::DataRate", StringValue (dataRate));
+  Config::SetDefault ("ns3::OnOffApplication::OnTime", StringValue ("ns3::ConstantRandomVariable[Constant=" + onTime + "]"));
+  Config::SetDefault ("ns3::OnOffApplication::OffTime", StringValue ("ns3::ConstantRandomVariable[Constant=" + offTime + "]"));
+
+  simulationHelper->InstallTrafficModel (
+    SimulationHelper::ONOFF,
+    SimulationHelper::UDP,
+    SimulationHelper::RTN_LINK,
+    Seconds (0.001), simLength);
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  simulationHelper->RunSimulation ();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+
+  std::cout << "utsPerBeam=" << nbUtsPerBeam
+            << " simLength=" << simLength.GetSeconds () << " s"
+            << " sic=" << sicEnabled
+            << " wallClock=" << elapsed.count () << " s" << std::endl;
+
+  return 0;
+}
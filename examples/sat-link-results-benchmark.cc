@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <chrono>
+#include <vector>
+#include "ns3/core-module.h"
+#include "ns3/satellite-enums.h"
+#include "ns3/satellite-link-results.h"
+
+using namespace ns3;
+
+/**
+ * \file sat-link-results-benchmark.cc
+ * \ingroup satellite
+ *
+ * \brief Micro benchmark for the BLER look ups of the link results.
+ *
+ * The example loads the DVB-S2, DVB-S2X and DVB-RCS2 link results and
+ * measures the number of BLER look ups per second over all the loaded
+ * tables, using uniformly distributed Es/No (Eb/No) values.
+ *
+ *     $ ./waf --run="sat-link-results-benchmark --lookups=10000000"
+ */
+
+NS_LOG_COMPONENT_DEFINE ("sat-link-results-benchmark");
+
+static void
+PrintResult (std::string name, uint32_t lookups, double seconds, double checksum)
+{
+  std::cout << name << ": " << lookups << " look ups in " << seconds << " s, "
+            << (lookups / seconds) << " look ups/s (checksum " << checksum << ")" << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t lookups (1000000);
+  double minEsNoDb (-5.0);
+  double maxEsNoDb (25.0);
+
+  CommandLine cmd;
+  cmd.AddValue ("lookups", "Number of BLER look ups per link results type", lookups);
+  cmd.AddValue ("minEsNoDb", "Minimum Es/No in dB", minEsNoDb);
+  cmd.AddValue ("maxEsNoDb", "Maximum Es/No in dB", maxEsNoDb);
+  cmd.Parse (argc, argv);
+
+  Ptr<UniformRandomVariable> esNo = CreateObject<UniformRandomVariable> ();
+  esNo->SetAttribute ("Min", DoubleValue (minEsNoDb));
+  esNo->SetAttribute ("Max", DoubleValue (maxEsNoDb));
+
+  // The same Es/No values are used for every link results type
+  std::vector<double> esNoDbs;
+  for (uint32_t i = 0; i < lookups; ++i)
+    {
+      esNoDbs.push_back (esNo->GetValue ());
+    }
+
+  // DVB-S2
+  Ptr<SatLinkResultsDvbS2> s2 = CreateObject<SatLinkResultsDvbS2> ();
+  s2->Initialize ();
+
+  std::vector<SatEnums::SatModcod_t> s2Modcods;
+  SatEnums::GetAvailableModcodsFwdLink (s2Modcods);
+
+  double checksum = 0.0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  for (uint32_t i = 0; i < lookups; ++i)
+    {
+      checksum += s2->GetBler (s2Modcods[i % s2Modcods.size ()], SatEnums::NORMAL_FRAME, esNoDbs[i]);
+    }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+  PrintResult ("DVB-S2", lookups, elapsed.count (), checksum);
+
+  // DVB-S2X
+  Ptr<SatLinkResultsDvbS2X> s2x = CreateObject<SatLinkResultsDvbS2X> ();
+  s2x->Initialize ();
+
+  std::vector<SatEnums::SatModcod_t> s2xModcods;
+  SatEnums::GetAvailableModcodsFwdLinkS2X (s2xModcods, SatEnums::NORMAL_FRAMES, true);
+
+  checksum = 0.0;
+  start = std::chrono::steady_clock::now ();
+  for (uint32_t i = 0; i < lookups; ++i)
+    {
+      checksum += s2x->GetBler (s2xModcods[i % s2xModcods.size ()], SatEnums::NORMAL_FRAME, esNoDbs[i]);
+    }
+  elapsed = std::chrono::steady_clock::now () - start;
+  PrintResult ("DVB-S2X", lookups, elapsed.count (), checksum);
+
+  // DVB-RCS2, waveform ids 2-22
+  Ptr<SatLinkResultsDvbRcs2> rcs2 = CreateObject<SatLinkResultsDvbRcs2> ();
+  rcs2->Initialize ();
+
+  checksum = 0.0;
+  start = std::chrono::steady_clock::now ();
+  for (uint32_t i = 0; i < lookups; ++i)
+    {
+      checksum += rcs2->GetBler (2 + (i % 21), esNoDbs[i]);
+    }
+  elapsed = std::chrono::steady_clock::now () - start;
+  PrintResult ("DVB-RCS2", lookups, elapsed.count (), checksum);
+
+  return 0;
+}
@@ -19,6 +19,8 @@
  *
  */
 
+#include <chrono>
+
 #include "ns3/core-module.h"
 #include "ns3/config-store-module.h"
 #include "ns3/network-module.h"
@@ -37,6 +39,15 @@ using namespace ns3;
  *         To see help for user arguments:
  *         execute command -> ./waf --run "sat-profiling-sim --PrintHelp"
  *
+ *         The wall clock time of the simulation run is printed at the end, so the
+ *         effect of e.g. the link gain cache can be measured by running:
+ *         ./waf --run "sat-profiling-sim --linkGainCache=true"
+ *         ./waf --run "sat-profiling-sim --linkGainCache=false"
+ *
+ *         The scaling with the scenario size is seen by sweeping the number of
+ *         UTs per beam and the beams, e.g.
+ *         ./waf --run "sat-profiling-sim --utsPerBeam=50 --beams='1 5 20 71'"
+ *
  */
 
 NS_LOG_COMPONENT_DEFINE ("sat-profiling-sim");
@@ -47,27 +58,35 @@ main (int argc, char *argv[])
   LogComponentEnable ("CbrApplication", LOG_LEVEL_INFO);
   LogComponentEnable ("PacketSink", LOG_LEVEL_INFO);
 
+  std::string beams ("48");
   uint32_t utsPerBeam (1);
   uint32_t endUsersPerUt (1);
   double simulationTime (10.0);
+  bool linkGainCache (true);
 
   Ptr<SimulationHelper> simulationHelper = CreateObject<SimulationHelper> ("sat-profiling-sim");
 
+  CommandLine cmd;
+  cmd.AddValue ("utsPerBeam", "Number of UTs per spot-beam", utsPerBeam);
+  cmd.AddValue ("endUsersPerUt", "Number of end users per UT", endUsersPerUt);
+  cmd.AddValue ("beams", "Space separated list of the enabled spot-beams", beams);
+  cmd.AddValue ("simulationTime", "Simulation time in seconds", simulationTime);
+  cmd.AddValue ("linkGainCache", "Cache the link gains of static terminals in SatChannel", linkGainCache);
+  cmd.Parse (argc, argv);
+
+  Config::SetDefault ("ns3::SatChannel::EnableLinkGainCache", BooleanValue (linkGainCache));
+
   simulationHelper->SetDefaultValues ();
   simulationHelper->SetUtCountPerBeam (utsPerBeam);
   simulationHelper->SetUserCountPerUt (endUsersPerUt);
   simulationHelper->SetSimulationTime (simulationTime);
 
-  simulationHelper->SetBeams ("48");
-  Ptr<SatHelper> helper = simulationHelper->CreateSatScenario ();
+  simulationHelper->SetBeams (beams);
+  simulationHelper->CreateSatScenario ();
 
   // ----------------------------------
   // ----- CREATE CBR APPLICATION -----
   // ----------------------------------
-  NodeContainer utUsers = helper->GetUtUsers ();
-
-  NS_ASSERT (utUsers.GetN () == 1);
-
   Config::SetDefault ("ns3::CbrApplication::PacketSize", UintegerValue (64));
   Config::SetDefault ("ns3::CbrApplication::Interval", TimeValue (Seconds (2)));
   simulationHelper->InstallTrafficModel (
@@ -86,7 +105,15 @@ main (int argc, char *argv[])
 
   simulationHelper->CreateDefaultRtnLinkStats ();
   simulationHelper->EnableProgressLogs ();
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
   simulationHelper->RunSimulation ();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+
+  std::cout << "Beams: " << beams
+            << ", UTs per beam: " << utsPerBeam
+            << ", link gain cache: " << (linkGainCache ? "enabled" : "disabled")
+            << ", wall clock time: " << elapsed.count () << " s" << std::endl;
 
   return 0;
 }
@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <chrono>
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/satellite-module.h"
+#include "ns3/applications-module.h"
+#include "ns3/traffic-module.h"
+
+using namespace ns3;
+
+/**
+ * \file sat-time-slicing-benchmark.cc
+ * \ingroup satellite
+ *
+ * \brief Benchmark for the time slicing forward link scheduler.
+ *
+ * The example runs forward link CBR traffic to all the UTs with the time
+ * slicing scheduler and without statistics, and prints the wall clock time
+ * of the simulation run. The scaling of the scheduler is seen by sweeping
+ * the number of slices, e.g.
+ *
+ *     $ for slices in 1 4 16 32; do
+ *         ./waf --run="sat-time-slicing-benchmark --slices=$slices"; done
+ *
+ * Every slice must fit at least one normal BB frame of the most robust MODCOD
+ * per scheduling interval. With the default carrier and the default 20 ms
+ * interval, this allows about 60 slices. More slices need a longer
+ * scheduling interval, e.g.
+ *
+ *     $ ./waf --run="sat-time-slicing-benchmark --slices=255 --schedulingInterval=100ms"
+ */
+
+NS_LOG_COMPONENT_DEFINE ("sat-time-slicing-benchmark");
+
+int
+main (int argc, char *argv[])
+{
+  std::string beams = "8";
+  uint32_t nbUtsPerBeam = 100;
+  uint32_t nbSlices = 16;
+  Time simLength = Seconds (10.0);
+  Time schedulingInterval = MilliSeconds (20);
+
+  uint32_t packetSize = 512;
+  Time interval = MilliSeconds (100);
+
+  Ptr<SimulationHelper> simulationHelper = CreateObject<SimulationHelper> ("example-time-slicing-benchmark");
+
+  CommandLine cmd;
+  cmd.AddValue ("utsPerBeam", "Number of UTs per spot-beam", nbUtsPerBeam);
+  cmd.AddValue ("slices", "Number of time slices (1-255)", nbSlices);
+  cmd.AddValue ("simLength", "Simulation duration in seconds", simLength);
+  cmd.AddValue ("schedulingInterval", "Scheduling interval of the forward link scheduler", schedulingInterval);
+  cmd.AddValue ("packetSize", "Size of the CBR packets in bytes", packetSize);
+  cmd.AddValue ("interval", "Interval of the CBR packets", interval);
+  simulationHelper->AddDefaultUiArguments (cmd);
+  cmd.Parse (argc, argv);
+
+  Config::SetDefault ("ns3::SatEnvVariables::EnableSimulationOutputOverwrite", BooleanValue (true));
+
+  Config::SetDefault ("ns3::SatGwHelper::FwdSchedulingAlgorithm", EnumValue (SatEnums::TIME_SLICING));
+  Config::SetDefault ("ns3::SatFwdLinkSchedulerTimeSlicing::NumberOfSlices", UintegerValue (nbSlices));
+  Config::SetDefault ("ns3::SatFwdLinkScheduler::Interval", TimeValue (schedulingInterval));
+
+  simulationHelper->SetSimulationTime (simLength);
+  simulationHelper->SetGwUserCount (1);
+  simulationHelper->SetUtCountPerBeam (nbUtsPerBeam);
+  simulationHelper->SetUserCountPerUt (1);
+  simulationHelper->SetBeams (beams);
+
+  simulationHelper->CreateSatScenario ();
+
+  Config::SetDefault ("ns3::CbrApplication::Interval", TimeValue (interval));
+  Config::SetDefault ("ns3::CbrApplication::PacketSize", UintegerValue (packetSize));
+
+  simulationHelper->InstallTrafficModel (
+    SimulationHelper::CBR,
+    SimulationHelper::UDP,
+    SimulationHelper::FWD_LINK,
+    Seconds (0.001), simLength);
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  simulationHelper->RunSimulation ();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+
+  std::cout << "slices=" << nbSlices
+            << " schedulingInterval=" << schedulingInterval.GetMilliSeconds () << " ms"
+            << " utsPerBeam=" << nbUtsPerBeam
+            << " simLength=" << simLength.GetSeconds () << " s"
+            << " wallClock=" << elapsed.count () << " s" << std::endl;
+
+  return 0;
+}
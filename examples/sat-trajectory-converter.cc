@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <iostream>
+
+#include <ns3/core-module.h>
+#include <ns3/satellite-module.h>
+
+
+using namespace ns3;
+
+/**
+ * \file sat-trajectory-converter.cc
+ * \ingroup satellite
+ *
+ * \brief Converts the mobile UT position trace files of a folder to the
+ * binary trajectory format, which is read faster than the text format
+ * when loading the mobile UTs from a folder. The converted files keep
+ * their names and are written to the output folder.
+ *
+ * execute command -> ./waf --run "sat-trajectory-converter --input=<folder> --output=<folder>"
+ */
+
+NS_LOG_COMPONENT_DEFINE ("sat-trajectory-converter");
+
+int
+main (int argc, char *argv[])
+{
+  std::string inputFolder;
+  std::string outputFolder;
+  uint32_t threads = 0;
+
+  CommandLine cmd;
+  cmd.AddValue ("input", "Folder of the position trace files to convert", inputFolder);
+  cmd.AddValue ("output", "Folder to write the binary trajectory files to", outputFolder);
+  cmd.AddValue ("threads", "Number of threads reading the files, 0 to use one per hardware thread", threads);
+  cmd.Parse (argc, argv);
+
+  if (!Singleton<SatEnvVariables>::Get ()->IsValidDirectory (inputFolder))
+    {
+      NS_FATAL_ERROR ("Input folder '" << inputFolder << "' does not exist");
+    }
+
+  if (outputFolder.empty () || outputFolder == inputFolder)
+    {
+      NS_FATAL_ERROR ("Output folder must be given and differ from the input folder");
+    }
+
+  SystemPath::MakeDirectories (outputFolder);
+
+  std::vector<std::string> filenames;
+  std::vector<std::string> filepaths;
+
+  for (std::string& filename : SystemPath::ReadFiles (inputFolder))
+    {
+      std::string filepath = inputFolder + "/" + filename;
+      if (!Singleton<SatEnvVariables>::Get ()->IsValidDirectory (filepath))
+        {
+          filenames.push_back (filename);
+          filepaths.push_back (filepath);
+        }
+    }
+
+  std::vector<Ptr<SatTrajectory> > trajectories;
+  SatTrajectory::LoadFiles (filepaths, threads, trajectories);
+
+  for (uint32_t i = 0; i < filenames.size (); ++i)
+    {
+      trajectories[i]->WriteBinary (outputFolder + "/" + filenames[i]);
+    }
+
+  std::cout << "Converted " << filenames.size () << " trajectories from "
+            << inputFolder << " to " << outputFolder << std::endl;
+
+  return 0;
+}
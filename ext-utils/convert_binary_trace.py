@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+convert_binary_trace.py - Convert a binary output trace written by
+SatOutputFileStreamDoubleContainer (attribute BinaryOutput) into the
+tab separated text layout of the text output traces
+"""
+
+import sys
+import struct
+import argparse
+
+
+MAGIC = b'SNS3TRC\0'
+VERSION = 1
+HEADER_SIZE = 16
+
+
+def convert(source, destination):
+    """
+    Convert a binary trace into text rows
+
+    Args:
+        source:       binary input file object
+        destination:  text output file object
+
+    Returns:
+        number of converted rows
+    """
+    header = source.read(HEADER_SIZE)
+    if len(header) != HEADER_SIZE:
+        raise ValueError('truncated header')
+
+    magic, version, values_in_row = struct.unpack('<8sII', header)
+    if magic != MAGIC or version != VERSION or values_in_row == 0:
+        raise ValueError('not a binary output trace')
+
+    row_format = struct.Struct('<{}d'.format(values_in_row))
+    rows = 0
+    while True:
+        data = source.read(row_format.size)
+        if len(data) < row_format.size:
+            break
+        # %g matches the default precision of the C++ text output
+        destination.write('\t'.join('%g' % value for value in row_format.unpack(data)))
+        destination.write('\n')
+        rows += 1
+
+    return rows
+
+
+if __name__ == "__main__":
+    # Define arguments
+    parser = argparse.ArgumentParser(
+        description='Convert a binary output trace into text format',
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+    )
+
+    parser.add_argument(
+        'input',
+        help='binary output trace file',
+    )
+
+    parser.add_argument(
+        'output',
+        nargs='?',
+        help='text output file (default: standard output)',
+        default=None,
+    )
+
+    # Parse arguments
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as source:
+        if args.output is None:
+            convert(source, sys.stdout)
+        else:
+            with open(args.output, 'w') as destination:
+                convert(source, destination)
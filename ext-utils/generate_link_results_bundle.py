@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+generate_link_results_bundle.py - Pack the link results text files into a
+binary bundle read by SatLinkResultsBundle
+"""
+
+import os
+import sys
+import glob
+import struct
+import argparse
+
+
+MAGIC = b'SNS3LRB\0'
+VERSION = 1
+HEADER_SIZE = 24
+NAME_LENGTH = 56
+ENTRY_SIZE = 72
+
+
+def read_table(path):
+    """
+    Read the Es/No and BLER columns of a link results text file
+
+    Args:
+        path:  path to the text file
+
+    Returns:
+        tuple of Es/No and BLER lists
+    """
+    es_no, bler = [], []
+    with open(path) as f:
+        values = f.read().split()
+
+    # Read pairs until the first non numeric value, like SatLookUpTable
+    for first, second in zip(values[0::2], values[1::2]):
+        try:
+            row = float(first), float(second)
+        except ValueError:
+            break
+        es_no.append(row[0])
+        bler.append(row[1])
+
+    return es_no, bler
+
+
+def fnv1a_64(data):
+    """
+    Calculate the FNV-1a 64-bit checksum of the data
+    """
+    value = 0xcbf29ce484222325
+    for byte in data:
+        value ^= byte
+        value = (value * 0x100000001b3) & 0xffffffffffffffff
+    return value
+
+
+def generate_bundle(directory, output):
+    """
+    Write the bundle of all the link results text files in a directory
+
+    Args:
+        directory:  link results directory
+        output:     path to the bundle file
+    """
+    tables = []
+    for path in sorted(glob.glob(os.path.join(directory, '*.txt'))):
+        name = os.path.basename(path)
+        if len(name.encode()) >= NAME_LENGTH:
+            print('Skipping', name, '(name too long)', file=sys.stderr)
+            continue
+        es_no, bler = read_table(path)
+        if not es_no:
+            print('Skipping', name, '(no link results)', file=sys.stderr)
+            continue
+        tables.append((name, es_no, bler))
+
+    body = bytearray()
+    offset = HEADER_SIZE + len(tables) * ENTRY_SIZE
+    data = bytearray()
+    for name, es_no, bler in tables:
+        rows = len(es_no)
+        body += struct.pack('<{}sIIQ'.format(NAME_LENGTH), name.encode(), rows, 0, offset + len(data))
+        data += struct.pack('<{}d'.format(2 * rows), *(es_no + bler))
+    body += data
+
+    header = struct.pack('<8sIIQ', MAGIC, VERSION, len(tables), fnv1a_64(body))
+    with open(output, 'wb') as f:
+        f.write(header)
+        f.write(body)
+
+    return len(tables)
+
+
+if __name__ == "__main__":
+    # Define arguments
+    parser = argparse.ArgumentParser(
+        description='Pack the link results text files into a binary bundle',
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+    )
+
+    parser.add_argument(
+        'directory',
+        help='link results directory, e.g. data/linkresults',
+    )
+
+    parser.add_argument(
+        '--output',
+        help='bundle file (default: <directory>/linkresults.bundle)',
+        default=None,
+    )
+
+    # Parse arguments
+    args = parser.parse_args()
+    output = args.output or os.path.join(args.directory, 'linkresults.bundle')
+
+    count = generate_bundle(args.directory, output)
+    print('Wrote', count, 'tables to', output)
@@ -89,7 +89,9 @@ SatBeamHelper::GetTypeId (void)
                    MakeEnumChecker (SatPhyRxCarrierConf::IF_CONSTANT, "Constant",
                                     SatPhyRxCarrierConf::IF_TRACE, "Trace",
                                     SatPhyRxCarrierConf::IF_PER_PACKET, "PerPacket",
-                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT, "PerFragment"))
+                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT, "PerFragment",
+                                    SatPhyRxCarrierConf::IF_PER_PACKET_FLAT, "PerPacketFlat",
+                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT_FLAT, "PerFragmentFlat"))
     .AddAttribute ("RaInterferenceEliminationModel",
                    "Interference elimination model for random access",
                    EnumValue (SatPhyRxCarrierConf::SIC_PERFECT),
@@ -61,7 +61,9 @@ SatGeoHelper::GetTypeId (void)
                    MakeEnumChecker (SatPhyRxCarrierConf::IF_CONSTANT, "Constant",
                                     SatPhyRxCarrierConf::IF_TRACE, "Trace",
                                     SatPhyRxCarrierConf::IF_PER_PACKET, "PerPacket",
-                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT, "PerFragment"))
+                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT, "PerFragment",
+                                    SatPhyRxCarrierConf::IF_PER_PACKET_FLAT, "PerPacketFlat",
+                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT_FLAT, "PerFragmentFlat"))
     .AddAttribute ("DaRtnLinkInterferenceModel",
                    "Return link interference model for dedicated access",
                    EnumValue (SatPhyRxCarrierConf::IF_PER_PACKET),
@@ -69,7 +71,9 @@ SatGeoHelper::GetTypeId (void)
                    MakeEnumChecker (SatPhyRxCarrierConf::IF_CONSTANT, "Constant",
                                     SatPhyRxCarrierConf::IF_TRACE, "Trace",
                                     SatPhyRxCarrierConf::IF_PER_PACKET, "PerPacket",
-                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT, "PerFragment"))
+                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT, "PerFragment",
+                                    SatPhyRxCarrierConf::IF_PER_PACKET_FLAT, "PerPacketFlat",
+                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT_FLAT, "PerFragmentFlat"))
     .AddTraceSource ("Creation", "Creation traces",
                      MakeTraceSourceAccessor (&SatGeoHelper::m_creationTrace),
                      "ns3::SatTypedefs::CreationCallback")
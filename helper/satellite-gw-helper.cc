@@ -79,7 +79,9 @@ SatGwHelper::GetTypeId (void)
                    MakeEnumChecker (SatPhyRxCarrierConf::IF_CONSTANT, "Constant",
                                     SatPhyRxCarrierConf::IF_TRACE, "Trace",
                                     SatPhyRxCarrierConf::IF_PER_PACKET, "PerPacket",
-                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT, "PerFragment"))
+                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT, "PerFragment",
+                                    SatPhyRxCarrierConf::IF_PER_PACKET_FLAT, "PerPacketFlat",
+                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT_FLAT, "PerFragmentFlat"))
     .AddAttribute ("RtnLinkErrorModel",
                    "Return link error model for",
                    EnumValue (SatPhyRxCarrierConf::EM_AVI),
@@ -417,6 +419,38 @@ SatGwHelper::Install (Ptr<Node> n, uint32_t gwId, uint32_t beamId, Ptr<SatChanne
   return dev;
 }
 
+int64_t
+SatGwHelper::AssignStreams (NodeContainer c, int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+
+  for (NodeContainer::Iterator i = c.Begin (); i != c.End (); i++)
+    {
+      for (uint32_t j = 0; j < (*i)->GetNDevices (); j++)
+        {
+          Ptr<SatNetDevice> dev = DynamicCast<SatNetDevice> ((*i)->GetDevice (j));
+
+          if (dev == NULL)
+            {
+              continue;
+            }
+
+          Ptr<SatGwMac> mac = DynamicCast<SatGwMac> (dev->GetMac ());
+
+          if (mac != NULL)
+            {
+              PointerValue scheduler;
+              mac->GetAttribute ("Scheduler", scheduler);
+              currentStream += scheduler.Get<SatFwdLinkScheduler> ()->AssignStreams (currentStream);
+            }
+        }
+    }
+
+  return (currentStream - stream);
+}
+
 void
 SatGwHelper::EnableCreationTraces (Ptr<OutputStreamWrapper> stream, CallbackBase &cb)
 {
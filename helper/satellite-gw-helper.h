@@ -165,6 +165,17 @@ public:
    */
   Ptr<NetDevice> Install (Ptr<Node> n, uint32_t gwId, uint32_t beamId, Ptr<SatChannel> fCh, Ptr<SatChannel> rCh, Ptr<SatNcc> ncc, Ptr<SatLowerLayerServiceConf> llsConf);
 
+  /**
+   * Assign a fixed random variable stream number to the random variables
+   * used by the forward link schedulers of the GW devices, including the
+   * MODCOD queue selection of their BB frame containers.
+   *
+   * \param c the GW nodes, whose satellite devices are assigned the streams
+   * \param stream first stream index to use
+   * \return the number of stream indices assigned by this helper
+   */
+  int64_t AssignStreams (NodeContainer c, int64_t stream);
+
   /**
    * Enables creation traces to be written in given file
    * \param stream  stream for creation trace outputs
@@ -41,6 +41,8 @@
 #include <ns3/satellite-log.h>
 #include <ns3/satellite-env-variables.h>
 #include <ns3/satellite-traced-mobility-model.h>
+#include <ns3/satellite-position-input-trace-container.h>
+#include <ns3/satellite-trajectory.h>
 #include <ns3/satellite-ut-handover-module.h>
 #include "satellite-helper.h"
 
@@ -155,6 +157,16 @@ SatHelper::GetTypeId (void)
                    StringValue ("CreationTraceUt"),
                    MakeStringAccessor (&SatHelper::m_utCreationFileName),
                    MakeStringChecker ())
+    .AddAttribute ("EnableTrajectoryPreloading",
+                   "Read the trajectories of the mobile UTs loaded from a folder in parallel before creating the UTs.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatHelper::m_enableTrajectoryPreloading),
+                   MakeBooleanChecker ())
+    .AddAttribute ("TrajectoryReadingThreads",
+                   "Number of threads reading the trajectories of the mobile UTs, 0 to use one per hardware thread.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&SatHelper::m_trajectoryReadingThreads),
+                   MakeUintegerChecker<uint32_t> ())
     .AddTraceSource ("Creation", "Creation traces",
                      MakeTraceSourceAccessor (&SatHelper::m_creationDetailsTrace),
                      "ns3::SatTypedefs::CreationCallback")
@@ -184,6 +196,8 @@ SatHelper::SatHelper ()
   m_creationTraces (false),
   m_detailedCreationTraces (false),
   m_packetTraces (false),
+  m_enableTrajectoryPreloading (false),
+  m_trajectoryReadingThreads (0),
   m_utsInBeam (0),
   m_gwUsers (0),
   m_utUsers (0),
@@ -582,6 +596,8 @@ SatHelper::LoadMobileUTsFromFolder (const std::string& folderName, Ptr<RandomVar
       return;
     }
 
+  std::vector<std::string> filepaths;
+
   for (std::string& filename : SystemPath::ReadFiles (folderName))
     {
       std::string filepath = folderName + "/" + filename;
@@ -591,6 +607,23 @@ SatHelper::LoadMobileUTsFromFolder (const std::string& folderName, Ptr<RandomVar
           continue;
         }
 
+      filepaths.push_back (filepath);
+    }
+
+  if (m_enableTrajectoryPreloading)
+    {
+      // The mobility models take the positions from the preloaded trajectories
+      std::vector<Ptr<SatTrajectory> > trajectories;
+      SatTrajectory::LoadFiles (filepaths, m_trajectoryReadingThreads, trajectories);
+
+      for (uint32_t i = 0; i < filepaths.size (); ++i)
+        {
+          Singleton<SatPositionInputTraceContainer>::Get ()->AddTrajectory (filepaths[i], trajectories[i]);
+        }
+    }
+
+  for (std::string& filepath : filepaths)
+    {
       Ptr<Node> utNode = LoadMobileUtFromFile (filepath);
       uint32_t bestBeamId = utNode->GetObject<SatTracedMobilityModel> ()->GetBestBeamId ();
 
@@ -741,6 +774,14 @@ SatHelper::InstallMobilityObserver (NodeContainer nodes) const
     }
 }
 
+int64_t
+SatHelper::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  return m_beamHelper->GetGwHelper ()->AssignStreams (GwNodes (), stream);
+}
+
 void
 SatHelper::SetMulticastGroupRoutes (Ptr<Node> source, NodeContainer receivers, Ipv4Address sourceAddress, Ipv4Address groupAddress)
 {
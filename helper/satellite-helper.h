@@ -186,6 +186,15 @@ public:
    */
   void SetMulticastGroupRoutes (Ptr<Node> source, NodeContainer receivers, Ipv4Address sourceAddress, Ipv4Address groupAddress );
 
+  /**
+   * Assign a fixed random variable stream number to the random variables
+   * used by the GW devices of the created scenario.
+   *
+   * \param stream first stream index to use
+   * \return the number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
   inline NodeContainer GwNodes ()
   {
     return m_beamHelper->GetGwNodes ();
@@ -297,6 +306,16 @@ private:
    */
   bool m_packetTraces;
 
+  /**
+   * flag to indicate if the trajectories of the mobile UTs are read in parallel before creating the UTs.
+   */
+  bool m_enableTrajectoryPreloading;
+
+  /**
+   * Number of threads reading the trajectories of the mobile UTs.
+   */
+  uint32_t m_trajectoryReadingThreads;
+
   /**
    * Number of UTs created per Beam in full or user-defined scenario
    */
@@ -83,7 +83,9 @@ SatUtHelper::GetTypeId (void)
                    MakeEnumChecker (SatPhyRxCarrierConf::IF_CONSTANT, "Constant",
                                     SatPhyRxCarrierConf::IF_TRACE, "Trace",
                                     SatPhyRxCarrierConf::IF_PER_PACKET, "PerPacket",
-                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT, "PerFragment"))
+                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT, "PerFragment",
+                                    SatPhyRxCarrierConf::IF_PER_PACKET_FLAT, "PerPacketFlat",
+                                    SatPhyRxCarrierConf::IF_PER_FRAGMENT_FLAT, "PerFragmentFlat"))
     .AddAttribute ("FwdLinkErrorModel",
                    "Forward link error model",
                    EnumValue (SatPhyRxCarrierConf::EM_AVI),
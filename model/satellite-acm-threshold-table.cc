@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/log.h"
+
+#include "satellite-acm-threshold-table.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatAcmThresholdTable");
+
+namespace ns3 {
+
+SatAcmThresholdTable::SatAcmThresholdTable ()
+  : m_thresholds (),
+  m_envelope (),
+  m_ids ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatAcmThresholdTable::Add (double cnoThreshold, uint32_t id)
+{
+  NS_LOG_FUNCTION (this << cnoThreshold << id);
+
+  double envelope = cnoThreshold;
+
+  if (!m_envelope.empty () && m_envelope.back () < envelope)
+    {
+      envelope = m_envelope.back ();
+    }
+
+  m_thresholds.push_back (cnoThreshold);
+  m_envelope.push_back (envelope);
+  m_ids.push_back (id);
+}
+
+void
+SatAcmThresholdTable::Clear ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_thresholds.clear ();
+  m_envelope.clear ();
+  m_ids.clear ();
+}
+
+uint32_t
+SatAcmThresholdTable::Find (double cno) const
+{
+  uint32_t size = m_envelope.size ();
+
+  // No candidate meets the C/No (also the case with NaN C/No)
+  if (size == 0 || !(m_envelope[size - 1] <= cno))
+    {
+      return size;
+    }
+
+  // Branchless lower bound of the first position meeting the C/No
+  const double *base = &m_envelope[0];
+  uint32_t length = size;
+
+  while (length > 1)
+    {
+      uint32_t half = length / 2;
+      base += (base[half - 1] <= cno) ? 0 : half;
+      length -= half;
+    }
+
+  return base - &m_envelope[0];
+}
+
+} // namespace ns3
@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_ACM_THRESHOLD_TABLE_H_
+#define SATELLITE_ACM_THRESHOLD_TABLE_H_
+
+#include <vector>
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ * \brief SatAcmThresholdTable is a precomputed table for ACM selection. The
+ * candidates (MODCODs or waveforms) are added in the order of preference, i.e.
+ * the one with the best spectral efficiency first. The selection returns the
+ * first candidate whose C/No threshold is met.
+ *
+ * The selection is done with a binary search over the running minimum of the
+ * thresholds, which is non-increasing in the order of preference. The first
+ * position where the running minimum meets the C/No is also the first candidate
+ * meeting the C/No, thus the result is the same as with a linear search even if
+ * the thresholds are not monotonic.
+ */
+class SatAcmThresholdTable
+{
+public:
+  /**
+   * Default constructor
+   */
+  SatAcmThresholdTable ();
+
+  /**
+   * \brief Add a candidate as the next preferred one.
+   * \param cnoThreshold C/No threshold of the candidate
+   * \param id Identifier of the candidate
+   */
+  void Add (double cnoThreshold, uint32_t id);
+
+  /**
+   * \brief Remove all the candidates.
+   */
+  void Clear ();
+
+  /**
+   * \brief Get the number of candidates.
+   * \return Number of candidates
+   */
+  inline uint32_t GetSize () const
+  {
+    return m_ids.size ();
+  }
+
+  /**
+   * \brief Find the first candidate whose C/No threshold is met.
+   * \param cno C/No
+   * \return Index of the candidate or GetSize () if none is met
+   */
+  uint32_t Find (double cno) const;
+
+  /**
+   * \brief Get the identifier of a candidate.
+   * \param index Index of the candidate
+   * \return Identifier
+   */
+  inline uint32_t GetId (uint32_t index) const
+  {
+    return m_ids[index];
+  }
+
+  /**
+   * \brief Get the C/No threshold of a candidate.
+   * \param index Index of the candidate
+   * \return C/No threshold
+   */
+  inline double GetThreshold (uint32_t index) const
+  {
+    return m_thresholds[index];
+  }
+
+private:
+  /**
+   * C/No thresholds in the order of preference
+   */
+  std::vector<double> m_thresholds;
+
+  /**
+   * Running minimum of the C/No thresholds
+   */
+  std::vector<double> m_envelope;
+
+  /**
+   * Candidate identifiers in the order of preference
+   */
+  std::vector<uint32_t> m_ids;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_ACM_THRESHOLD_TABLE_H_ */
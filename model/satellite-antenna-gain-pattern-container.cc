@@ -19,7 +19,22 @@
  */
 
 #include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <atomic>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "ns3/log.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "satellite-utils.h"
 #include "satellite-antenna-gain-pattern-container.h"
 #include "ns3/singleton.h"
 #include "ns3/satellite-env-variables.h"
@@ -36,14 +51,65 @@ SatAntennaGainPatternContainer::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::SatAntennaGainPatternContainer")
     .SetParent<Object> ()
-    .AddConstructor<SatAntennaGainPatternContainer> ();
+    .AddConstructor<SatAntennaGainPatternContainer> ()
+    .AddAttribute ("EnableBestBeamMap",
+                   "Use a precomputed best beam map for the best beam queries.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&SatAntennaGainPatternContainer::m_enableBestBeamMap),
+                   MakeBooleanChecker ())
+    .AddAttribute ("BestBeamMapFileName",
+                   "Name of the best beam map file in the antenna pattern directory.",
+                   StringValue ("SatAntennaGain72Beams_bestbeam.bin"),
+                   MakeStringAccessor (&SatAntennaGainPatternContainer::m_bestBeamMapFileName),
+                   MakeStringChecker ())
+    .AddAttribute ("EnablePatternCache",
+                   "Read the antenna patterns from a binary cache, created at the first read of the antenna pattern files.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&SatAntennaGainPatternContainer::m_enablePatternCache),
+                   MakeBooleanChecker ())
+    .AddAttribute ("PatternCacheFileName",
+                   "Name of the antenna pattern cache file in the antenna pattern directory.",
+                   StringValue ("SatAntennaGain72Beams.cache"),
+                   MakeStringAccessor (&SatAntennaGainPatternContainer::m_patternCacheFileName),
+                   MakeStringChecker ())
+    .AddAttribute ("PatternReadingThreads",
+                   "Number of threads reading the antenna pattern files, 0 to use one per hardware thread.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&SatAntennaGainPatternContainer::m_patternReadingThreads),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
   return tid;
 }
 
+TypeId
+SatAntennaGainPatternContainer::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
 SatAntennaGainPatternContainer::SatAntennaGainPatternContainer ()
+  : m_patternDirectory (),
+  m_enablePatternCache (true),
+  m_patternCacheFileName (),
+  m_readFromPatternCache (false),
+  m_patternReadingThreads (0),
+  m_enableBestBeamMap (true),
+  m_bestBeamMapFileName (),
+  m_bestBeamMapBuilt (false),
+  m_bestBeamMapValid (false),
+  m_latCells (0),
+  m_lonCells (0),
+  m_cellOffsets (),
+  m_cellCandidates (),
+  m_allBeamIds ()
 {
   NS_LOG_FUNCTION (this);
 
+  // Attributes are needed already in construction phase:
+  // - ConstructSelf call in constructor
+  // - GetInstanceTypeId is needed to be implemented
+  ObjectBase::ConstructSelf (AttributeConstructionList ());
+
   /**
    * TODO: To change the reference system, these hard coded paths
    * and filenames may have to be changed! One way could be to hard
@@ -51,15 +117,41 @@ SatAntennaGainPatternContainer::SatAntennaGainPatternContainer ()
    * according to the wanted reference system.
    */
   std::string dataPath = Singleton<SatEnvVariables>::Get ()->LocateDataDirectory ();
-  std::string path = dataPath + "/antennapatterns/SatAntennaGain72Beams_";
+  m_patternDirectory = dataPath + "/antennapatterns/";
+  std::string path = m_patternDirectory + "SatAntennaGain72Beams_";
 
-  // Note, that the beam ids start from 1
+  std::vector<std::string> filePathNames;
   for (uint32_t i = 1; i <= NUMBER_OF_BEAMS; ++i)
     {
       std::ostringstream ss;
       ss << i;
-      std::string filePathName = path + ss.str () + ".txt";
-      Ptr<SatAntennaGainPattern> gainPattern = CreateObject<SatAntennaGainPattern> (filePathName);
+      filePathNames.push_back (path + ss.str () + ".txt");
+    }
+
+  // Valid positions depend on the minimum acceptable gain of the patterns
+  DoubleValue minAcceptableGain;
+  CreateObject<SatAntennaGainPattern> ()->GetAttribute ("MinAcceptableAntennaGainDb", minAcceptableGain);
+
+  std::vector<SatAntennaGainPattern::PatternData_t> patterns (NUMBER_OF_BEAMS);
+  std::string cachePathName = m_patternDirectory + m_patternCacheFileName;
+
+  m_readFromPatternCache = m_enablePatternCache
+    && LoadPatternCache (cachePathName, filePathNames, minAcceptableGain.Get (), patterns);
+
+  if (!m_readFromPatternCache)
+    {
+      ReadPatternFiles (filePathNames, minAcceptableGain.Get (), patterns);
+
+      if (m_enablePatternCache)
+        {
+          SavePatternCache (cachePathName, filePathNames, minAcceptableGain.Get (), patterns);
+        }
+    }
+
+  // Note, that the beam ids start from 1
+  for (uint32_t i = 1; i <= NUMBER_OF_BEAMS; ++i)
+    {
+      Ptr<SatAntennaGainPattern> gainPattern = CreateObject<SatAntennaGainPattern> (patterns[i - 1]);
 
       std::pair<std::map<uint32_t, Ptr<SatAntennaGainPattern> >::iterator, bool> ret;
       ret = m_antennaPatternMap.insert (std::pair<uint32_t, Ptr<SatAntennaGainPattern> > (i, gainPattern));
@@ -68,6 +160,8 @@ SatAntennaGainPatternContainer::SatAntennaGainPatternContainer ()
         {
           NS_FATAL_ERROR (this << " an antenna pattern for beam " << i << " already exists!");
         }
+
+      m_allBeamIds.push_back (i);
     }
 }
 
@@ -76,6 +170,284 @@ SatAntennaGainPatternContainer::~SatAntennaGainPatternContainer ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+SatAntennaGainPatternContainer::ReadPatternFiles (const std::vector<std::string>& filePathNames,
+                                                  double minAcceptableGainDb,
+                                                  std::vector<SatAntennaGainPattern::PatternData_t>& patterns) const
+{
+  NS_LOG_FUNCTION (this << minAcceptableGainDb);
+
+  uint32_t threadCount = m_patternReadingThreads;
+  if (threadCount == 0)
+    {
+      threadCount = std::max (1u, std::thread::hardware_concurrency ());
+    }
+  threadCount = std::min<uint32_t> (threadCount, filePathNames.size ());
+
+  // The files are parsed in parallel, simulator objects are created
+  // afterwards in the main thread
+  std::atomic<uint32_t> nextFile (0);
+  auto reader = [&] ()
+    {
+      for (uint32_t i = nextFile++; i < filePathNames.size (); i = nextFile++)
+        {
+          SatAntennaGainPattern::ReadAntennaPatternFromFile (filePathNames[i], minAcceptableGainDb, patterns[i]);
+        }
+    };
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < threadCount; ++i)
+    {
+      threads.emplace_back (reader);
+    }
+  reader ();
+
+  for (std::thread& thread : threads)
+    {
+      thread.join ();
+    }
+
+  NS_LOG_INFO ("Read " << filePathNames.size () << " antenna patterns with " << threadCount << " threads");
+}
+
+bool
+SatAntennaGainPatternContainer::GetSourceFileInfo (std::string filePathName, uint64_t& size, int64_t& modificationTime)
+{
+  struct stat st;
+
+  // Same fallback path as when reading the antenna pattern
+  if (stat (filePathName.c_str (), &st) != 0
+      && stat (("../../" + filePathName).c_str (), &st) != 0)
+    {
+      return false;
+    }
+
+  size = st.st_size;
+  modificationTime = st.st_mtime;
+  return true;
+}
+
+bool
+SatAntennaGainPatternContainer::LoadPatternCache (std::string cachePathName,
+                                                  const std::vector<std::string>& filePathNames,
+                                                  double minAcceptableGainDb,
+                                                  std::vector<SatAntennaGainPattern::PatternData_t>& patterns) const
+{
+  NS_LOG_FUNCTION (this << cachePathName);
+
+  int fd = open (cachePathName.c_str (), O_RDONLY);
+  if (fd < 0)
+    {
+      NS_LOG_INFO ("Antenna pattern cache " << cachePathName << " not found");
+      return false;
+    }
+
+  struct stat st;
+  if (fstat (fd, &st) != 0 || (uint64_t) st.st_size < PATTERN_CACHE_HEADER_SIZE)
+    {
+      close (fd);
+      return false;
+    }
+
+  uint64_t cacheSize = st.st_size;
+  void* mapping = mmap (NULL, cacheSize, PROT_READ, MAP_SHARED, fd, 0);
+  close (fd);
+
+  if (mapping == MAP_FAILED)
+    {
+      return false;
+    }
+
+  const uint8_t* cache = static_cast<const uint8_t*> (mapping);
+  bool valid = ParsePatternCache (cache, cacheSize, filePathNames, minAcceptableGainDb, patterns);
+  munmap (mapping, cacheSize);
+
+  if (valid)
+    {
+      NS_LOG_INFO ("Antenna patterns read from cache " << cachePathName);
+    }
+  else
+    {
+      NS_LOG_INFO ("Antenna pattern cache " << cachePathName << " is out of date");
+    }
+
+  return valid;
+}
+
+bool
+SatAntennaGainPatternContainer::ParsePatternCache (const uint8_t* cache, uint64_t cacheSize,
+                                                   const std::vector<std::string>& filePathNames,
+                                                   double minAcceptableGainDb,
+                                                   std::vector<SatAntennaGainPattern::PatternData_t>& patterns) const
+{
+  NS_LOG_FUNCTION (this << cacheSize);
+
+  uint32_t version;
+  uint32_t beams;
+  double cacheMinGainDb;
+  uint64_t checksum;
+
+  std::memcpy (&version, cache + 8, sizeof (version));
+  std::memcpy (&beams, cache + 12, sizeof (beams));
+  std::memcpy (&cacheMinGainDb, cache + 16, sizeof (cacheMinGainDb));
+  std::memcpy (&checksum, cache + 24, sizeof (checksum));
+
+  if (std::memcmp (cache, "SNS3AGP", 8) != 0
+      || version != PATTERN_CACHE_VERSION
+      || beams != filePathNames.size ()
+      || cacheMinGainDb != minAcceptableGainDb
+      || cacheSize < PATTERN_CACHE_HEADER_SIZE + (uint64_t) beams * PATTERN_CACHE_ENTRY_SIZE
+      || SatUtils::CalculateChecksum (cache + PATTERN_CACHE_HEADER_SIZE, cacheSize - PATTERN_CACHE_HEADER_SIZE) != checksum)
+    {
+      return false;
+    }
+
+  for (uint32_t i = 0; i < beams; ++i)
+    {
+      const uint8_t* entry = cache + PATTERN_CACHE_HEADER_SIZE + i * PATTERN_CACHE_ENTRY_SIZE;
+
+      uint64_t sourceSize;
+      int64_t sourceModificationTime;
+      uint32_t counts[3];
+      double limits[6];
+      uint64_t offset;
+
+      std::memcpy (&sourceSize, entry, sizeof (sourceSize));
+      std::memcpy (&sourceModificationTime, entry + 8, sizeof (sourceModificationTime));
+      std::memcpy (counts, entry + 16, sizeof (counts));
+      std::memcpy (limits, entry + 32, sizeof (limits));
+      std::memcpy (&offset, entry + 80, sizeof (offset));
+
+      // The cache is out of date as soon as one antenna pattern file has changed
+      uint64_t size;
+      int64_t modificationTime;
+      if (!GetSourceFileInfo (filePathNames[i], size, modificationTime)
+          || size != sourceSize
+          || modificationTime != sourceModificationTime)
+        {
+          return false;
+        }
+
+      uint64_t latCount = counts[0];
+      uint64_t lonCount = counts[1];
+      uint64_t validCount = counts[2];
+      uint64_t length = (latCount + lonCount + latCount * lonCount + 2 * validCount) * sizeof (double);
+      if (offset > cacheSize || length > cacheSize - offset)
+        {
+          return false;
+        }
+
+      SatAntennaGainPattern::PatternData_t& data = patterns[i];
+      const double* values = reinterpret_cast<const double*> (cache + offset);
+
+      data.latitudes.assign (values, values + latCount);
+      values += latCount;
+      data.longitudes.assign (values, values + lonCount);
+      values += lonCount;
+      data.gains.assign (values, values + latCount * lonCount);
+      values += latCount * lonCount;
+      data.validPositions.resize (validCount);
+      for (uint64_t j = 0; j < validCount; ++j)
+        {
+          data.validPositions[j] = std::make_pair (values[2 * j], values[2 * j + 1]);
+        }
+
+      data.minLat = limits[0];
+      data.minLon = limits[1];
+      data.maxLat = limits[2];
+      data.maxLon = limits[3];
+      data.latInterval = limits[4];
+      data.lonInterval = limits[5];
+    }
+
+  return true;
+}
+
+void
+SatAntennaGainPatternContainer::SavePatternCache (std::string cachePathName,
+                                                  const std::vector<std::string>& filePathNames,
+                                                  double minAcceptableGainDb,
+                                                  const std::vector<SatAntennaGainPattern::PatternData_t>& patterns) const
+{
+  NS_LOG_FUNCTION (this << cachePathName);
+
+  uint32_t beams = patterns.size ();
+  std::vector<uint8_t> directory (beams * PATTERN_CACHE_ENTRY_SIZE, 0);
+  std::vector<double> values;
+  uint64_t offset = PATTERN_CACHE_HEADER_SIZE + directory.size ();
+
+  for (uint32_t i = 0; i < beams; ++i)
+    {
+      const SatAntennaGainPattern::PatternData_t& data = patterns[i];
+
+      uint64_t sourceSize;
+      int64_t sourceModificationTime;
+      if (!GetSourceFileInfo (filePathNames[i], sourceSize, sourceModificationTime))
+        {
+          return;
+        }
+
+      uint32_t counts[3] = { (uint32_t) data.latitudes.size (),
+                             (uint32_t) data.longitudes.size (),
+                             (uint32_t) data.validPositions.size () };
+      double limits[6] = { data.minLat, data.minLon, data.maxLat, data.maxLon,
+                           data.latInterval, data.lonInterval };
+      uint64_t entryOffset = offset + values.size () * sizeof (double);
+
+      uint8_t* entry = &directory[i * PATTERN_CACHE_ENTRY_SIZE];
+      std::memcpy (entry, &sourceSize, sizeof (sourceSize));
+      std::memcpy (entry + 8, &sourceModificationTime, sizeof (sourceModificationTime));
+      std::memcpy (entry + 16, counts, sizeof (counts));
+      std::memcpy (entry + 32, limits, sizeof (limits));
+      std::memcpy (entry + 80, &entryOffset, sizeof (entryOffset));
+
+      values.insert (values.end (), data.latitudes.begin (), data.latitudes.end ());
+      values.insert (values.end (), data.longitudes.begin (), data.longitudes.end ());
+      values.insert (values.end (), data.gains.begin (), data.gains.end ());
+      for (const std::pair<double, double>& position : data.validPositions)
+        {
+          values.push_back (position.first);
+          values.push_back (position.second);
+        }
+    }
+
+  uint64_t checksum = SatUtils::CalculateChecksum (directory.data (), directory.size ());
+  checksum = SatUtils::CalculateChecksum (reinterpret_cast<const uint8_t*> (values.data ()),
+                                          values.size () * sizeof (double), checksum);
+
+  uint8_t header[PATTERN_CACHE_HEADER_SIZE] = { 0 };
+  uint32_t version = PATTERN_CACHE_VERSION;
+  std::memcpy (header, "SNS3AGP", 8);
+  std::memcpy (header + 8, &version, sizeof (version));
+  std::memcpy (header + 12, &beams, sizeof (beams));
+  std::memcpy (header + 16, &minAcceptableGainDb, sizeof (minAcceptableGainDb));
+  std::memcpy (header + 24, &checksum, sizeof (checksum));
+
+  // Write to a temporary file first, so that simulations started at the
+  // same time never read a partially written cache
+  std::ostringstream tmpName;
+  tmpName << cachePathName << "." << getpid ();
+
+  std::ofstream ofs (tmpName.str ().c_str (), std::ofstream::out | std::ofstream::binary);
+
+  if (!ofs.is_open ())
+    {
+      NS_LOG_INFO ("Antenna pattern cache could not be stored to " << cachePathName);
+      return;
+    }
+
+  ofs.write (reinterpret_cast<const char*> (header), sizeof (header));
+  ofs.write (reinterpret_cast<const char*> (directory.data ()), directory.size ());
+  ofs.write (reinterpret_cast<const char*> (values.data ()), values.size () * sizeof (double));
+  ofs.close ();
+
+  if (ofs.fail () || std::rename (tmpName.str ().c_str (), cachePathName.c_str ()) != 0)
+    {
+      NS_LOG_INFO ("Antenna pattern cache could not be stored to " << cachePathName);
+      std::remove (tmpName.str ().c_str ());
+    }
+}
+
 Ptr<SatAntennaGainPattern>
 SatAntennaGainPatternContainer::GetAntennaGainPattern (uint32_t beamId) const
 {
@@ -95,12 +467,60 @@ SatAntennaGainPatternContainer::GetBestBeamId (GeoCoordinate coord) const
 {
   NS_LOG_FUNCTION (this << coord.GetLatitude () << coord.GetLongitude ());
 
+  if (m_enableBestBeamMap)
+    {
+      if (!m_bestBeamMapBuilt)
+        {
+          BuildBestBeamMap ();
+        }
+
+      if (m_bestBeamMapValid)
+        {
+          uint32_t latIndex;
+          uint32_t lonIndex;
+          m_antennaPatternMap.at (1)->GetGridCell (coord, latIndex, lonIndex);
+
+          if (latIndex < m_latCells && lonIndex < m_lonCells)
+            {
+              uint32_t cell = latIndex * m_lonCells + lonIndex;
+              uint32_t first = m_cellOffsets[cell];
+              uint32_t count = m_cellOffsets[cell + 1] - first;
+
+              if (count == 1)
+                {
+                  return m_cellCandidates[first];
+                }
+              else if (count > 1)
+                {
+                  return GetBestBeamIdFromPatterns (coord, &m_cellCandidates[first], count);
+                }
+            }
+        }
+    }
+
+  // Positions not covered by the map are checked against all the beams
+  return GetBestBeamIdFromPatterns (coord, m_allBeamIds.data (), m_allBeamIds.size ());
+}
+
+bool
+SatAntennaGainPatternContainer::IsReadFromPatternCache () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return m_readFromPatternCache;
+}
+
+uint32_t
+SatAntennaGainPatternContainer::GetBestBeamIdFromPatterns (GeoCoordinate coord, const uint16_t* beamIds, uint32_t count) const
+{
+  NS_LOG_FUNCTION (this << coord.GetLatitude () << coord.GetLongitude () << count);
+
   double bestGain (-100.0);
   uint32_t bestId (0);
 
-  for (uint32_t i = 1; i <= NUMBER_OF_BEAMS; ++i)
+  for (uint32_t i = 0; i < count; ++i)
     {
-      double gain = m_antennaPatternMap.at (i)->GetAntennaGain_lin (coord);
+      double gain = m_antennaPatternMap.at (beamIds[i])->GetAntennaGain_lin (coord);
 
       // The antenna pattern has returned a NAN gain. This means
       // that this position is not valid. Return 0, which is not a valid beam id.
@@ -111,13 +531,275 @@ SatAntennaGainPatternContainer::GetBestBeamId (GeoCoordinate coord) const
       else if (gain > bestGain)
         {
           bestGain = gain;
-          bestId = i;
+          bestId = beamIds[i];
         }
     }
 
   return bestId;
 }
 
+void
+SatAntennaGainPatternContainer::BuildBestBeamMap () const
+{
+  NS_LOG_FUNCTION (this);
+
+  m_bestBeamMapBuilt = true;
+  m_bestBeamMapValid = false;
+
+  // The map requires that all the antenna patterns share the same grid
+  const std::vector<double>& latitudes = m_antennaPatternMap.at (1)->GetGridLatitudes ();
+  const std::vector<double>& longitudes = m_antennaPatternMap.at (1)->GetGridLongitudes ();
+
+  if (latitudes.size () < 2 || longitudes.size () < 2)
+    {
+      return;
+    }
+
+  for (uint32_t i = 2; i <= NUMBER_OF_BEAMS; ++i)
+    {
+      if (m_antennaPatternMap.at (i)->GetGridLatitudes () != latitudes
+          || m_antennaPatternMap.at (i)->GetGridLongitudes () != longitudes)
+        {
+          NS_LOG_INFO ("Antenna patterns do not share the same grid, best beam map not used");
+          return;
+        }
+    }
+
+  m_latCells = latitudes.size () - 1;
+  m_lonCells = longitudes.size () - 1;
+
+  uint64_t checksum = CalculatePatternChecksum ();
+  std::string filePathName = m_patternDirectory + m_bestBeamMapFileName;
+
+  if (!LoadBestBeamMap (filePathName, checksum))
+    {
+      ComputeBestBeamMap ();
+      SaveBestBeamMap (filePathName, checksum);
+    }
+
+  m_bestBeamMapValid = true;
+}
+
+void
+SatAntennaGainPatternContainer::ComputeBestBeamMap () const
+{
+  NS_LOG_FUNCTION (this);
+
+  // Margin covering the rounding of the interpolation
+  const double margin = 1e-9;
+
+  std::vector<double> lowestGain (NUMBER_OF_BEAMS + 1);
+  std::vector<double> highestGain (NUMBER_OF_BEAMS + 1);
+
+  m_cellOffsets.clear ();
+  m_cellCandidates.clear ();
+  m_cellOffsets.reserve (m_latCells * m_lonCells + 1);
+
+  for (uint32_t lat = 0; lat < m_latCells; ++lat)
+    {
+      for (uint32_t lon = 0; lon < m_lonCells; ++lon)
+        {
+          m_cellOffsets.push_back (m_cellCandidates.size ());
+
+          bool defined = true;
+          double bestLowestGain = 0.0;
+
+          for (uint32_t i = 1; i <= NUMBER_OF_BEAMS && defined; ++i)
+            {
+              Ptr<SatAntennaGainPattern> pattern = m_antennaPatternMap.at (i);
+              double corners[4] = { pattern->GetGridGain_dB (lat, lon),
+                                    pattern->GetGridGain_dB (lat, lon + 1),
+                                    pattern->GetGridGain_dB (lat + 1, lon),
+                                    pattern->GetGridGain_dB (lat + 1, lon + 1) };
+
+              for (uint32_t c = 0; c < 4; ++c)
+                {
+                  if (std::isnan (corners[c]))
+                    {
+                      // Left without candidates, the antenna patterns
+                      // report the undefined gain at query time
+                      defined = false;
+                      break;
+                    }
+
+                  double gain = SatUtils::DbToLinear (corners[c]);
+                  lowestGain[i] = (c == 0) ? gain : std::min (lowestGain[i], gain);
+                  highestGain[i] = (c == 0) ? gain : std::max (highestGain[i], gain);
+                }
+
+              bestLowestGain = std::max (bestLowestGain, lowestGain[i]);
+            }
+
+          if (!defined)
+            {
+              continue;
+            }
+
+          for (uint32_t i = 1; i <= NUMBER_OF_BEAMS; ++i)
+            {
+              if (highestGain[i] * (1.0 + margin) >= bestLowestGain * (1.0 - margin))
+                {
+                  m_cellCandidates.push_back (i);
+                }
+            }
+        }
+    }
+
+  m_cellOffsets.push_back (m_cellCandidates.size ());
+
+  NS_LOG_INFO ("Best beam map computed: " << m_latCells * m_lonCells << " cells, "
+                                          << m_cellCandidates.size () << " candidates");
+}
+
+bool
+SatAntennaGainPatternContainer::LoadBestBeamMap (std::string filePathName, uint64_t checksum) const
+{
+  NS_LOG_FUNCTION (this << filePathName);
+
+  std::ifstream ifs (filePathName.c_str (), std::ifstream::in | std::ifstream::binary);
+
+  if (!ifs.is_open ())
+    {
+      return false;
+    }
+
+  char magic[8];
+  uint32_t version;
+  uint32_t beams;
+  uint32_t latCells;
+  uint32_t lonCells;
+  uint64_t fileChecksum;
+  uint32_t candidateCount;
+  uint32_t reserved;
+
+  ifs.read (magic, sizeof (magic));
+  ifs.read (reinterpret_cast<char*> (&version), sizeof (version));
+  ifs.read (reinterpret_cast<char*> (&beams), sizeof (beams));
+  ifs.read (reinterpret_cast<char*> (&latCells), sizeof (latCells));
+  ifs.read (reinterpret_cast<char*> (&lonCells), sizeof (lonCells));
+  ifs.read (reinterpret_cast<char*> (&fileChecksum), sizeof (fileChecksum));
+  ifs.read (reinterpret_cast<char*> (&candidateCount), sizeof (candidateCount));
+  ifs.read (reinterpret_cast<char*> (&reserved), sizeof (reserved));
+
+  if (!ifs.good ()
+      || std::memcmp (magic, "SNS3BBM", sizeof (magic)) != 0
+      || version != BEST_BEAM_MAP_VERSION
+      || beams != NUMBER_OF_BEAMS
+      || latCells != m_latCells
+      || lonCells != m_lonCells
+      || fileChecksum != checksum)
+    {
+      NS_LOG_INFO ("Best beam map " << filePathName << " does not match the antenna patterns");
+      return false;
+    }
+
+  m_cellOffsets.resize (m_latCells * m_lonCells + 1);
+  m_cellCandidates.resize (candidateCount);
+
+  ifs.read (reinterpret_cast<char*> (m_cellOffsets.data ()), m_cellOffsets.size () * sizeof (uint32_t));
+  ifs.read (reinterpret_cast<char*> (m_cellCandidates.data ()), m_cellCandidates.size () * sizeof (uint16_t));
+
+  if (!ifs.good () || m_cellOffsets.front () != 0 || m_cellOffsets.back () != candidateCount)
+    {
+      NS_LOG_INFO ("Best beam map " << filePathName << " is truncated");
+      return false;
+    }
+
+  for (uint32_t i = 1; i < m_cellOffsets.size (); ++i)
+    {
+      if (m_cellOffsets[i] < m_cellOffsets[i - 1])
+        {
+          NS_LOG_INFO ("Best beam map " << filePathName << " is corrupted");
+          return false;
+        }
+    }
+
+  for (uint32_t i = 0; i < m_cellCandidates.size (); ++i)
+    {
+      if (m_cellCandidates[i] < 1 || m_cellCandidates[i] > NUMBER_OF_BEAMS)
+        {
+          NS_LOG_INFO ("Best beam map " << filePathName << " is corrupted");
+          return false;
+        }
+    }
+
+  NS_LOG_INFO ("Best beam map read from " << filePathName);
+
+  return true;
+}
+
+void
+SatAntennaGainPatternContainer::SaveBestBeamMap (std::string filePathName, uint64_t checksum) const
+{
+  NS_LOG_FUNCTION (this << filePathName);
+
+  // Write to a temporary file first, so that simulations started at the
+  // same time never read a partially written map
+  std::ostringstream tmpName;
+  tmpName << filePathName << "." << getpid ();
+
+  std::ofstream ofs (tmpName.str ().c_str (), std::ofstream::out | std::ofstream::binary);
+
+  if (!ofs.is_open ())
+    {
+      NS_LOG_INFO ("Best beam map could not be stored to " << filePathName);
+      return;
+    }
+
+  const char magic[8] = "SNS3BBM";
+  uint32_t version = BEST_BEAM_MAP_VERSION;
+  uint32_t beams = NUMBER_OF_BEAMS;
+  uint32_t candidateCount = m_cellCandidates.size ();
+  uint32_t reserved = 0;
+
+  ofs.write (magic, sizeof (magic));
+  ofs.write (reinterpret_cast<const char*> (&version), sizeof (version));
+  ofs.write (reinterpret_cast<const char*> (&beams), sizeof (beams));
+  ofs.write (reinterpret_cast<const char*> (&m_latCells), sizeof (m_latCells));
+  ofs.write (reinterpret_cast<const char*> (&m_lonCells), sizeof (m_lonCells));
+  ofs.write (reinterpret_cast<const char*> (&checksum), sizeof (checksum));
+  ofs.write (reinterpret_cast<const char*> (&candidateCount), sizeof (candidateCount));
+  ofs.write (reinterpret_cast<const char*> (&reserved), sizeof (reserved));
+  ofs.write (reinterpret_cast<const char*> (m_cellOffsets.data ()), m_cellOffsets.size () * sizeof (uint32_t));
+  ofs.write (reinterpret_cast<const char*> (m_cellCandidates.data ()), m_cellCandidates.size () * sizeof (uint16_t));
+  ofs.close ();
+
+  if (ofs.fail () || std::rename (tmpName.str ().c_str (), filePathName.c_str ()) != 0)
+    {
+      NS_LOG_INFO ("Best beam map could not be stored to " << filePathName);
+      std::remove (tmpName.str ().c_str ());
+    }
+}
+
+uint64_t
+SatAntennaGainPatternContainer::CalculatePatternChecksum () const
+{
+  NS_LOG_FUNCTION (this);
+
+  const std::vector<double>& latitudes = m_antennaPatternMap.at (1)->GetGridLatitudes ();
+  const std::vector<double>& longitudes = m_antennaPatternMap.at (1)->GetGridLongitudes ();
+
+  uint64_t checksum = SatUtils::CalculateChecksum (reinterpret_cast<const uint8_t*> (latitudes.data ()),
+                                                   latitudes.size () * sizeof (double));
+  checksum = SatUtils::CalculateChecksum (reinterpret_cast<const uint8_t*> (longitudes.data ()),
+                                          longitudes.size () * sizeof (double), checksum);
+
+  for (uint32_t i = 1; i <= NUMBER_OF_BEAMS; ++i)
+    {
+      Ptr<SatAntennaGainPattern> pattern = m_antennaPatternMap.at (i);
+      for (uint32_t lat = 0; lat < latitudes.size (); ++lat)
+        {
+          for (uint32_t lon = 0; lon < longitudes.size (); ++lon)
+            {
+              double gain = pattern->GetGridGain_dB (lat, lon);
+              checksum = SatUtils::CalculateChecksum (reinterpret_cast<const uint8_t*> (&gain), sizeof (gain), checksum);
+            }
+        }
+    }
+
+  return checksum;
+}
+
 uint32_t
 SatAntennaGainPatternContainer::GetNAntennaGainPatterns () const
 {
@@ -36,6 +36,54 @@ namespace ns3 {
  * Each antenna gain pattern is stored in a separate class
  * SatAntennaGainPattern. The best beam may be chosen based on
  * the antenna patterns by using GetBestBeamId for a given position.
+ *
+ * The antenna pattern files are parsed in parallel threads, and the parsed
+ * patterns are stored to a binary cache next to the files. Later runs map
+ * the cache instead of parsing the files, as long as the size and
+ * modification time of every antenna pattern file and the minimum
+ * acceptable antenna gain match the ones stored in the cache. The cache
+ * consists of a header:
+ *   magic "SNS3AGP\0" (8 bytes)
+ *   format version (uint32)
+ *   number of beams (uint32)
+ *   minimum acceptable antenna gain in dB (double)
+ *   FNV-1a 64-bit checksum of the rest of the file (uint64)
+ * followed by one directory entry per beam:
+ *   size of the antenna pattern file (uint64)
+ *   modification time of the antenna pattern file (int64)
+ *   number of latitudes, longitudes and valid positions (uint32 each)
+ *   reserved (uint32)
+ *   min latitude, min longitude, max latitude, max longitude,
+ *   latitude interval and longitude interval (double each)
+ *   offset of the beam data in the file (uint64)
+ * and the beam data: latitudes, longitudes, row-major gains in dB and
+ * {latitude, longitude} of the valid positions (double each). All values
+ * are little-endian.
+ *
+ * To avoid interpolating all the antenna patterns for every best beam
+ * query, a best beam map is built over the grid of the antenna patterns
+ * at the first query. For each grid cell, the map holds the beams which
+ * may give the best gain somewhere inside the cell: a beam whose largest
+ * gain at the cell corners is below the smallest corner gain of another
+ * beam can never win the interpolation. Most cells have a single candidate
+ * which is returned without interpolation, the others are resolved by
+ * interpolating only the candidates. The map is stored next to the antenna
+ * patterns and reused as long as the checksum of the patterns matches.
+ *
+ * The best beam map file consists of a header:
+ *   magic "SNS3BBM\0" (8 bytes)
+ *   format version (uint32)
+ *   number of beams (uint32)
+ *   number of grid cells in latitude (uint32)
+ *   number of grid cells in longitude (uint32)
+ *   FNV-1a 64-bit checksum of the antenna pattern grids (uint64)
+ *   total number of candidates (uint32)
+ *   reserved (uint32)
+ * followed by the offset of the candidates of each cell and the end offset
+ * (uint32 each, cells in latitude major order) and the candidate beam ids
+ * (uint16 each, increasing within a cell). A cell without candidates has
+ * undefined gains and is resolved with the antenna patterns. All values
+ * are little-endian.
  */
 class SatAntennaGainPatternContainer : public Object
 {
@@ -46,6 +94,12 @@ public:
    */
   static TypeId GetTypeId (void);
 
+  /**
+   * \brief Get the type ID of instance
+   * \return the object TypeId
+   */
+  virtual TypeId GetInstanceTypeId (void) const;
+
   /**
    * Default constructor.
    */
@@ -73,7 +127,134 @@ public:
    */
   uint32_t GetBestBeamId (GeoCoordinate coord) const;
 
+  /**
+   * \brief Check whether the antenna patterns were read from the antenna
+   * pattern cache instead of the antenna pattern files
+   * \return true if the patterns were read from the cache
+   */
+  bool IsReadFromPatternCache () const;
+
+  /**
+   * \brief Version of the best beam map file format
+   */
+  static const uint32_t BEST_BEAM_MAP_VERSION = 1;
+
+  /**
+   * \brief Version of the antenna pattern cache file format
+   */
+  static const uint32_t PATTERN_CACHE_VERSION = 1;
+
+  /**
+   * \brief Size of the antenna pattern cache header in bytes
+   */
+  static const uint32_t PATTERN_CACHE_HEADER_SIZE = 32;
+
+  /**
+   * \brief Size of an antenna pattern cache directory entry in bytes
+   */
+  static const uint32_t PATTERN_CACHE_ENTRY_SIZE = 88;
+
 private:
+  /**
+   * \brief Read the antenna pattern files in parallel threads
+   * \param filePathNames Antenna pattern files, one per beam
+   * \param minAcceptableGainDb Minimum gain of the valid positions
+   * \param patterns Antenna pattern data, one per beam
+   */
+  void ReadPatternFiles (const std::vector<std::string>& filePathNames,
+                         double minAcceptableGainDb,
+                         std::vector<SatAntennaGainPattern::PatternData_t>& patterns) const;
+
+  /**
+   * \brief Read the antenna patterns from the cache
+   * \param cachePathName Path and file name of the cache
+   * \param filePathNames Antenna pattern files, one per beam
+   * \param minAcceptableGainDb Minimum gain of the valid positions
+   * \param patterns Antenna pattern data, one per beam
+   * \return true if the cache is up to date and was read
+   */
+  bool LoadPatternCache (std::string cachePathName,
+                         const std::vector<std::string>& filePathNames,
+                         double minAcceptableGainDb,
+                         std::vector<SatAntennaGainPattern::PatternData_t>& patterns) const;
+
+  /**
+   * \brief Verify and parse the antenna pattern cache
+   * \param cache Content of the cache
+   * \param cacheSize Size of the cache in bytes
+   * \param filePathNames Antenna pattern files, one per beam
+   * \param minAcceptableGainDb Minimum gain of the valid positions
+   * \param patterns Antenna pattern data, one per beam
+   * \return true if the cache is up to date
+   */
+  bool ParsePatternCache (const uint8_t* cache, uint64_t cacheSize,
+                          const std::vector<std::string>& filePathNames,
+                          double minAcceptableGainDb,
+                          std::vector<SatAntennaGainPattern::PatternData_t>& patterns) const;
+
+  /**
+   * \brief Write the antenna patterns to the cache
+   * \param cachePathName Path and file name of the cache
+   * \param filePathNames Antenna pattern files, one per beam
+   * \param minAcceptableGainDb Minimum gain of the valid positions
+   * \param patterns Antenna pattern data, one per beam
+   */
+  void SavePatternCache (std::string cachePathName,
+                         const std::vector<std::string>& filePathNames,
+                         double minAcceptableGainDb,
+                         const std::vector<SatAntennaGainPattern::PatternData_t>& patterns) const;
+
+  /**
+   * \brief Get the size and modification time of an antenna pattern file
+   * \param filePathName Path and file name of the antenna pattern
+   * \param size Size of the file in bytes
+   * \param modificationTime Modification time of the file
+   * \return false if the file is not found
+   */
+  static bool GetSourceFileInfo (std::string filePathName, uint64_t& size, int64_t& modificationTime);
+
+  /**
+   * \brief Get the best beam id by interpolating the antenna patterns
+   * of the given beams
+   * \param coord Geo coordinate
+   * \param beamIds Beam ids to check, in increasing order
+   * \param count Number of beam ids
+   * \return best beam id in the specified geo coordinate
+   */
+  uint32_t GetBestBeamIdFromPatterns (GeoCoordinate coord, const uint16_t* beamIds, uint32_t count) const;
+
+  /**
+   * \brief Load the best beam map from file, or compute and store it
+   * if the file is missing or does not match the antenna patterns.
+   */
+  void BuildBestBeamMap () const;
+
+  /**
+   * \brief Compute the best beam map from the antenna patterns
+   */
+  void ComputeBestBeamMap () const;
+
+  /**
+   * \brief Read the best beam map from a file
+   * \param filePathName Path and file name of the best beam map
+   * \param checksum Checksum of the current antenna patterns
+   * \return true if the map was read and matches the antenna patterns
+   */
+  bool LoadBestBeamMap (std::string filePathName, uint64_t checksum) const;
+
+  /**
+   * \brief Write the best beam map to a file
+   * \param filePathName Path and file name of the best beam map
+   * \param checksum Checksum of the current antenna patterns
+   */
+  void SaveBestBeamMap (std::string filePathName, uint64_t checksum) const;
+
+  /**
+   * \brief Calculate the checksum of the antenna pattern grids
+   * \return The checksum
+   */
+  uint64_t CalculatePatternChecksum () const;
+
   /**
    * \brief Definition of number of beams (72-beam reference scenario).
    * Note: to change the reference system this has to be changed
@@ -86,6 +267,77 @@ private:
    */
   std::map< uint32_t, Ptr<SatAntennaGainPattern> > m_antennaPatternMap;
 
+  /**
+   * Directory of the antenna pattern files
+   */
+  std::string m_patternDirectory;
+
+  /**
+   * Flag telling whether the antenna pattern cache is used
+   */
+  bool m_enablePatternCache;
+
+  /**
+   * Name of the antenna pattern cache file in the antenna pattern directory
+   */
+  std::string m_patternCacheFileName;
+
+  /**
+   * Flag telling whether the antenna patterns were read from the cache
+   */
+  bool m_readFromPatternCache;
+
+  /**
+   * Number of threads reading the antenna pattern files
+   */
+  uint32_t m_patternReadingThreads;
+
+  /**
+   * Flag telling whether the best beam map is used
+   */
+  bool m_enableBestBeamMap;
+
+  /**
+   * Name of the best beam map file in the antenna pattern directory
+   */
+  std::string m_bestBeamMapFileName;
+
+  /**
+   * Flag telling whether the best beam map has been built
+   */
+  mutable bool m_bestBeamMapBuilt;
+
+  /**
+   * Flag telling whether the antenna patterns allow using a best beam map
+   */
+  mutable bool m_bestBeamMapValid;
+
+  /**
+   * Number of grid cells in latitude
+   */
+  mutable uint32_t m_latCells;
+
+  /**
+   * Number of grid cells in longitude
+   */
+  mutable uint32_t m_lonCells;
+
+  /**
+   * Offset of the first candidate of each cell in m_cellCandidates,
+   * followed by the total number of candidates
+   */
+  mutable std::vector<uint32_t> m_cellOffsets;
+
+  /**
+   * Candidate beam ids of all cells
+   */
+  mutable std::vector<uint16_t> m_cellCandidates;
+
+  /**
+   * Ids of all the beams, checked for the positions not covered by the map
+   */
+  std::vector<uint16_t> m_allBeamIds;
+
 };
 
 } // namespace ns3
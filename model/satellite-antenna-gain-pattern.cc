@@ -68,29 +68,77 @@ SatAntennaGainPattern::SatAntennaGainPattern ()
   m_maxLat (0.0),
   m_maxLon (0.0),
   m_latInterval (0.0),
-  m_lonInterval (0.0),
-  m_nanStrings ()
+  m_lonInterval (0.0)
 {
   // Do nothing here
 }
 
 SatAntennaGainPattern::SatAntennaGainPattern (std::string filePathName)
-  : m_nanStrings (m_nanStringArray, m_nanStringArray + (sizeof m_nanStringArray / sizeof m_nanStringArray[0]))
 {
   // Attributes are needed already in construction phase:
   // - ConstructSelf call in constructor
   // - GetInstanceTypeId is needed to be implemented
   ObjectBase::ConstructSelf (AttributeConstructionList ());
 
-  ReadAntennaPatternFromFile (filePathName);
+  NS_LOG_FUNCTION (this << filePathName);
+
+  PatternData_t data;
+  ReadAntennaPatternFromFile (filePathName, m_minAcceptableAntennaGainInDb, data);
+  SetPatternData (data);
+
   m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
 }
 
+SatAntennaGainPattern::SatAntennaGainPattern (const PatternData_t& data)
+{
+  ObjectBase::ConstructSelf (AttributeConstructionList ());
+
+  NS_LOG_FUNCTION (this);
+
+  SetPatternData (data);
 
-void SatAntennaGainPattern::ReadAntennaPatternFromFile (std::string filePathName)
+  m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
+}
+
+void
+SatAntennaGainPattern::SetPatternData (const PatternData_t& data)
 {
-  NS_LOG_FUNCTION (this << filePathName);
+  NS_LOG_FUNCTION (this);
+
+  m_antennaPattern = data.gains;
+  m_validPositions = data.validPositions;
+  m_latitudes = data.latitudes;
+  m_longitudes = data.longitudes;
+  m_minLat = data.minLat;
+  m_minLon = data.minLon;
+  m_maxLat = data.maxLat;
+  m_maxLon = data.maxLon;
+  m_latInterval = data.latInterval;
+  m_lonInterval = data.lonInterval;
+}
 
+void
+SatAntennaGainPattern::GetPatternData (PatternData_t& data) const
+{
+  NS_LOG_FUNCTION (this);
+
+  data.gains = m_antennaPattern;
+  data.validPositions = m_validPositions;
+  data.latitudes = m_latitudes;
+  data.longitudes = m_longitudes;
+  data.minLat = m_minLat;
+  data.minLon = m_minLon;
+  data.maxLat = m_maxLat;
+  data.maxLon = m_maxLon;
+  data.latInterval = m_latInterval;
+  data.lonInterval = m_lonInterval;
+}
+
+
+void SatAntennaGainPattern::ReadAntennaPatternFromFile (std::string filePathName,
+                                                        double minAcceptableAntennaGainInDb,
+                                                        PatternData_t& data)
+{
   // READ FROM THE SPECIFIED INPUT FILE
   std::ifstream *ifs = new std::ifstream (filePathName.c_str (), std::ifstream::in);
 
@@ -107,8 +155,21 @@ void SatAntennaGainPattern::ReadAntennaPatternFromFile (std::string filePathName
         }
     }
 
-  // Row vector containing all the gain values for a certain latitude
-  std::vector<double> rowVector;
+  const std::string* nanStringsEnd = m_nanStringArray + (sizeof m_nanStringArray / sizeof m_nanStringArray[0]);
+
+  data.latitudes.clear ();
+  data.longitudes.clear ();
+  data.gains.clear ();
+  data.validPositions.clear ();
+  data.minLat = 0.0;
+  data.minLon = 0.0;
+  data.maxLat = 0.0;
+  data.maxLon = 0.0;
+  data.latInterval = 0.0;
+  data.lonInterval = 0.0;
+
+  // Number of gain values in the current row
+  uint32_t rowSize (0);
 
   // Start conditions
   double lat, lon, gainDouble;
@@ -130,7 +191,7 @@ void SatAntennaGainPattern::ReadAntennaPatternFromFile (std::string filePathName
       // The antenna gain value is read to a string, so that we may check
       // that whether the value is NaN. If not, then the number is just converted
       // to a double.
-      if (find (m_nanStrings.begin (), m_nanStrings.end (), gainString) != m_nanStrings.end ())
+      if (find (m_nanStringArray, nanStringsEnd, gainString) != nanStringsEnd)
         {
           gainDouble = NAN;
         }
@@ -140,78 +201,74 @@ void SatAntennaGainPattern::ReadAntennaPatternFromFile (std::string filePathName
 
           // Add the position to valid positions vector if the gain is
           // above a specified threshold.
-          if ( gainDouble >= m_minAcceptableAntennaGainInDb )
+          if ( gainDouble >= minAcceptableAntennaGainInDb )
             {
-              m_validPositions.push_back (std::make_pair (lat, lon));
+              data.validPositions.push_back (std::make_pair (lat, lon));
             }
         }
 
       // Collect the valid latitude values
-      if (!m_latitudes.empty () )
+      if (!data.latitudes.empty () )
         {
-          if (m_latitudes.back () != lat)
+          if (data.latitudes.back () != lat)
             {
               firstRowDone = true;
-              m_latInterval = lat - m_latitudes.back ();
-              m_latitudes.push_back (lat);
+              data.latInterval = lat - data.latitudes.back ();
+              data.latitudes.push_back (lat);
             }
         }
       else
         {
-          m_latitudes.push_back (lat);
+          data.latitudes.push_back (lat);
         }
 
       // Collect the valid longitude values
-      if (!m_longitudes.empty () )
+      if (!data.longitudes.empty () )
         {
-          if (!firstRowDone && m_longitudes.back () != lon)
+          if (!firstRowDone && data.longitudes.back () != lon)
             {
-              m_lonInterval = lon - m_longitudes.back ();
-              m_longitudes.push_back (lon);
+              data.lonInterval = lon - data.longitudes.back ();
+              data.longitudes.push_back (lon);
             }
         }
       else
         {
-          m_longitudes.push_back (lon);
+          data.longitudes.push_back (lon);
         }
 
       // If this is the first gain entry
-      if (rowVector.empty ())
+      if (data.gains.empty ())
         {
-          m_minLat = lat;
-          m_minLon = lon;
-          rowVector.push_back (gainDouble);
+          data.minLat = lat;
+          data.minLon = lon;
+          rowSize = 1;
         }
       // We are still in the same row (= latitude)
-      else if (lat == m_maxLat)
+      else if (lat == data.maxLat)
         {
-          rowVector.push_back (gainDouble);
+          rowSize++;
         }
       // Latitude changed
-      // - Store the vector
-      // - Clean-up
+      // - Check the stored row
       // - Start from another row
       else
         {
-          m_antennaPattern.push_back (rowVector);
-          rowVector.clear ();
-          rowVector.push_back (gainDouble);
+          NS_ASSERT ( rowSize == data.longitudes.size ());
+          rowSize = 1;
         }
+      data.gains.push_back (gainDouble);
 
       // Update the maximum values
-      m_maxLat = lat;
-      m_maxLon = lon;
+      data.maxLat = lat;
+      data.maxLon = lon;
 
       // get next row
       *ifs >> lat >> lon >> gainString;
     }
 
-  // At this point, the last row should not be stored, since the storing
-  // happens every time the row changes. I.e. the last row is stored here!
-  NS_ASSERT ( rowVector.size () == m_longitudes.size ());
-
-  m_antennaPattern.push_back (rowVector);
-  rowVector.clear ();
+  // At this point, the last row has not been checked, since the checking
+  // happens every time the row changes. I.e. the last row is checked here!
+  NS_ASSERT ( rowSize == data.longitudes.size ());
 
   ifs->close ();
   delete ifs;
@@ -290,26 +347,18 @@ double SatAntennaGainPattern::GetAntennaGain_lin (GeoCoordinate coord) const
   double latitude = coord.GetLatitude ();
   double longitude = coord.GetLongitude ();
 
-  // Given {latitude, longitude} has to be inside the min/max latitude/longitude values
-  if (m_minLat > latitude
-      || latitude > m_maxLat
-      || m_minLon > longitude
-      || longitude > m_maxLon)
-    {
-      NS_FATAL_ERROR ("Given latitude and longitude out of range!");
-    }
-
   // Calculate the minimum grid point {minLatIndex, minLonIndex} for the given {latitude, longitude} point
-  uint32_t minLatIndex = (uint32_t)(std::floor (std::abs (latitude - m_minLat) / m_latInterval));
-  uint32_t minLonIndex = (uint32_t)(std::floor (std::abs (longitude - m_minLon) / m_lonInterval));
+  uint32_t minLatIndex;
+  uint32_t minLonIndex;
+  GetGridCell (coord, minLatIndex, minLonIndex);
 
   // All the values within the grid box has to be valid! If UT is placed (or
   // is moving outside) the valid simulation area, the simulation will crash
   // to a fatal error.
-  if (std::isnan (m_antennaPattern[minLatIndex][minLonIndex])
-      || std::isnan (m_antennaPattern[minLatIndex][minLonIndex + 1])
-      || std::isnan (m_antennaPattern[minLatIndex + 1][minLonIndex])
-      || std::isnan (m_antennaPattern[minLatIndex + 1][minLonIndex + 1]))
+  if (std::isnan (GetGridGain_dB (minLatIndex, minLonIndex))
+      || std::isnan (GetGridGain_dB (minLatIndex, minLonIndex + 1))
+      || std::isnan (GetGridGain_dB (minLatIndex + 1, minLonIndex))
+      || std::isnan (GetGridGain_dB (minLatIndex + 1, minLonIndex + 1)))
     {
       NS_FATAL_ERROR (this << ", some value(s) of the interpolated grid point(s) is/are NAN!");
     }
@@ -326,10 +375,10 @@ double SatAntennaGainPattern::GetAntennaGain_lin (GeoCoordinate coord) const
   double lowerLonShare = (longitude - m_longitudes[minLonIndex]) / m_lonInterval;
 
   // Change the gains to linear values , because the interpolation is done in linear domain.
-  double G11 = SatUtils::DbToLinear ( m_antennaPattern[minLatIndex][minLonIndex] );
-  double G12 = SatUtils::DbToLinear ( m_antennaPattern[minLatIndex][minLonIndex + 1] );
-  double G21 = SatUtils::DbToLinear ( m_antennaPattern[minLatIndex + 1][minLonIndex] );
-  double G22 = SatUtils::DbToLinear ( m_antennaPattern[minLatIndex + 1][minLonIndex + 1] );
+  double G11 = SatUtils::DbToLinear ( GetGridGain_dB (minLatIndex, minLonIndex) );
+  double G12 = SatUtils::DbToLinear ( GetGridGain_dB (minLatIndex, minLonIndex + 1) );
+  double G21 = SatUtils::DbToLinear ( GetGridGain_dB (minLatIndex + 1, minLonIndex) );
+  double G22 = SatUtils::DbToLinear ( GetGridGain_dB (minLatIndex + 1, minLonIndex + 1) );
 
   // Longitude direction with latitude minLatIndex
   double valLatLower = upperLonShare * G11 + lowerLonShare * G12;
@@ -350,10 +399,10 @@ double SatAntennaGainPattern::GetAntennaGain_lin (GeoCoordinate coord) const
       ", y1 = " << m_latitudes[minLatIndex] <<
       ", x2 = " << m_longitudes[minLonIndex+1] <<
       ", y2 = " << m_latitudes[minLatIndex+1] <<
-      ", G(x1, y1) = " << m_antennaPattern[minLatIndex][minLonIndex] <<
-      ", G(x1, y2) = " << m_antennaPattern[minLatIndex+1][minLonIndex] <<
-      ", G(x2, y1) = " << m_antennaPattern[minLatIndex][minLonIndex+1] <<
-      ", G(x2, y2) = " << m_antennaPattern[minLatIndex+1][minLonIndex+1] <<
+      ", G(x1, y1) = " << GetGridGain_dB (minLatIndex, minLonIndex) <<
+      ", G(x1, y2) = " << GetGridGain_dB (minLatIndex+1, minLonIndex) <<
+      ", G(x2, y1) = " << GetGridGain_dB (minLatIndex, minLonIndex+1) <<
+      ", G(x2, y2) = " << GetGridGain_dB (minLatIndex+1, minLonIndex+1) <<
       ", x = " << longitude <<
       ", y = " << latitude <<
       ", interpolated gain: " << gain << std::endl;
@@ -361,6 +410,45 @@ double SatAntennaGainPattern::GetAntennaGain_lin (GeoCoordinate coord) const
   return gain;
 }
 
+void
+SatAntennaGainPattern::GetGridCell (GeoCoordinate coord, uint32_t& latIndex, uint32_t& lonIndex) const
+{
+  NS_LOG_FUNCTION (this << coord.GetLatitude () << coord.GetLongitude ());
+
+  double latitude = coord.GetLatitude ();
+  double longitude = coord.GetLongitude ();
+
+  // Given {latitude, longitude} has to be inside the min/max latitude/longitude values
+  if (m_minLat > latitude
+      || latitude > m_maxLat
+      || m_minLon > longitude
+      || longitude > m_maxLon)
+    {
+      NS_FATAL_ERROR ("Given latitude and longitude out of range!");
+    }
+
+  latIndex = (uint32_t)(std::floor (std::abs (latitude - m_minLat) / m_latInterval));
+  lonIndex = (uint32_t)(std::floor (std::abs (longitude - m_minLon) / m_lonInterval));
+}
+
+double
+SatAntennaGainPattern::GetGridGain_dB (uint32_t latIndex, uint32_t lonIndex) const
+{
+  return m_antennaPattern[latIndex * m_longitudes.size () + lonIndex];
+}
+
+const std::vector<double>&
+SatAntennaGainPattern::GetGridLatitudes () const
+{
+  return m_latitudes;
+}
+
+const std::vector<double>&
+SatAntennaGainPattern::GetGridLongitudes () const
+{
+  return m_longitudes;
+}
+
 
 
 } // namespace ns3
@@ -49,6 +49,23 @@ namespace ns3 {
 class SatAntennaGainPattern : public Object
 {
 public:
+  /**
+   * \brief Antenna gain pattern data as read from an antenna pattern file
+   */
+  typedef struct
+  {
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+    std::vector<double> gains;      // row-major, one row per latitude
+    std::vector< std::pair<double, double> > validPositions;
+    double minLat;
+    double minLon;
+    double maxLat;
+    double maxLon;
+    double latInterval;
+    double lonInterval;
+  } PatternData_t;
+
   /**
    * \brief Get the type ID
    * \return the object TypeId
@@ -71,6 +88,12 @@ public:
    * \param filePathName
    */
   SatAntennaGainPattern (std::string filePathName);
+
+  /**
+   * Constructor with already read antenna pattern data.
+   * \param data Antenna pattern data
+   */
+  SatAntennaGainPattern (const PatternData_t& data);
   ~SatAntennaGainPattern ()
   {
   }
@@ -94,19 +117,64 @@ public:
    */
   bool IsValidPosition (GeoCoordinate coord, TracedCallback<double> cb) const;
 
-private:
   /**
-   * \brief Read the antenna gain pattern from a file
+   * \brief Get the grid cell containing a {latitude, longitude} point, i.e.
+   * the indices of the lower left grid point used in the interpolation.
+   * \param coord The position
+   * \param latIndex Latitude index of the grid cell
+   * \param lonIndex Longitude index of the grid cell
+   */
+  void GetGridCell (GeoCoordinate coord, uint32_t& latIndex, uint32_t& lonIndex) const;
+
+  /**
+   * \brief Get the antenna gain value of a grid point
+   * \param latIndex Latitude index of the grid point
+   * \param lonIndex Longitude index of the grid point
+   * \return The gain value in dB, NaN if not defined
+   */
+  double GetGridGain_dB (uint32_t latIndex, uint32_t lonIndex) const;
+
+  /**
+   * \brief Get the latitudes of the grid
+   * \return The latitudes of the grid in degrees
+   */
+  const std::vector<double>& GetGridLatitudes () const;
+
+  /**
+   * \brief Get the longitudes of the grid
+   * \return The longitudes of the grid in degrees
+   */
+  const std::vector<double>& GetGridLongitudes () const;
+
+  /**
+   * \brief Get the antenna pattern data
+   * \param data Antenna pattern data to fill
+   */
+  void GetPatternData (PatternData_t& data) const;
+
+  /**
+   * \brief Read the antenna gain pattern from a file. Does not use any
+   * simulator state, so patterns may be read in parallel threads.
    * \param filePathName Path and file name of the antenna pattern file
+   * \param minAcceptableAntennaGainInDb Minimum gain of the valid positions
+   * \param data Antenna pattern data to fill
+   */
+  static void ReadAntennaPatternFromFile (std::string filePathName,
+                                         double minAcceptableAntennaGainInDb,
+                                         PatternData_t& data);
+
+private:
+  /**
+   * \brief Take the antenna pattern data into use
+   * \param data Antenna pattern data
    */
-  void ReadAntennaPatternFromFile (std::string filePathName);
+  void SetPatternData (const PatternData_t& data);
 
   /**
-   * Container for the antenna pattern from one spot-beam
-   * - Outer vector holds gain values for all latitudes
-   * - Inner vector holds gain values for all longitudes for a certain latitude
+   * Container for the antenna pattern from one spot-beam. Gain values
+   * of all longitudes for a certain latitude are contiguous, latitude by latitude.
    */
-  std::vector< std::vector <double> > m_antennaPattern;
+  std::vector<double> m_antennaPattern;
 
   /**
    * Container for valid positions
@@ -170,7 +238,6 @@ private:
    * Valid Not-a-Number (NaN) strings
    */
   static const std::string m_nanStringArray[4];
-  std::vector<std::string> m_nanStrings;
 };
 
 
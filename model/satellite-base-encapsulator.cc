@@ -79,6 +79,7 @@ SatBaseEncapsulator::DoDispose ()
     }
   m_rxCallback.Nullify ();
   m_ctrlCallback.Nullify ();
+  m_txBufferCallback.Nullify ();
 }
 
 void
@@ -228,6 +229,14 @@ SatBaseEncapsulator::SetCtrlMsgCallback (SatBaseEncapsulator::SendCtrlCallback c
   m_ctrlCallback = cb;
 }
 
+void
+SatBaseEncapsulator::SetTxBufferCallback (SatBaseEncapsulator::TxBufferCallback cb)
+{
+  NS_LOG_FUNCTION (this << &cb);
+
+  m_txBufferCallback = cb;
+}
+
 void
 SatBaseEncapsulator::SetQueue (Ptr<SatQueue> queue)
 {
@@ -96,6 +96,12 @@ public:
    */
   typedef Callback<bool, Ptr<SatControlMessage>, const Address& > SendCtrlCallback;
 
+  /**
+   * Callback to notify that data became buffered for transmission
+   * without a new PDU being enqueued (e.g. ARQ retransmission).
+   */
+  typedef Callback<void> TxBufferCallback;
+
   /**
    * Set the used queue from outside
    * \param queue Transmission queue
@@ -120,6 +126,12 @@ public:
    */
   void SetCtrlMsgCallback (SatBaseEncapsulator::SendCtrlCallback cb);
 
+  /**
+   * \param cb callback to invoke when data becomes buffered for
+   *        transmission outside of EnquePdu.
+   */
+  void SetTxBufferCallback (SatBaseEncapsulator::TxBufferCallback cb);
+
   /**
    * Enqueue a packet to txBuffer.
    * \param p To be buffered packet
@@ -200,6 +212,11 @@ protected:
   */
   SendCtrlCallback m_ctrlCallback;
 
+  /**
+   * Callback to notify about data buffered outside of EnquePdu.
+   */
+  TxBufferCallback m_txBufferCallback;
+
 };
 
 
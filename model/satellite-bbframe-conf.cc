@@ -152,6 +152,7 @@ SatBbFrameConf::SatBbFrameConf ()
   m_shortFramePayloadInSlots (),
   m_normalFramePayloadInSlots (),
   m_waveforms (),
+  m_modcodTables (),
   m_bbFrameUsageMode (SatEnums::NORMAL_FRAMES),
   m_mostRobustShortFrameModcod (SatEnums::SAT_NONVALID_MODCOD),
   m_mostRobustNormalFrameModcod (SatEnums::SAT_NONVALID_MODCOD),
@@ -182,6 +183,7 @@ SatBbFrameConf::SatBbFrameConf (double symbolRate, SatEnums::DvbVersion_t dvbVer
   m_shortFramePayloadInSlots (),
   m_normalFramePayloadInSlots (),
   m_waveforms (),
+  m_modcodTables (),
   m_bbFrameUsageMode (SatEnums::NORMAL_FRAMES),
   m_mostRobustShortFrameModcod (SatEnums::SAT_NONVALID_MODCOD),
   m_mostRobustNormalFrameModcod (SatEnums::SAT_NONVALID_MODCOD),
@@ -333,6 +335,8 @@ SatBbFrameConf::SatBbFrameConf (double symbolRate, SatEnums::DvbVersion_t dvbVer
       // currently is assumed that the most robust MODCODs are same for both short and normal frames
       NS_FATAL_ERROR ("The most robust MODCODs are different for short and normal frames!!!");
     }
+
+  UpdateModcodTables ();
 }
 
 TypeId
@@ -456,6 +460,25 @@ SatBbFrameConf::InitializeCNoRequirements ( Ptr<SatLinkResultsFwd> linkResults )
       */
       it->second->SetCNoRequirement (SatUtils::DbToLinear (esnoRequirementDb) * m_symbolRate);
     }
+
+  UpdateModcodTables ();
+}
+
+void
+SatBbFrameConf::UpdateModcodTables ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_modcodTables.clear ();
+  m_modcodTables.resize (SatEnums::DUMMY_FRAME + 1);
+
+  // Add the MODCODs in the order of the best spectral efficiency
+  for ( waveformMap_t::const_reverse_iterator rit = m_waveforms.rbegin ();
+        rit != m_waveforms.rend ();
+        ++rit )
+    {
+      m_modcodTables[rit->second->GetBbFrameType ()].Add (rit->second->GetCNoRequirement (), rit->second->GetModcod ());
+    }
 }
 
 void
@@ -637,29 +660,46 @@ SatBbFrameConf::GetBestModcod (double cNo, SatEnums::SatBbFrameType_t frameType)
   NS_LOG_FUNCTION (this << frameType);
 
   // If ACM is disabled, return the default MODCOD
-  if (!m_acmEnabled)
+  if (!m_acmEnabled || (uint32_t) frameType >= m_modcodTables.size ())
     {
       return m_defaultModCod;
     }
 
   // Return the waveform with best spectral efficiency
-  for ( waveformMap_t::const_reverse_iterator rit = m_waveforms.rbegin ();
-        rit != m_waveforms.rend ();
-        ++rit )
+  const SatAcmThresholdTable & table = m_modcodTables[frameType];
+  uint32_t index = table.Find (cNo);
+
+  if (index < table.GetSize ())
     {
-      if (rit->second->GetBbFrameType () == frameType)
-        {
-          double cnoReq = rit->second->GetCNoRequirement ();
-          // The first waveform over the threshold
-          if (cnoReq <= cNo)
-            {
-              return rit->second->GetModcod ();
-            }
-        }
+      return (SatEnums::SatModcod_t) table.GetId (index);
     }
+
   return m_defaultModCod;
 }
 
+void
+SatBbFrameConf::GetBestModcods (const std::vector<double> & cNos, SatEnums::SatBbFrameType_t frameType, std::vector<SatEnums::SatModcod_t> & modcods) const
+{
+  NS_LOG_FUNCTION (this << cNos.size () << frameType);
+
+  modcods.resize (cNos.size ());
+
+  // If ACM is disabled, return the default MODCOD
+  if (!m_acmEnabled || (uint32_t) frameType >= m_modcodTables.size ())
+    {
+      std::fill (modcods.begin (), modcods.end (), m_defaultModCod);
+      return;
+    }
+
+  const SatAcmThresholdTable & table = m_modcodTables[frameType];
+
+  for (uint32_t i = 0; i < cNos.size (); ++i)
+    {
+      uint32_t index = table.Find (cNos[i]);
+      modcods[i] = (index < table.GetSize ()) ? (SatEnums::SatModcod_t) table.GetId (index) : m_defaultModCod;
+    }
+}
+
 SatEnums::SatModcod_t
 SatBbFrameConf::GetMostRobustModcod (SatEnums::SatBbFrameType_t frameType) const
 {
@@ -22,12 +22,14 @@
 #define SATELLITE_BBFRAME_CONF_H
 
 #include <map>
+#include <vector>
 #include <ns3/ptr.h>
 #include <ns3/object.h>
 #include <ns3/simple-ref-count.h>
 #include <ns3/nstime.h>
 #include <ns3/satellite-enums.h>
 #include <ns3/satellite-link-results.h>
+#include <ns3/satellite-acm-threshold-table.h>
 
 namespace ns3 {
 
@@ -256,6 +258,14 @@ public:
    */
   SatEnums::SatModcod_t GetBestModcod (double cNo, SatEnums::SatBbFrameType_t frameType) const;
 
+  /**
+   * \brief Get the best MODCODs for a set of C/No values with a given BB frame type.
+   * \param cNos C/No values of the UTs to be scheduled
+   * \param frameType Used BBFrame type (short OR normal)
+   * \param modcods The best MODCOD for each C/No, in the same order
+   */
+  void GetBestModcods (const std::vector<double> & cNos, SatEnums::SatBbFrameType_t frameType, std::vector<SatEnums::SatModcod_t> & modcods) const;
+
   /**
    * Get the default MODCOD for short DVB-S2X frames
    * \return SatModcod_t The default MODCOD for short DVB-S2X frames
@@ -317,6 +327,12 @@ private:
    */
   void GetModCodsList ();
 
+  /**
+   * \brief Build the MODCOD selection tables of the frame types from the
+   * C/No requirements of the waveforms.
+   */
+  void UpdateModcodTables ();
+
   /**
    * Symbol rate in baud
    */
@@ -417,6 +433,11 @@ private:
    */
   waveformMap_t m_waveforms;
 
+  /**
+   * MODCOD selection tables indexed by the BB frame type
+   */
+  std::vector<SatAcmThresholdTable> m_modcodTables;
+
   /**
    * BBFrame usage mode.
    */
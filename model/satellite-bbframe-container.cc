@@ -21,6 +21,7 @@
 #include <algorithm>
 #include "ns3/log.h"
 #include "ns3/enum.h"
+#include "ns3/uinteger.h"
 #include "satellite-utils.h"
 #include "satellite-const-variables.h"
 #include "satellite-bbframe-container.h"
@@ -33,7 +34,10 @@ NS_OBJECT_ENSURE_REGISTERED (SatBbFrameContainer);
 
 SatBbFrameContainer::SatBbFrameContainer ()
   : m_totalDuration (Seconds (0)),
-  m_defaultBbFrameType (SatEnums::NORMAL_FRAME)
+  m_defaultBbFrameType (SatEnums::NORMAL_FRAME),
+  m_queueSelectionPolicy (SatBbFrameContainer::RANDOM_QUEUE),
+  m_queuesDuration (Seconds (0)),
+  m_lastModcodServed (SatEnums::SAT_NONVALID_MODCOD)
 {
   NS_LOG_FUNCTION (this);
   NS_FATAL_ERROR ("Default constructor of SatBbFrameContainer not supported.");
@@ -42,10 +46,16 @@ SatBbFrameContainer::SatBbFrameContainer ()
 SatBbFrameContainer::SatBbFrameContainer (std::vector<SatEnums::SatModcod_t>& modcodsInUse, Ptr<SatBbFrameConf> conf)
   : m_totalDuration (Seconds (0)),
   m_bbFrameConf (conf),
-  m_maxSymbolRate (conf->GetSymbolRate ())
+  m_maxSymbolRate (conf->GetSymbolRate ()),
+  m_queueSelectionPolicy (SatBbFrameContainer::RANDOM_QUEUE),
+  m_queuesDuration (Seconds (0)),
+  m_lastModcodServed (SatEnums::SAT_NONVALID_MODCOD)
 {
   NS_LOG_FUNCTION (this);
 
+  // Random variable used in the MODCOD queue selection
+  m_random = CreateObject<UniformRandomVariable> ();
+
   for (std::vector<SatEnums::SatModcod_t>::const_iterator it = modcodsInUse.begin (); it != modcodsInUse.end (); it++)
     {
       std::pair<FrameContainer_t::iterator, bool> result = m_container.insert (std::make_pair (*it, std::deque<Ptr<SatBbFrame> > ()) );
@@ -54,6 +64,8 @@ SatBbFrameContainer::SatBbFrameContainer (std::vector<SatEnums::SatModcod_t>& mo
         {
           NS_FATAL_ERROR ("Queue for MODCOD: " << *it << " already exists!!!");
         }
+
+      m_queueDurations.insert (std::make_pair (*it, Seconds (0)));
     }
 
   m_defaultBbFrameType = SatEnums::NORMAL_FRAME;
@@ -82,6 +94,31 @@ SatBbFrameContainer::GetTypeId (void)
                      "Trace for merged BB Frames.",
                      MakeTraceSourceAccessor (&SatBbFrameContainer::m_bbFrameMergeTrace),
                      "ns3::SatBbFrame::BbFrameMergeCallback")
+    .AddAttribute ("QueueSelectionPolicy",
+                   "Policy for selecting the MODCOD queue from which the next BB frame is sent.",
+                   EnumValue (SatBbFrameContainer::RANDOM_QUEUE),
+                   MakeEnumAccessor (&SatBbFrameContainer::m_queueSelectionPolicy),
+                   MakeEnumChecker (SatBbFrameContainer::RANDOM_QUEUE, "Random",
+                                    SatBbFrameContainer::ROUND_ROBIN_QUEUE, "RoundRobin",
+                                    SatBbFrameContainer::DURATION_WEIGHTED_QUEUE, "DurationWeighted"))
+    .AddAttribute ("BbFramePoolAllocations",
+                   "Number of BB frames allocated from the BB frame pool.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&SatBbFrameContainer::GetNBbFramePoolAllocations),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("BbFramePoolHeapAllocations",
+                   "Number of BB frame pool allocations which needed new memory from the heap.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&SatBbFrameContainer::GetNBbFramePoolHeapAllocations),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("BbFramePoolInUse",
+                   "Number of pooled BB frames in use.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&SatBbFrameContainer::GetNBbFramePoolInUse),
+                   MakeUintegerChecker<uint64_t> ())
   ;
   return tid;
 }
@@ -186,7 +223,9 @@ SatBbFrameContainer::AddData (uint32_t priorityClass, SatEnums::SatModcod_t modc
       else if ( ( m_bbFrameConf->GetBbFrameUsageMode () == SatEnums::SHORT_AND_NORMAL_FRAMES )
                 && ( m_container.at (modcod).back ()->GetFrameType () == SatEnums::SHORT_FRAME ) )
         {
-          m_totalDuration += m_container.at (modcod).back ()->Extend (m_bbFrameConf);
+          Time durationIncrease = m_container.at (modcod).back ()->Extend (m_bbFrameConf);
+          m_totalDuration += durationIncrease;
+          ChangeQueueDuration (modcod, durationIncrease);
         }
       m_container.at (modcod).back ()->AddPayload (data);
 
@@ -214,6 +253,21 @@ SatBbFrameContainer::GetTotalDuration () const
   return m_totalDuration;
 }
 
+Time
+SatBbFrameContainer::GetQueueDuration (SatEnums::SatModcod_t modcod) const
+{
+  return m_queueDurations.at (modcod);
+}
+
+int64_t
+SatBbFrameContainer::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  m_random->SetStream (stream);
+  return 1;
+}
+
 uint32_t
 SatBbFrameContainer::GetFrameSymbols (SatEnums::SatModcod_t modcod)
 {
@@ -243,26 +297,16 @@ SatBbFrameContainer::GetNextFrame ()
       m_ctrlContainer.pop_front ();
       m_totalDuration -= nextFrame->GetDuration ();
     }
-  else
+  else if ( m_nonEmptyModcods.empty () == false )
     {
-      std::vector< std::deque<Ptr<SatBbFrame> >* > nonEmptyQueues;
-
-      for (FrameContainer_t::iterator it = m_container.begin (); it != m_container.end (); ++it )
-        {
-          if ( (*it).second.empty () == false )
-            {
-              nonEmptyQueues.push_back (&it->second);
-            }
-        }
+      SatEnums::SatModcod_t modcod = SelectModcodQueue ();
 
-      if ( nonEmptyQueues.empty () == false )
-        {
-          std::random_shuffle ( nonEmptyQueues.begin (), nonEmptyQueues.end ());
+      nextFrame = m_container.at (modcod).front ();
+      m_container.at (modcod).pop_front ();
+      m_totalDuration -= nextFrame->GetDuration ();
+      ChangeQueueDuration (modcod, -nextFrame->GetDuration ());
 
-          nextFrame = (*nonEmptyQueues.begin ())->front ();
-          (*nonEmptyQueues.begin ())->pop_front ();
-          m_totalDuration -= nextFrame->GetDuration ();
-        }
+      UpdateNonEmptyModcods (modcod);
     }
 
   return nextFrame;
@@ -280,6 +324,8 @@ SatBbFrameContainer::CreateFrameToTail (uint32_t priorityClass, SatEnums::SatMod
       if ( priorityClass > 0)
         {
           m_container.at (modcod).push_back (frame);
+          ChangeQueueDuration (modcod, frame->GetDuration ());
+          UpdateNonEmptyModcods (modcod);
         }
       else
         {
@@ -371,7 +417,9 @@ SatBbFrameContainer::MergeBbFrames (double carrierBandwidthInHz)
                       if ( frameToMerge->MergeWithFrame (itFromMerge->second.back (), m_bbFrameMergeTrace) )
                         {
                           m_totalDuration -= itFromMerge->second.back ()->GetDuration ();
+                          ChangeQueueDuration (itFromMerge->first, -itFromMerge->second.back ()->GetDuration ());
                           itFromMerge->second.pop_back ();
+                          UpdateNonEmptyModcods (itFromMerge->first);
                         }
                     }
                 }
@@ -388,7 +436,9 @@ SatBbFrameContainer::MergeBbFrames (double carrierBandwidthInHz)
         {
           if ( it->second.empty () == false)
             {
-              m_totalDuration -= it->second.back ()->Shrink (m_bbFrameConf);
+              Time durationDecrease = it->second.back ()->Shrink (m_bbFrameConf);
+              m_totalDuration -= durationDecrease;
+              ChangeQueueDuration (it->first, -durationDecrease);
             }
         }
 
@@ -399,5 +449,114 @@ SatBbFrameContainer::MergeBbFrames (double carrierBandwidthInHz)
     }
 }
 
+void
+SatBbFrameContainer::ChangeQueueDuration (SatEnums::SatModcod_t modcod, Time change)
+{
+  NS_LOG_FUNCTION (this << modcod << change);
+
+  m_queueDurations.at (modcod) += change;
+  m_queuesDuration += change;
+}
+
+void
+SatBbFrameContainer::UpdateNonEmptyModcods (SatEnums::SatModcod_t modcod)
+{
+  NS_LOG_FUNCTION (this << modcod);
+
+  std::vector<SatEnums::SatModcod_t>::iterator it = std::lower_bound (m_nonEmptyModcods.begin (), m_nonEmptyModcods.end (), modcod);
+  bool listed = ( it != m_nonEmptyModcods.end () && *it == modcod );
+
+  if ( m_container.at (modcod).empty () )
+    {
+      if ( listed )
+        {
+          m_nonEmptyModcods.erase (it);
+        }
+    }
+  else if ( listed == false )
+    {
+      m_nonEmptyModcods.insert (it, modcod);
+    }
+}
+
+SatEnums::SatModcod_t
+SatBbFrameContainer::SelectModcodQueue ()
+{
+  NS_LOG_FUNCTION (this);
+
+  uint32_t index = 0;
+
+  switch (m_queueSelectionPolicy)
+    {
+    case SatBbFrameContainer::RANDOM_QUEUE:
+      {
+        index = m_random->GetInteger (0, m_nonEmptyModcods.size () - 1);
+        break;
+      }
+    case SatBbFrameContainer::ROUND_ROBIN_QUEUE:
+      {
+        // Serve the next non-empty MODCOD after the one served last, wrapping around
+        index = std::upper_bound (m_nonEmptyModcods.begin (), m_nonEmptyModcods.end (), m_lastModcodServed)
+          - m_nonEmptyModcods.begin ();
+
+        if ( index == m_nonEmptyModcods.size () )
+          {
+            index = 0;
+          }
+        break;
+      }
+    case SatBbFrameContainer::DURATION_WEIGHTED_QUEUE:
+      {
+        // Empty queues have zero duration, so the total of all the queues
+        // is the total of the non-empty ones
+        double draw = m_random->GetValue (0.0, m_queuesDuration.GetSeconds ());
+
+        for (index = 0; index < m_nonEmptyModcods.size () - 1; ++index)
+          {
+            draw -= m_queueDurations.at (m_nonEmptyModcods[index]).GetSeconds ();
+
+            if ( draw < 0.0 )
+              {
+                break;
+              }
+          }
+        break;
+      }
+    default:
+      {
+        NS_FATAL_ERROR ("Unsupported queue selection policy: " << m_queueSelectionPolicy);
+        break;
+      }
+    }
+
+  m_lastModcodServed = m_nonEmptyModcods[index];
+
+  return m_lastModcodServed;
+}
+
+uint64_t
+SatBbFrameContainer::GetNBbFramePoolAllocations () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return SatBbFrame::GetPool ().GetNAllocations ();
+}
+
+uint64_t
+SatBbFrameContainer::GetNBbFramePoolHeapAllocations () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return SatBbFrame::GetPool ().GetNHeapAllocations ();
+}
+
+uint64_t
+SatBbFrameContainer::GetNBbFramePoolInUse () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return SatBbFrame::GetPool ().GetNInUse ();
+}
+
 
 } // namespace ns3
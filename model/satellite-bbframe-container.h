@@ -25,6 +25,7 @@
 #include <vector>
 #include <deque>
 #include "ns3/simple-ref-count.h"
+#include "ns3/random-variable-stream.h"
 #include "satellite-bbframe.h"
 #include "satellite-enums.h"
 
@@ -41,11 +42,23 @@ namespace ns3 {
  *
  * For control messages (priority class 0) is used only one queue with most robust MODCOD.
  *
+ * The MODCOD queue served next is selected among the non-empty MODCOD queues according
+ * to the queue selection policy.
  *
  */
 class SatBbFrameContainer :  public Object
 {
 public:
+  /**
+   * Policies for selecting the MODCOD queue to serve next
+   */
+  typedef enum
+  {
+    RANDOM_QUEUE,             //!< RANDOM_QUEUE
+    ROUND_ROBIN_QUEUE,        //!< ROUND_ROBIN_QUEUE
+    DURATION_WEIGHTED_QUEUE   //!< DURATION_WEIGHTED_QUEUE
+  } QueueSelectionPolicy_t;
+
   /**
    * \brief Get the type ID
    * \return the object TypeId
@@ -115,7 +128,8 @@ public:
   SatEnums::SatModcod_t GetModcod (uint32_t priorityClass, double cno);
 
   /**
-   * Get next frame from container to transmit.
+   * Get next frame from container to transmit. The control frames are served
+   * first, then a MODCOD queue is selected according to the queue selection policy.
    * \return BB Frame
    */
   Ptr<SatBbFrame> GetNextFrame ();
@@ -128,6 +142,21 @@ public:
    */
   Time GetTotalDuration () const;
 
+  /**
+   * Get total transmission duration of the frames in the queue of a MODCOD.
+   * \param modcod MODCOD of the queue
+   * \return Total transmission duration of the frames in the queue.
+   */
+  Time GetQueueDuration (SatEnums::SatModcod_t modcod) const;
+
+  /**
+   * Assign a fixed random variable stream number to the random variable
+   * used in the MODCOD queue selection.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
   /**
    * Get the total number of symbols, incuding headers, when creating a new BBFrame.
    *
@@ -158,6 +187,37 @@ private:
   SatEnums::SatBbFrameType_t    m_defaultBbFrameType;
   uint32_t                      m_maxSymbolRate;
 
+  /**
+   * Policy for selecting the MODCOD queue to serve next
+   */
+  QueueSelectionPolicy_t        m_queueSelectionPolicy;
+
+  /**
+   * Random variable used in the MODCOD queue selection
+   */
+  Ptr<UniformRandomVariable>    m_random;
+
+  /**
+   * MODCODs of the non-empty MODCOD queues in ascending order
+   */
+  std::vector<SatEnums::SatModcod_t> m_nonEmptyModcods;
+
+  /**
+   * Total transmission duration of the frames in each MODCOD queue
+   */
+  std::map<SatEnums::SatModcod_t, Time> m_queueDurations;
+
+  /**
+   * Total transmission duration of the frames in all the MODCOD queues,
+   * i.e. the sum of m_queueDurations
+   */
+  Time                          m_queuesDuration;
+
+  /**
+   * MODCOD of the queue served last by the round robin policy
+   */
+  SatEnums::SatModcod_t         m_lastModcodServed;
+
   /**
    * Trace for merged BB frames.
    * \param BB frame merge to
@@ -173,6 +233,49 @@ private:
    * \param modcod MODCOD for created frame
    */
   void CreateFrameToTail (uint32_t priorityClass, SatEnums::SatModcod_t modcod);
+
+  /**
+   * Change the transmission duration of a MODCOD queue and the total
+   * duration of all the MODCOD queues.
+   *
+   * \param modcod MODCOD of the queue
+   * \param change Change of the duration
+   */
+  void ChangeQueueDuration (SatEnums::SatModcod_t modcod, Time change);
+
+  /**
+   * Add or remove a MODCOD queue to or from the non-empty MODCOD queues
+   * according to its current state.
+   *
+   * \param modcod MODCOD of the queue
+   */
+  void UpdateNonEmptyModcods (SatEnums::SatModcod_t modcod);
+
+  /**
+   * Select the non-empty MODCOD queue to serve next according to the queue
+   * selection policy.
+   *
+   * \return MODCOD of the selected queue
+   */
+  SatEnums::SatModcod_t SelectModcodQueue ();
+
+  /**
+   * Get the number of BB frames allocated from the BB frame pool.
+   * \return Number of allocations
+   */
+  uint64_t GetNBbFramePoolAllocations () const;
+
+  /**
+   * Get the number of BB frame pool allocations which needed new memory from the heap.
+   * \return Number of heap allocations
+   */
+  uint64_t GetNBbFramePoolHeapAllocations () const;
+
+  /**
+   * Get the number of pooled BB frames in use.
+   * \return Number of BB frames in use
+   */
+  uint64_t GetNBbFramePoolInUse () const;
 };
 
 
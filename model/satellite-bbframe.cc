@@ -89,6 +89,27 @@ SatBbFrame::~SatBbFrame ()
   NS_LOG_FUNCTION (this);
 }
 
+void*
+SatBbFrame::operator new (size_t size)
+{
+  return GetPool ().Allocate (size);
+}
+
+void
+SatBbFrame::operator delete (void* p, size_t size)
+{
+  GetPool ().Deallocate (p, size);
+}
+
+SatObjectPool&
+SatBbFrame::GetPool ()
+{
+  // The pool is never destroyed, since frames may be released during the
+  // destruction of the static objects
+  static SatObjectPool* pool = new SatObjectPool (sizeof (SatBbFrame));
+  return *pool;
+}
+
 const SatBbFrame::SatBbFramePayload_t&
 SatBbFrame::GetPayload ()
 {
@@ -29,6 +29,7 @@
 #include "ns3/traced-callback.h"
 #include "ns3/satellite-bbframe-conf.h"
 #include "satellite-enums.h"
+#include "satellite-object-pool.h"
 
 namespace ns3 {
 
@@ -68,6 +69,26 @@ public:
    */
   virtual ~SatBbFrame ();
 
+  /**
+   * Allocate the memory of a BB frame from the BB frame pool.
+   * \param size Size of the object
+   * \return Pointer to the memory
+   */
+  static void* operator new (size_t size);
+
+  /**
+   * Release the memory of a BB frame to the BB frame pool.
+   * \param p Pointer to the memory
+   * \param size Size of the object
+   */
+  static void operator delete (void* p, size_t size);
+
+  /**
+   * Get the memory pool of the BB frames, e.g. for the allocation counters.
+   * \return The pool
+   */
+  static SatObjectPool& GetPool ();
+
   /**
    * Get the data in the BB Frame info as container of the packet pointers.
    * \return Container having data as packet pointers.
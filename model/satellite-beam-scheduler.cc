@@ -193,12 +193,24 @@ SatBeamScheduler::GetTypeId (void)
                    MakeEnumAccessor (&SatBeamScheduler::m_cnoEstimatorMode),
                    MakeEnumChecker (SatCnoEstimator::LAST, "LastValueInWindow",
                                     SatCnoEstimator::MINIMUM, "MinimumValueInWindow",
-                                    SatCnoEstimator::AVERAGE, "AverageValueInWindow"))
+                                    SatCnoEstimator::AVERAGE, "AverageValueInWindow",
+                                    SatCnoEstimator::EWMA, "EwmaValueInWindow",
+                                    SatCnoEstimator::PERCENTILE, "PercentileValueInWindow"))
     .AddAttribute ( "CnoEstimationWindow",
                     "Time window for C/N0 estimation.",
                     TimeValue (MilliSeconds (1000)),
                     MakeTimeAccessor (&SatBeamScheduler::m_cnoEstimationWindow),
                     MakeTimeChecker ())
+    .AddAttribute ( "CnoEstimationEwmaWeight",
+                    "Weight of a new sample in C/N0 estimation mode EwmaValueInWindow, in range (0, 1].",
+                    DoubleValue (0.1),
+                    MakeDoubleAccessor (&SatBeamScheduler::m_cnoEstimationEwmaWeight),
+                    MakeDoubleChecker<double> (0.0, 1.0))
+    .AddAttribute ( "CnoEstimationPercentile",
+                    "Percentile of the samples in C/N0 estimation mode PercentileValueInWindow.",
+                    DoubleValue (10.0),
+                    MakeDoubleAccessor (&SatBeamScheduler::m_cnoEstimationPercentile),
+                    MakeDoubleChecker<double> (0.0, 100.0))
     .AddAttribute ( "MaxTwoWayPropagationDelay",
                     "Maximum two way propagation delay between GW and UT.",
                     TimeValue (MilliSeconds (560)),
@@ -269,6 +281,8 @@ SatBeamScheduler::SatBeamScheduler ()
   m_txCallback (0),
   m_logonChannelIndex (1),
   m_cnoEstimatorMode (SatCnoEstimator::LAST),
+  m_cnoEstimationEwmaWeight (0.1),
+  m_cnoEstimationPercentile (10.0),
   m_maxBbFrameSize (0),
   m_controlSlotsEnabled (false),
   m_superframeAllocatorType (SatEnums::DEFAULT_SUPERFRAME_ALLOCATOR)
@@ -513,8 +527,24 @@ SatBeamScheduler::CreateCnoEstimator ()
     case SatCnoEstimator::LAST:
     case SatCnoEstimator::MINIMUM:
     case SatCnoEstimator::AVERAGE:
-      estimator = Create<SatBasicCnoEstimator> (m_cnoEstimatorMode, m_cnoEstimationWindow);
-      break;
+    case SatCnoEstimator::EWMA:
+    case SatCnoEstimator::PERCENTILE:
+      {
+        Ptr<SatBasicCnoEstimator> basicEstimator = Create<SatBasicCnoEstimator> (m_cnoEstimatorMode, m_cnoEstimationWindow);
+
+        // The parameters are validated only in the modes using them
+        if (m_cnoEstimatorMode == SatCnoEstimator::EWMA)
+          {
+            basicEstimator->SetEwmaWeight (m_cnoEstimationEwmaWeight);
+          }
+        else if (m_cnoEstimatorMode == SatCnoEstimator::PERCENTILE)
+          {
+            basicEstimator->SetPercentile (m_cnoEstimationPercentile);
+          }
+
+        estimator = basicEstimator;
+        break;
+      }
 
     default:
       NS_FATAL_ERROR ("Not supported C/N0 estimation mode!!!");
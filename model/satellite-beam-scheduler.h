@@ -461,6 +461,16 @@ private:
    */
   Time m_cnoEstimationWindow;
 
+  /**
+   * Weight of a new sample in C/N0 estimation mode EWMA.
+   */
+  double m_cnoEstimationEwmaWeight;
+
+  /**
+   * Percentile of the samples in C/N0 estimation mode PERCENTILE.
+   */
+  double m_cnoEstimationPercentile;
+
   /**
    * Superframe allocator to maintain load information of the frames and their configurations.
    */
@@ -28,10 +28,12 @@
 #include "ns3/propagation-delay-model.h"
 #include "ns3/mobility-model.h"
 #include "ns3/enum.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
 #include "satellite-phy-rx.h"
 #include "satellite-phy-tx.h"
 #include "satellite-channel.h"
-#include "satellite-mac-tag.h"
+#include "satellite-constant-position-mobility-model.h"
 #include "ns3/singleton.h"
 #include "ns3/boolean.h"
 #include "satellite-rx-power-output-trace-container.h"
@@ -51,6 +53,19 @@ NS_OBJECT_ENSURE_REGISTERED (SatChannel);
 SatChannel::SatChannel ()
   : m_fwdMode (SatChannel::ALL_BEAMS),
   m_phyRxContainer (),
+  m_phyRxBeamIndex (),
+  m_phyRxDestIndex (),
+  m_phyRxBeamIndexValid (false),
+  m_enableInterferenceCutoff (false),
+  m_interferenceCutoffGain (0.0),
+  m_nPrunedRx (0),
+  m_enableLinkGainCache (true),
+  m_linkGainCache (),
+  m_linkGainIndex (),
+  m_enableBatchedRx (true),
+  m_rxBatch (),
+  m_rxBatchDelay (),
+  m_rxBatchNodeId (0),
   m_channelType (SatEnums::UNKNOWN_CH),
   m_carrierFreqConverter (),
   m_freqId (),
@@ -66,7 +81,8 @@ SatChannel::SatChannel ()
    */
   m_enableRxPowerOutputTrace (false),
   m_enableFadingOutputTrace (false),
-  m_enableExternalFadingInputTrace (false)
+  m_enableExternalFadingInputTrace (false),
+  m_enableLazyRxPowerCalculation (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -80,7 +96,20 @@ void
 SatChannel::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
+  NS_LOG_INFO ("Receptions pruned by interference cutoff: " << m_nPrunedRx);
   m_phyRxContainer.clear ();
+  m_phyRxBeamIndex.clear ();
+  m_phyRxDestIndex.clear ();
+  m_linkGainCache.clear ();
+
+  // The mobility models may outlive the channel
+  for (LinkGainIndex_t::iterator it = m_linkGainIndex.begin (); it != m_linkGainIndex.end (); ++it)
+    {
+      it->first->TraceDisconnectWithoutContext ("SatCourseChange", MakeCallback (&SatChannel::LinkMobilityChanged, this));
+    }
+  m_linkGainIndex.clear ();
+
+  m_rxBatch.clear ();
   m_propagationDelay = 0;
   Channel::DoDispose ();
 }
@@ -120,6 +149,42 @@ SatChannel::GetTypeId (void)
                    MakeEnumChecker (SatChannel::ONLY_DEST_NODE, "OnlyDestNode",
                                     SatChannel::ONLY_DEST_BEAM, "OnlyDestBeam",
                                     SatChannel::ALL_BEAMS, "AllBeams"))
+    .AddAttribute ("EnableInterferenceCutoff",
+                   "Skip the cross-beam receivers with negligible antenna gain in AllBeams forwarding mode. "
+                   "The antenna gains of the links between static terminals are taken from the link gain "
+                   "cache, if enabled, while the gains of the other links are calculated for every burst.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatChannel::m_enableInterferenceCutoff),
+                   MakeBooleanChecker ())
+    .AddAttribute ("InterferenceCutoffDb",
+                   "Combined TX and RX antenna gain of a cross-beam link, below which the receiver is skipped.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&SatChannel::SetInterferenceCutoffDb,
+                                       &SatChannel::GetInterferenceCutoffDb),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("PrunedRxCount",
+                   "Number of receptions skipped by the interference cutoff.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&SatChannel::GetNPrunedRx),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("EnableBatchedRx",
+                   "Deliver a transmission to consecutive receivers with the same delay and node with one event.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&SatChannel::m_enableBatchedRx),
+                   MakeBooleanChecker ())
+    .AddAttribute ("EnableLinkGainCache",
+                   "Cache the antenna gains and free space loss of the links between static terminals.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&SatChannel::m_enableLinkGainCache),
+                   MakeBooleanChecker ())
+    .AddAttribute ("EnableLazyRxPowerCalculation",
+                   "Defer the Rx power calculation of the forward user link until the receiver needs it, "
+                   "i.e. until the burst is received or interferes a burst being received. Used only "
+                   "without Rx power and fading output traces.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatChannel::m_enableLazyRxPowerCalculation),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -129,6 +194,7 @@ SatChannel::AddRx (Ptr<SatPhyRx> phyRx)
 {
   NS_LOG_FUNCTION (this << phyRx);
   m_phyRxContainer.push_back (phyRx);
+  m_phyRxBeamIndexValid = false;
 }
 
 void
@@ -141,7 +207,223 @@ SatChannel::RemoveRx (Ptr<SatPhyRx> phyRx)
   if (phyIter != m_phyRxContainer.end ()) // == vector.end() means the element was not found
     {
       m_phyRxContainer.erase (phyIter);
+      m_phyRxBeamIndexValid = false;
+    }
+}
+
+void
+SatChannel::SetInterferenceCutoffDb (double thresholdDb)
+{
+  NS_LOG_FUNCTION (this << thresholdDb);
+
+  m_interferenceCutoffGain = SatUtils::DbToLinear (thresholdDb);
+}
+
+double
+SatChannel::GetInterferenceCutoffDb () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return SatUtils::LinearToDb (m_interferenceCutoffGain);
+}
+
+uint64_t
+SatChannel::GetNPrunedRx () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return m_nPrunedRx;
+}
+
+void
+SatChannel::UpdatePhyRxBeamIndex ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_phyRxBeamIndexValid)
+    {
+      return;
+    }
+
+  m_phyRxBeamIndex.clear ();
+  m_phyRxDestIndex.clear ();
+
+  // Keep the receivers of each beam in the same order as in m_phyRxContainer
+  for (uint32_t i = 0; i < m_phyRxContainer.size (); ++i)
+    {
+      Ptr<SatPhyRx> phyRx = m_phyRxContainer[i];
+      m_phyRxBeamIndex[phyRx->GetBeamId ()].push_back (phyRx);
+      m_phyRxDestIndex[std::make_pair (phyRx->GetBeamId (), phyRx->GetAddress ())].push_back (i);
+    }
+
+  m_phyRxBeamIndexValid = true;
+}
+
+void
+SatChannel::ScheduleRxToDestinations (Ptr<SatSignalParameters> txParams)
+{
+  NS_LOG_FUNCTION (this << txParams);
+
+  UpdatePhyRxBeamIndex ();
+
+  PhyRxBeamIndex::const_iterator beamIterator = m_phyRxBeamIndex.find (txParams->m_beamId);
+  if (beamIterator == m_phyRxBeamIndex.end ())
+    {
+      return;
+    }
+
+  // Resolve the destinations of the burst once instead of per receiver
+  std::vector<Mac48Address> destinations;
+  destinations.reserve (txParams->m_packetsInBurst.size ());
+
+  for (uint32_t i = 0; i < txParams->m_packetsInBurst.size (); ++i)
+    {
+      Mac48Address source;
+      Mac48Address dest;
+      bool mSuccess = txParams->GetPacketAddresses (i, source, dest);
+      if (!mSuccess)
+        {
+          NS_FATAL_ERROR ("MAC tag was not found from the packet!");
+        }
+
+      // Broadcast and group packets are received by all the receivers of the beam
+      if (dest.IsBroadcast () || dest.IsGroup ())
+        {
+          for (PhyRxContainer::const_iterator rxPhyIterator = beamIterator->second.begin ();
+               rxPhyIterator != beamIterator->second.end ();
+               ++rxPhyIterator)
+            {
+              ScheduleRx (txParams, *rxPhyIterator);
+            }
+          return;
+        }
+
+      destinations.push_back (dest);
+    }
+
+  std::sort (destinations.begin (), destinations.end ());
+  destinations.erase (std::unique (destinations.begin (), destinations.end ()), destinations.end ());
+
+  std::vector<uint32_t> positions;
+
+  for (std::vector<Mac48Address>::const_iterator it = destinations.begin (); it != destinations.end (); ++it)
+    {
+      PhyRxDestIndex::const_iterator destIterator = m_phyRxDestIndex.find (std::make_pair (txParams->m_beamId, *it));
+      if (destIterator != m_phyRxDestIndex.end ())
+        {
+          positions.insert (positions.end (), destIterator->second.begin (), destIterator->second.end ());
+        }
     }
+
+  /**
+   * Each receiver receives the burst only once and the receptions are
+   * scheduled in the order of m_phyRxContainer, as when all the receivers
+   * were checked one by one.
+   */
+  std::sort (positions.begin (), positions.end ());
+
+  for (std::vector<uint32_t>::const_iterator it = positions.begin (); it != positions.end (); ++it)
+    {
+      ScheduleRx (txParams, m_phyRxContainer[*it]);
+    }
+}
+
+bool
+SatChannel::IsInterferenceRelevant (Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> phyRx)
+{
+  NS_LOG_FUNCTION (this << txParams << phyRx);
+
+  Ptr<SatPhyTx> phyTx = txParams->m_phyTx;
+  double txAntennaGain_W;
+  double rxAntennaGain_W;
+
+  // The gains of the links between static terminals are calculated only once
+  if (m_enableLinkGainCache && IsStaticLink (phyTx, phyRx))
+    {
+      const LinkGain_t& linkGain = GetCachedLinkGain (phyTx, phyRx, txParams->m_carrierId);
+      txAntennaGain_W = linkGain.txAntennaGain_W;
+      rxAntennaGain_W = linkGain.rxAntennaGain_W;
+    }
+  else
+    {
+      GetLinkAntennaGains (phyTx, phyRx, txAntennaGain_W, rxAntennaGain_W);
+    }
+
+  return txAntennaGain_W * rxAntennaGain_W >= m_interferenceCutoffGain;
+}
+
+bool
+SatChannel::IsStaticLink (Ptr<SatPhyTx> phyTx, Ptr<SatPhyRx> phyRx) const
+{
+  NS_LOG_FUNCTION (this << phyTx << phyRx);
+
+  return DynamicCast<SatConstantPositionMobilityModel> (phyTx->GetMobility ())
+         && DynamicCast<SatConstantPositionMobilityModel> (phyRx->GetMobility ());
+}
+
+const SatChannel::LinkGain_t&
+SatChannel::GetCachedLinkGain (Ptr<SatPhyTx> phyTx, Ptr<SatPhyRx> phyRx, uint32_t carrierId)
+{
+  NS_LOG_FUNCTION (this << phyTx << phyRx << carrierId);
+
+  LinkGainKey_t key = std::make_tuple (phyTx, phyRx, carrierId);
+  LinkGainCache_t::iterator it = m_linkGainCache.find (key);
+
+  if (it == m_linkGainCache.end ())
+    {
+      Ptr<MobilityModel> txMobility = phyTx->GetMobility ();
+      Ptr<MobilityModel> rxMobility = phyRx->GetMobility ();
+      double frequency_hz = m_carrierFreqConverter (m_channelType, m_freqId, carrierId);
+
+      LinkGain_t linkGain;
+      GetLinkAntennaGains (phyTx, phyRx, linkGain.txAntennaGain_W, linkGain.rxAntennaGain_W);
+      linkGain.fsl = m_freeSpaceLoss->GetFsl (txMobility, rxMobility, frequency_hz);
+
+      ObserveLinkMobility (txMobility, key);
+      ObserveLinkMobility (rxMobility, key);
+
+      it = m_linkGainCache.insert (std::make_pair (key, linkGain)).first;
+    }
+
+  return it->second;
+}
+
+void
+SatChannel::ObserveLinkMobility (Ptr<MobilityModel> mobility, const LinkGainKey_t& key)
+{
+  NS_LOG_FUNCTION (this << mobility);
+
+  Ptr<SatMobilityModel> satMobility = DynamicCast<SatMobilityModel> (mobility);
+
+  std::pair<LinkGainIndex_t::iterator, bool> result = m_linkGainIndex.insert (std::make_pair (satMobility, std::set<LinkGainKey_t> ()));
+
+  if (result.second)
+    {
+      satMobility->TraceConnectWithoutContext ("SatCourseChange", MakeCallback (&SatChannel::LinkMobilityChanged, this));
+    }
+
+  result.first->second.insert (key);
+}
+
+void
+SatChannel::LinkMobilityChanged (Ptr<const SatMobilityModel> mobility)
+{
+  NS_LOG_FUNCTION (this << mobility);
+
+  LinkGainIndex_t::iterator it = m_linkGainIndex.find (ConstCast<SatMobilityModel> (mobility));
+
+  if (it == m_linkGainIndex.end ())
+    {
+      return;
+    }
+
+  // Erasing a link already invalidated by the other end of the link does nothing
+  for (std::set<LinkGainKey_t>::const_iterator keyIt = it->second.begin (); keyIt != it->second.end (); ++keyIt)
+    {
+      m_linkGainCache.erase (*keyIt);
+    }
+
+  it->second.clear ();
 }
 
 void
@@ -160,60 +442,39 @@ SatChannel::StartTx (Ptr<SatSignalParameters> txParams)
     */
     case SatChannel::ONLY_DEST_NODE:
       {
-        // For all receivers
-        for (PhyRxContainer::const_iterator rxPhyIterator = m_phyRxContainer.begin ();
-             rxPhyIterator != m_phyRxContainer.end ();
-             ++rxPhyIterator)
+        switch (m_channelType)
           {
-            // If the same beam
-            if ( (*rxPhyIterator)->GetBeamId () == txParams->m_beamId )
-              {
-                switch (m_channelType)
-                  {
-                  // If the destination is satellite
-                  case SatEnums::FORWARD_FEEDER_CH:
-                  case SatEnums::RETURN_USER_CH:
+          // If the destination is satellite
+          case SatEnums::FORWARD_FEEDER_CH:
+          case SatEnums::RETURN_USER_CH:
+            {
+              UpdatePhyRxBeamIndex ();
+
+              // The packet burst is passed on to the satellite receivers of the beam
+              PhyRxBeamIndex::const_iterator beamIterator = m_phyRxBeamIndex.find (txParams->m_beamId);
+              if (beamIterator != m_phyRxBeamIndex.end ())
+                {
+                  for (PhyRxContainer::const_iterator rxPhyIterator = beamIterator->second.begin ();
+                       rxPhyIterator != beamIterator->second.end ();
+                       ++rxPhyIterator)
                     {
-                      // The packet burst is passed on to the satellite receiver
                       ScheduleRx (txParams, *rxPhyIterator);
-                      break;
-                    }
-                  // If the destination is terrestrial node
-                  case SatEnums::FORWARD_USER_CH:
-                  case SatEnums::RETURN_FEEDER_CH:
-                    {
-                      // Go through the packets and check their destination address by peeking the MAC tag
-                      SatSignalParameters::PacketsInBurst_t::const_iterator it = txParams->m_packetsInBurst.begin ();
-                      for (; it != txParams->m_packetsInBurst.end (); ++it )
-                        {
-                          SatMacTag macTag;
-                          bool mSuccess = (*it)->PeekPacketTag (macTag);
-                          if (!mSuccess)
-                            {
-                              NS_FATAL_ERROR ("MAC tag was not found from the packet!");
-                            }
-
-                          Mac48Address dest = macTag.GetDestAddress ();
-
-                          // If the packet destination is the same as the receiver MAC
-                          if (dest == (*rxPhyIterator)->GetAddress () || dest.IsBroadcast () || dest.IsGroup ())
-                            {
-                              ScheduleRx (txParams, *rxPhyIterator);
-
-                              // Remember to break the packet loop, so that the transmission
-                              // is not received several times!
-                              break;
-                            }
-                        }
-                      break;
-                    }
-                  default:
-                    {
-                      NS_FATAL_ERROR ("Unsupported channel type!");
-                      break;
                     }
-                  }
-              }
+                }
+              break;
+            }
+          // If the destination is terrestrial node
+          case SatEnums::FORWARD_USER_CH:
+          case SatEnums::RETURN_FEEDER_CH:
+            {
+              ScheduleRxToDestinations (txParams);
+              break;
+            }
+          default:
+            {
+              NS_FATAL_ERROR ("Unsupported channel type!");
+              break;
+            }
           }
         break;
       }
@@ -224,12 +485,14 @@ SatChannel::StartTx (Ptr<SatSignalParameters> txParams)
     */
     case SatChannel::ONLY_DEST_BEAM:
       {
-        for (PhyRxContainer::const_iterator rxPhyIterator = m_phyRxContainer.begin ();
-             rxPhyIterator != m_phyRxContainer.end ();
-             ++rxPhyIterator)
+        UpdatePhyRxBeamIndex ();
+
+        PhyRxBeamIndex::const_iterator beamIterator = m_phyRxBeamIndex.find (txParams->m_beamId);
+        if (beamIterator != m_phyRxBeamIndex.end ())
           {
-            // If the same beam
-            if ( (*rxPhyIterator)->GetBeamId () == txParams->m_beamId )
+            for (PhyRxContainer::const_iterator rxPhyIterator = beamIterator->second.begin ();
+                 rxPhyIterator != beamIterator->second.end ();
+                 ++rxPhyIterator)
               {
                 ScheduleRx (txParams, *rxPhyIterator);
               }
@@ -244,11 +507,37 @@ SatChannel::StartTx (Ptr<SatSignalParameters> txParams)
     */
     case SatChannel::ALL_BEAMS:
       {
+        if (!m_enableInterferenceCutoff)
+          {
+            for (PhyRxContainer::const_iterator rxPhyIterator = m_phyRxContainer.begin ();
+                 rxPhyIterator != m_phyRxContainer.end ();
+                 ++rxPhyIterator)
+              {
+                ScheduleRx (txParams, *rxPhyIterator);
+              }
+            break;
+          }
+
+        /**
+         * With the interference cutoff, the receivers of the own beam always receive
+         * the transmission, while the receivers of the other beams receive it only if
+         * the combined antenna gain of the link is above the cutoff threshold. The
+         * receivers are served in the order of m_phyRxContainer, as without the cutoff.
+         */
         for (PhyRxContainer::const_iterator rxPhyIterator = m_phyRxContainer.begin ();
              rxPhyIterator != m_phyRxContainer.end ();
              ++rxPhyIterator)
           {
-            ScheduleRx (txParams, *rxPhyIterator);
+            bool ownBeam = ((*rxPhyIterator)->GetBeamId () == txParams->m_beamId);
+
+            if (ownBeam || IsInterferenceRelevant (txParams, *rxPhyIterator))
+              {
+                ScheduleRx (txParams, *rxPhyIterator);
+              }
+            else
+              {
+                ++m_nPrunedRx;
+              }
           }
         break;
       }
@@ -258,6 +547,8 @@ SatChannel::StartTx (Ptr<SatSignalParameters> txParams)
         break;
       }
     }
+
+  FlushRxBatch (txParams);
 }
 
 void
@@ -270,9 +561,6 @@ SatChannel::ScheduleRx (Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> receive
   Ptr<MobilityModel> senderMobility = txParams->m_phyTx->GetMobility ();
   Ptr<MobilityModel> receiverMobility = receiver->GetMobility ();
 
-  NS_LOG_INFO ("copying signal parameters " << txParams);
-  Ptr<SatSignalParameters> rxParams = txParams->Copy ();
-
   if (m_propagationDelay)
     {
       delay = m_propagationDelay->GetDelay (senderMobility, receiverMobility);
@@ -324,7 +612,79 @@ SatChannel::ScheduleRx (Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> receive
 
   Ptr<NetDevice> netDev = receiver->GetDevice ();
   uint32_t dstNodeId =  netDev->GetNode ()->GetId ();
-  Simulator::ScheduleWithContext (dstNodeId, delay, &SatChannel::StartRx, this, rxParams, receiver);
+
+  /**
+   * Consecutive receivers with the same propagation delay at the same node
+   * (e.g. the satellite PHYs of the co-channel beams) share one scheduled
+   * event. Since the receivers are batched only when consecutive, the order
+   * of the receptions is the same as with one event per receiver.
+   */
+  if (m_enableBatchedRx
+      && !m_rxBatch.empty ()
+      && m_rxBatchDelay == delay
+      && m_rxBatchNodeId == dstNodeId)
+    {
+      m_rxBatch.push_back (receiver);
+      return;
+    }
+
+  FlushRxBatch (txParams);
+
+  m_rxBatch.push_back (receiver);
+  m_rxBatchDelay = delay;
+  m_rxBatchNodeId = dstNodeId;
+}
+
+void
+SatChannel::FlushRxBatch (Ptr<SatSignalParameters> txParams)
+{
+  NS_LOG_FUNCTION (this << txParams);
+
+  if (m_rxBatch.empty ())
+    {
+      return;
+    }
+
+  NS_LOG_INFO ("copying signal parameters " << txParams);
+  Ptr<SatSignalParameters> rxParams = txParams->Copy ();
+
+  NS_LOG_INFO ("Setting propagation delay: " << m_rxBatchDelay << " for " << m_rxBatch.size () << " receivers");
+
+  if (m_rxBatch.size () == 1)
+    {
+      Simulator::ScheduleWithContext (m_rxBatchNodeId, m_rxBatchDelay, &SatChannel::StartRx, this, rxParams, m_rxBatch.front ());
+    }
+  else
+    {
+      Simulator::ScheduleWithContext (m_rxBatchNodeId, m_rxBatchDelay, &SatChannel::StartRxBatch, this, rxParams, m_rxBatch);
+    }
+
+  m_rxBatch.clear ();
+}
+
+void
+SatChannel::StartRxBatch (Ptr<SatSignalParameters> rxParams, const PhyRxContainer& phyRxs)
+{
+  NS_LOG_FUNCTION (this << rxParams << phyRxs.size ());
+
+  /**
+   * The shared parameters are copied for every receiver but the last one,
+   * which takes the shared instance itself, since the Rx power and the
+   * interference are receiver specific. The copies include the packets,
+   * from which the receivers remove headers and tags, thus the batch saves
+   * the scheduled events but not the copies of the parameters.
+   */
+  for (PhyRxContainer::const_iterator it = phyRxs.begin (); it != phyRxs.end (); ++it)
+    {
+      if (it + 1 == phyRxs.end ())
+        {
+          StartRx (rxParams, *it);
+        }
+      else
+        {
+          StartRx (rxParams->Copy (), *it);
+        }
+    }
 }
 
 void
@@ -341,6 +701,12 @@ SatChannel::StartRx (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx)
     {
     case SatEnums::RX_PWR_CALCULATION:
       {
+        if (IsRxPowerCalculationDeferrable ())
+          {
+            rxParams->m_rxPowerCalculate = MakeBoundCallback (&SatChannel::DeferredRxPowerCalculationHelper, this, phyRx);
+            break;
+          }
+
         DoRxPowerCalculation (rxParams, phyRx);
 
         if (m_enableRxPowerOutputTrace)
@@ -561,30 +927,41 @@ SatChannel::DoRxPowerCalculation (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyR
 {
   NS_LOG_FUNCTION (this << rxParams << phyRx);
 
-  Ptr<MobilityModel> txMobility = rxParams->m_phyTx->GetMobility ();
-  Ptr<MobilityModel> rxMobility = phyRx->GetMobility ();
-
   double txAntennaGain_W = 0.0;
   double rxAntennaGain_W = 0.0;
+  double fsl = 0.0;
   double markovFading = 0.0;
   double extFading = 1.0;
 
-  // use always UT's or GW's position when getting antenna gain
+  /**
+   * Antenna gains and free space loss of the links between static terminals
+   * do not change, thus they are taken from the link gain cache. Only the
+   * fading values are evaluated for every received burst.
+   */
+  if (m_enableLinkGainCache && IsStaticLink (rxParams->m_phyTx, phyRx))
+    {
+      const LinkGain_t& linkGain = GetCachedLinkGain (rxParams->m_phyTx, phyRx, rxParams->m_carrierId);
+      txAntennaGain_W = linkGain.txAntennaGain_W;
+      rxAntennaGain_W = linkGain.rxAntennaGain_W;
+      fsl = linkGain.fsl;
+    }
+  else
+    {
+      GetLinkAntennaGains (rxParams->m_phyTx, phyRx, txAntennaGain_W, rxAntennaGain_W);
+      fsl = m_freeSpaceLoss->GetFsl (rxParams->m_phyTx->GetMobility (), phyRx->GetMobility (), rxParams->m_carrierFreq_hz);
+    }
+
   switch (m_channelType)
     {
     case SatEnums::RETURN_FEEDER_CH:
     case SatEnums::FORWARD_USER_CH:
       {
-        txAntennaGain_W = rxParams->m_phyTx->GetAntennaGain (rxMobility);
-        rxAntennaGain_W = phyRx->GetAntennaGain (rxMobility);
         markovFading = phyRx->GetFadingValue (phyRx->GetDevice ()->GetAddress (), m_channelType);
         break;
       }
     case SatEnums::RETURN_USER_CH:
     case SatEnums::FORWARD_FEEDER_CH:
       {
-        txAntennaGain_W = rxParams->m_phyTx->GetAntennaGain (txMobility);
-        rxAntennaGain_W = phyRx->GetAntennaGain (txMobility);
         markovFading = rxParams->m_phyTx->GetFadingValue (GetSourceAddress (rxParams), m_channelType);
         break;
       }
@@ -617,10 +994,62 @@ SatChannel::DoRxPowerCalculation (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyR
     }
 
   // get (calculate) free space loss and RX power and set it to RX params
-  double rxPower_W = (rxParams->m_txPower_W * txAntennaGain_W) / m_freeSpaceLoss->GetFsl (txMobility, rxMobility, rxParams->m_carrierFreq_hz);
+  double rxPower_W = (rxParams->m_txPower_W * txAntennaGain_W) / fsl;
   rxParams->m_rxPower_W = rxPower_W * rxAntennaGain_W / phyRx->GetLosses () * markovFading / extFading;
 }
 
+bool
+SatChannel::IsRxPowerCalculationDeferrable () const
+{
+  NS_LOG_FUNCTION (this);
+
+  // The output traces expect the Rx power of every received burst
+  return m_enableLazyRxPowerCalculation
+         && m_channelType == SatEnums::FORWARD_USER_CH
+         && !m_enableRxPowerOutputTrace
+         && !m_enableFadingOutputTrace;
+}
+
+void
+SatChannel::DeferredRxPowerCalculationHelper (SatChannel *channel, Ptr<SatPhyRx> phyRx, Ptr<SatSignalParameters> rxParams)
+{
+  NS_LOG_FUNCTION (channel << phyRx << rxParams);
+
+  channel->DoRxPowerCalculation (rxParams, phyRx);
+}
+
+void
+SatChannel::GetLinkAntennaGains (Ptr<SatPhyTx> phyTx, Ptr<SatPhyRx> phyRx, double& txAntennaGain_W, double& rxAntennaGain_W)
+{
+  NS_LOG_FUNCTION (this << phyTx << phyRx);
+
+  // use always UT's or GW's position when getting antenna gain
+  switch (m_channelType)
+    {
+    case SatEnums::RETURN_FEEDER_CH:
+    case SatEnums::FORWARD_USER_CH:
+      {
+        Ptr<MobilityModel> rxMobility = phyRx->GetMobility ();
+        txAntennaGain_W = phyTx->GetAntennaGain (rxMobility);
+        rxAntennaGain_W = phyRx->GetAntennaGain (rxMobility);
+        break;
+      }
+    case SatEnums::RETURN_USER_CH:
+    case SatEnums::FORWARD_FEEDER_CH:
+      {
+        Ptr<MobilityModel> txMobility = phyTx->GetMobility ();
+        txAntennaGain_W = phyTx->GetAntennaGain (txMobility);
+        rxAntennaGain_W = phyRx->GetAntennaGain (txMobility);
+        break;
+      }
+    default:
+      {
+        NS_FATAL_ERROR ("SatChannel::GetLinkAntennaGains - Invalid channel type");
+        break;
+      }
+    }
+}
+
 double
 SatChannel::GetExternalFadingTrace (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx)
 {
@@ -676,18 +1105,16 @@ SatChannel::GetSourceAddress (Ptr<SatSignalParameters> rxParams)
 {
   NS_LOG_FUNCTION (this << rxParams);
 
-  SatMacTag tag;
-
-  SatSignalParameters::PacketsInBurst_t::const_iterator i = rxParams->m_packetsInBurst.begin ();
-
-  if (*i == NULL)
+  if (rxParams->m_packetsInBurst.empty () || rxParams->m_packetsInBurst.front () == NULL)
     {
       NS_FATAL_ERROR ("SatChannel::GetSourceAddress - Empty packet list");
     }
 
-  (*i)->PeekPacketTag (tag);
+  Mac48Address source;
+  Mac48Address dest;
+  rxParams->GetPacketAddresses (0, source, dest);
 
-  return tag.GetSourceAddress ();
+  return source;
 }
 
 void
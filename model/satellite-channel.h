@@ -22,6 +22,10 @@
 #ifndef SATELLITE_CHANNEL_H
 #define SATELLITE_CHANNEL_H
 
+#include <map>
+#include <set>
+#include <tuple>
+
 #include "ns3/object.h"
 #include "ns3/nstime.h"
 #include "ns3/channel.h"
@@ -94,6 +98,42 @@ public:
    */
   typedef std::vector<Ptr<SatPhyRx> > PhyRxContainer;
 
+  /**
+   * Define type PhyRxBeamIndex, receivers of the channel grouped by beam id
+   */
+  typedef std::map<uint32_t, PhyRxContainer> PhyRxBeamIndex;
+
+  /**
+   * Define type PhyRxDestIndex, positions of the receivers in the receiver
+   * container keyed by beam id and receiver MAC address
+   */
+  typedef std::map<std::pair<uint32_t, Mac48Address>, std::vector<uint32_t> > PhyRxDestIndex;
+
+  /**
+   * \brief Struct for storing the position dependent gains of a link
+   */
+  typedef struct
+  {
+    double txAntennaGain_W;
+    double rxAntennaGain_W;
+    double fsl;
+  } LinkGain_t;
+
+  /**
+   * Define type LinkGainKey_t, a link identified by transmitter, receiver and carrier id
+   */
+  typedef std::tuple<Ptr<SatPhyTx>, Ptr<SatPhyRx>, uint32_t> LinkGainKey_t;
+
+  /**
+   * Define type LinkGainCache_t, link gains keyed by transmitter, receiver and carrier id
+   */
+  typedef std::map<LinkGainKey_t, LinkGain_t> LinkGainCache_t;
+
+  /**
+   * Define type LinkGainIndex_t, the cached links of each mobility model
+   */
+  typedef std::map<Ptr<SatMobilityModel>, std::set<LinkGainKey_t> > LinkGainIndex_t;
+
   /**
    * \brief
    * \param channelType     The type of channel
@@ -191,6 +231,13 @@ public:
    */
   virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
 
+  /**
+   * \brief Get the number of receptions skipped by the interference
+   * relevance cutoff in ALL_BEAMS forwarding mode.
+   * \return Number of pruned receptions since the channel creation
+   */
+  uint64_t GetNPrunedRx () const;
+
 private:
   /**
    * Forwarding mode of the SatChannel:
@@ -204,6 +251,80 @@ private:
    */
   PhyRxContainer m_phyRxContainer;
 
+  /**
+   * \brief Receivers of m_phyRxContainer grouped by beam id. The index
+   * is built lazily, since the beam id of a receiver is set only after it
+   * has been attached to the channel.
+   */
+  PhyRxBeamIndex m_phyRxBeamIndex;
+
+  /**
+   * \brief Receivers of m_phyRxContainer indexed by beam id and MAC address.
+   * Built and invalidated together with m_phyRxBeamIndex.
+   */
+  PhyRxDestIndex m_phyRxDestIndex;
+
+  /**
+   * \brief Flag telling whether m_phyRxBeamIndex and m_phyRxDestIndex are up to date
+   */
+  bool m_phyRxBeamIndexValid;
+
+  /**
+   * \brief Flag telling whether the cross-beam receivers with negligible
+   * antenna gain are skipped in ALL_BEAMS forwarding mode
+   */
+  bool m_enableInterferenceCutoff;
+
+  /**
+   * \brief Threshold for the combined TX and RX antenna gain of a cross-beam
+   * link. Receivers below the threshold do not receive the transmission.
+   */
+  double m_interferenceCutoffGain;
+
+  /**
+   * \brief Flag telling whether the link gains between static terminals are cached
+   */
+  bool m_enableLinkGainCache;
+
+  /**
+   * \brief Cached link gains of the links between static transmitters
+   * and receivers, keyed by transmitter, receiver and carrier id
+   */
+  LinkGainCache_t m_linkGainCache;
+
+  /**
+   * \brief Cached links of the mobility models whose course changes invalidate
+   * the cached link gains. A set may also hold links already invalidated by
+   * the course change of the other end of the link.
+   */
+  LinkGainIndex_t m_linkGainIndex;
+
+  /**
+   * \brief Number of receptions pruned by the interference relevance cutoff
+   */
+  uint64_t m_nPrunedRx;
+
+  /**
+   * \brief Flag telling whether the receivers with the same delay and node
+   * are served with one scheduled event
+   */
+  bool m_enableBatchedRx;
+
+  /**
+   * \brief Receivers collected for the next scheduled reception event
+   */
+  PhyRxContainer m_rxBatch;
+
+  /**
+   * \brief Propagation delay of the receivers in m_rxBatch
+   */
+  Time m_rxBatchDelay;
+
+  /**
+   * \brief Node id (context) of the receivers in m_rxBatch
+   */
+  uint32_t m_rxBatchNodeId;
+
   /**
    * \brief Type of the channel
    */
@@ -254,18 +375,125 @@ private:
    */
   bool m_enableExternalFadingInputTrace;
 
+  /**
+   * \brief Defines whether the Rx power calculation of the forward user link
+   * is deferred until the receiver needs the Rx power
+   */
+  bool m_enableLazyRxPowerCalculation;
+
   /**
    * Dispose SatChannel.
    */
   virtual void DoDispose ();
 
+  /**
+   * \brief Set the interference relevance cutoff threshold.
+   * \param thresholdDb Threshold for the combined antenna gain in dB
+   */
+  void SetInterferenceCutoffDb (double thresholdDb);
+
+  /**
+   * \brief Get the interference relevance cutoff threshold.
+   * \return Threshold for the combined antenna gain in dB
+   */
+  double GetInterferenceCutoffDb () const;
+
+  /**
+   * \brief Group the attached receivers by their beam id and by their
+   * beam id and MAC address, if the receivers have changed since the
+   * last transmission.
+   */
+  void UpdatePhyRxBeamIndex ();
+
+  /**
+   * \brief Schedule the reception of a transmission at the terrestrial
+   * receivers of its beam which are the destinations of the packets in burst.
+   * The receivers are served in the order of m_phyRxContainer.
+   * \param txParams Transmission parameters
+   */
+  void ScheduleRxToDestinations (Ptr<SatSignalParameters> txParams);
+
+  /**
+   * \brief Check whether a cross-beam receiver is relevant for the
+   * transmission, i.e. whether the combined antenna gain of the link
+   * exceeds the interference cutoff threshold. The gains of a static link
+   * are taken from the link gain cache, if enabled. The gains of the other
+   * links are calculated for every burst, and calculated again by the Rx
+   * power calculation if the receiver is relevant.
+   * \param txParams Parameters of the signal being transmitted
+   * \param phyRx The receiver SatPhyRx entity
+   * \return true if the transmission shall be passed to the receiver
+   */
+  bool IsInterferenceRelevant (Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> phyRx);
+
+  /**
+   * \brief Check whether the gains of a link can be cached, i.e. whether
+   * both the transmitter and the receiver have a constant position.
+   * \param phyTx The transmitter SatPhyTx entity
+   * \param phyRx The receiver SatPhyRx entity
+   * \return true if the link is static
+   */
+  bool IsStaticLink (Ptr<SatPhyTx> phyTx, Ptr<SatPhyRx> phyRx) const;
+
+  /**
+   * \brief Get the cached gains of a static link. The gains are calculated
+   * and cached at the first call for the link.
+   * \param phyTx The transmitter SatPhyTx entity
+   * \param phyRx The receiver SatPhyRx entity
+   * \param carrierId The carrier id of the transmission
+   * \return The gains of the link
+   */
+  const LinkGain_t& GetCachedLinkGain (Ptr<SatPhyTx> phyTx, Ptr<SatPhyRx> phyRx, uint32_t carrierId);
+
+  /**
+   * \brief Start observing the course changes of a mobility model, and
+   * index a cached link by it.
+   * \param mobility The mobility model of a cached link
+   * \param key The cached link
+   */
+  void ObserveLinkMobility (Ptr<MobilityModel> mobility, const LinkGainKey_t& key);
+
+  /**
+   * \brief Invalidate the cached link gains of the links of a mobility model.
+   * \param mobility The mobility model which has changed its course
+   */
+  void LinkMobilityChanged (Ptr<const SatMobilityModel> mobility);
+
+  /**
+   * \brief Get the combined TX and RX antenna gain of a link. The gains are
+   * taken always towards the UT or GW position.
+   * \param phyTx The transmitter SatPhyTx entity
+   * \param phyRx The receiver SatPhyRx entity
+   * \param txAntennaGain_W Returned TX antenna gain in linear
+   * \param rxAntennaGain_W Returned RX antenna gain in linear
+   */
+  void GetLinkAntennaGains (Ptr<SatPhyTx> phyTx, Ptr<SatPhyRx> phyRx, double& txAntennaGain_W, double& rxAntennaGain_W);
+
   /**
    * \brief Used internally to schedule the StartRx method call after the propagation delay.
-   * \param rxParams Parameters of the signal being received
+   * The receiver is collected to the current batch of receivers, if it has the same
+   * delay and node as the previous one.
+   * \param txParams Parameters of the signal being transmitted
    * \param phyRx The receiver SatPhyRx entity
    */
   void ScheduleRx (Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> phyRx);
 
+  /**
+   * \brief Schedule the reception event for the current batch of receivers.
+   * \param txParams Parameters of the signal being transmitted
+   */
+  void FlushRxBatch (Ptr<SatSignalParameters> txParams);
+
+  /**
+   * \brief Used internally to start the packet reception at several receivers
+   * sharing the same propagation delay and node. Only the scheduler event is
+   * shared: every receiver still gets its own copy of the signal parameters,
+   * including the packets, since the receivers modify both.
+   * \param rxParams Parameters of the signal being received
+   * \param phyRxs The receiver SatPhyRx entities
+   */
+  void StartRxBatch (Ptr<SatSignalParameters> rxParams, const PhyRxContainer& phyRxs);
+
   /**
    * \brief Used internally to start the packet reception of at the phyRx.
    *
@@ -310,6 +538,21 @@ private:
    */
   void DoRxPowerCalculation (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx);
 
+  /**
+   * \brief Check whether the Rx power calculation can be deferred to the receiver.
+   * \return true if the Rx power calculation can be deferred
+   */
+  bool IsRxPowerCalculationDeferrable () const;
+
+  /**
+   * \brief Helper for calculating a deferred Rx power, bound to the
+   * Rx power calculation callback of the signal parameters.
+   * \param channel The channel
+   * \param phyRx The receiver SatPhyRx entity
+   * \param rxParams Rx parameters
+   */
+  static void DeferredRxPowerCalculationHelper (SatChannel *channel, Ptr<SatPhyRx> phyRx, Ptr<SatSignalParameters> rxParams);
+
   /**
    * \brief Function for getting the external source fading value
    * \param rxParams Rx parameters
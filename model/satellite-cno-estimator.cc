@@ -18,7 +18,7 @@
  * Author: Sami Rantanen <sami.rantanen@magister.fi>
  */
 
-#include <numeric>
+#include <algorithm>
 #include <math.h>
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -64,13 +64,27 @@ SatCnoEstimator::GetCnoEstimation ()
 // class for Basic C/N0 estimator
 
 SatBasicCnoEstimator::SatBasicCnoEstimator ()
-  : m_mode (LAST)
+  : m_samplesHead (0),
+  m_samplesSize (0),
+  m_sum (0.0),
+  m_removedFromSum (0),
+  m_ewma (NAN),
+  m_ewmaWeight (0.1),
+  m_percentile (10.0),
+  m_mode (LAST)
 {
   NS_LOG_FUNCTION (this);
 }
 
 SatBasicCnoEstimator::SatBasicCnoEstimator (SatCnoEstimator::EstimationMode_t mode, Time window)
-  : m_window (window),
+  : m_samplesHead (0),
+  m_samplesSize (0),
+  m_sum (0.0),
+  m_removedFromSum (0),
+  m_ewma (NAN),
+  m_ewmaWeight (0.1),
+  m_percentile (10.0),
+  m_window (window),
   m_mode (mode)
 
 {
@@ -82,26 +96,88 @@ SatBasicCnoEstimator::~SatBasicCnoEstimator ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+SatBasicCnoEstimator::SetEwmaWeight (double weight)
+{
+  NS_LOG_FUNCTION (this << weight);
+
+  if ( weight <= 0.0 || weight > 1.0 )
+    {
+      NS_FATAL_ERROR ("EWMA weight must be in range (0, 1]!!!");
+    }
+
+  m_ewmaWeight = weight;
+}
+
+void
+SatBasicCnoEstimator::SetPercentile (double percentile)
+{
+  NS_LOG_FUNCTION (this << percentile);
+
+  if ( percentile < 0.0 || percentile > 100.0 )
+    {
+      NS_FATAL_ERROR ("Percentile must be in range [0, 100]!!!");
+    }
+
+  m_percentile = percentile;
+}
+
 void
 SatBasicCnoEstimator::DoAddSample (double sample)
 {
   NS_LOG_FUNCTION (this << sample);
 
+  Time now = Simulator::Now ();
+
   switch (m_mode)
     {
     case LAST:
-      m_samples.clear ();
-      m_samples.insert (std::make_pair (Simulator::Now (), sample) );
+      ClearSamples ();
+      PushSample (std::make_pair (now, sample));
       break;
 
     case MINIMUM:
+    case AVERAGE:
+    case PERCENTILE:
       ClearOutdatedSamples ();
-      m_samples.insert (std::make_pair (Simulator::Now (), sample) );
+
+      // Only the first sample of a time instant is taken into account
+      if ( m_samplesSize > 0 && m_samples[(m_samplesHead + m_samplesSize - 1) % m_samples.size ()].first == now )
+        {
+          break;
+        }
+
+      PushSample (std::make_pair (now, sample));
+
+      if ( !std::isnan (sample) )
+        {
+          m_sum += sample;
+
+          if ( m_mode == MINIMUM )
+            {
+              while ( !m_minimums.empty () && m_minimums.back ().second >= sample )
+                {
+                  m_minimums.pop_back ();
+                }
+              m_minimums.push_back (std::make_pair (now, sample));
+            }
+        }
       break;
 
-    case AVERAGE:
-      ClearOutdatedSamples ();
-      m_samples.insert (std::make_pair (Simulator::Now (), sample) );
+    case EWMA:
+      if ( !std::isnan (sample) )
+        {
+          // Start the average again after a period without samples
+          if ( std::isnan (m_ewma) || m_ewmaTime < now - m_window )
+            {
+              m_ewma = sample;
+            }
+          else
+            {
+              m_ewma = m_ewmaWeight * sample + (1.0 - m_ewmaWeight) * m_ewma;
+            }
+          m_ewmaTime = now;
+        }
       break;
 
     default:
@@ -117,28 +193,39 @@ SatBasicCnoEstimator::DoGetCnoEstimation ()
 
   double estimatedCno = NAN;
 
+  if ( m_mode == EWMA )
+    {
+      if ( !std::isnan (m_ewma) && m_ewmaTime >= Simulator::Now () - m_window )
+        {
+          estimatedCno = m_ewma;
+        }
+
+      return estimatedCno;
+    }
+
   ClearOutdatedSamples ();
 
-  if (  m_samples.empty () == false )
+  if ( m_samplesSize > 0 )
     {
       switch (m_mode)
         {
         case LAST:
-          estimatedCno = m_samples.begin ()->second;
+          estimatedCno = m_samples[m_samplesHead].second;
           break;
 
         case MINIMUM:
-          for ( SampleMap_t::const_iterator it = m_samples.begin (); it != m_samples.end (); it++ )
+          if ( !m_minimums.empty () )
             {
-              if ( std::isnan (estimatedCno) || (( !std::isnan (it->second)) && (it->second < estimatedCno)) )
-                {
-                  estimatedCno = it->second;
-                }
+              estimatedCno = m_minimums.front ().second;
             }
           break;
 
         case AVERAGE:
-          estimatedCno = std::accumulate (m_samples.begin (), m_samples.end (), 0.0, SatBasicCnoEstimator::AddToSum ) / m_samples.size ();
+          estimatedCno = m_sum / m_samplesSize;
+          break;
+
+        case PERCENTILE:
+          estimatedCno = GetPercentileValue ();
           break;
 
         default:
@@ -154,9 +241,118 @@ void
 SatBasicCnoEstimator::ClearOutdatedSamples ()
 {
   NS_LOG_FUNCTION (this);
-  SampleMap_t::iterator itLastValid = m_samples.lower_bound (Simulator::Now () - m_window );
 
-  m_samples.erase (m_samples.begin (), itLastValid );
+  Time windowStart = Simulator::Now () - m_window;
+
+  while ( m_samplesSize > 0 && m_samples[m_samplesHead].first < windowStart )
+    {
+      double sample = m_samples[m_samplesHead].second;
+
+      if ( !std::isnan (sample) )
+        {
+          m_sum -= sample;
+          m_removedFromSum++;
+        }
+
+      m_samplesHead = (m_samplesHead + 1) % m_samples.size ();
+      m_samplesSize--;
+    }
+
+  while ( !m_minimums.empty () && m_minimums.front ().first < windowStart )
+    {
+      m_minimums.pop_front ();
+    }
+
+  // Calculate the sum again from the samples, when as many samples have
+  // been removed as there are left, so that the rounding errors of the
+  // removals do not accumulate. The cost stays constant per sample.
+  if ( m_samplesSize == 0 )
+    {
+      m_sum = 0.0;
+      m_removedFromSum = 0;
+    }
+  else if ( m_removedFromSum > m_samplesSize )
+    {
+      m_sum = 0.0;
+
+      for ( uint32_t i = 0; i < m_samplesSize; i++ )
+        {
+          double sample = m_samples[(m_samplesHead + i) % m_samples.size ()].second;
+
+          if ( !std::isnan (sample) )
+            {
+              m_sum += sample;
+            }
+        }
+
+      m_removedFromSum = 0;
+    }
+}
+
+void
+SatBasicCnoEstimator::PushSample (const Sample_t& sample)
+{
+  NS_LOG_FUNCTION (this);
+
+  if ( m_samplesSize == m_samples.size () )
+    {
+      // Grow the ring buffer, keeping the samples in time order
+      std::vector<Sample_t> samples (std::max<size_t> (8, 2 * m_samples.size ()));
+
+      for ( uint32_t i = 0; i < m_samplesSize; i++ )
+        {
+          samples[i] = m_samples[(m_samplesHead + i) % m_samples.size ()];
+        }
+
+      m_samples.swap (samples);
+      m_samplesHead = 0;
+    }
+
+  m_samples[(m_samplesHead + m_samplesSize) % m_samples.size ()] = sample;
+  m_samplesSize++;
+}
+
+void
+SatBasicCnoEstimator::ClearSamples ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_samplesHead = 0;
+  m_samplesSize = 0;
+  m_minimums.clear ();
+  m_sum = 0.0;
+  m_removedFromSum = 0;
+}
+
+double
+SatBasicCnoEstimator::GetPercentileValue ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_percentileValues.clear ();
+
+  for ( uint32_t i = 0; i < m_samplesSize; i++ )
+    {
+      double sample = m_samples[(m_samplesHead + i) % m_samples.size ()].second;
+
+      if ( !std::isnan (sample) )
+        {
+          m_percentileValues.push_back (sample);
+        }
+    }
+
+  if ( m_percentileValues.empty () )
+    {
+      return NAN;
+    }
+
+  // Nearest rank of the percentile
+  uint32_t rank = std::ceil (m_percentile / 100.0 * m_percentileValues.size ());
+  uint32_t index = (rank > 0) ? rank - 1 : 0;
+
+  std::nth_element (m_percentileValues.begin (), m_percentileValues.begin () + index, m_percentileValues.end ());
+
+  return m_percentileValues[index];
 }
 
 } // namespace ns3
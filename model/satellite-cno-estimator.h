@@ -21,7 +21,9 @@
 #ifndef SAT_CNO_ESTIMATOR
 #define SAT_CNO_ESTIMATOR
 
-#include <map>
+#include <cmath>
+#include <deque>
+#include <vector>
 
 #include "ns3/nstime.h"
 #include "ns3/simple-ref-count.h"
@@ -45,7 +47,9 @@ public:
   {
     LAST,   //!< Last value in the given window returned
     MINIMUM, //!< Minimum value in the given window returned
-    AVERAGE //!< Average value in the given window returned
+    AVERAGE, //!< Average value in the given window returned
+    EWMA, //!< Exponentially weighted moving average of the samples returned, if the last sample is in the given window
+    PERCENTILE //!< Percentile of the values in the given window returned
   } EstimationMode_t;
 
   /**
@@ -103,34 +107,23 @@ private:
  * This SatCnoEstimator class holds information of a satellite DAMA entry.
  * It's is created and used by NCC.
  *
- * It supports three dirrent modes:
+ * It supports five dirrent modes:
  *  - LAST: The last value in the window given when requested.
  *  - MINIMUM: The minimum value in the window given when requested.
  *  - AVERAGE: The average of the samples in window given when requested.
+ *  - EWMA: The exponentially weighted moving average of the samples given
+ *    when requested, if the last sample is in the window.
+ *  - PERCENTILE: The percentile of the samples in window given when requested.
+ *
+ * The samples in the window are kept in a ring buffer in time order. The
+ * minimum is kept in a monotonic deque and the average with a running sum,
+ * so that adding a sample and getting the estimation take constant time.
+ * The percentile is selected from the samples in the window when requested.
  *
  */
 class SatBasicCnoEstimator : public SatCnoEstimator
 {
 public:
-  /**
-   * Method to add a sample value to current sum.
-   *
-   * \param currentSum
-   * \param sample
-   * \return New sum after addition.
-   */
-  static inline double AddToSum (double currentSum, const std::pair<Time, double>& sample)
-  {
-    double newSum = currentSum;
-
-    if ( !std::isnan (sample.second) )
-      {
-        newSum += sample.second;
-      }
-
-    return newSum;
-  }
-
   /**
    * Default construct a SatCnoEstimator.
    */
@@ -148,10 +141,49 @@ public:
    */
   ~SatBasicCnoEstimator ();
 
+  /**
+   * Set the weight of a new sample in mode EWMA.
+   *
+   * \param weight Weight of a new sample, between 0 and 1
+   */
+  void SetEwmaWeight (double weight);
+
+  /**
+   * Set the percentile returned in mode PERCENTILE.
+   *
+   * \param percentile Percentile, between 0 and 100
+   */
+  void SetPercentile (double percentile);
+
 private:
-  typedef std::map<Time, double> SampleMap_t;
+  typedef std::pair<Time, double> Sample_t;
+
+  /**
+   * Ring buffer of the samples in the window, in time order
+   */
+  std::vector<Sample_t> m_samples;
+  uint32_t          m_samplesHead;
+  uint32_t          m_samplesSize;
+
+  /**
+   * Samples which may be the minimum of the window, in time order with increasing values
+   */
+  std::deque<Sample_t> m_minimums;
+
+  /**
+   * Sum of the valid sample values in the window, and the number of samples
+   * removed from the sum since it was last calculated from the samples
+   */
+  double            m_sum;
+  uint32_t          m_removedFromSum;
+
+  double            m_ewma;
+  Time              m_ewmaTime;
+  double            m_ewmaWeight;
+
+  double            m_percentile;
+  std::vector<double> m_percentileValues;
 
-  SampleMap_t       m_samples;
   Time              m_window;
   EstimationMode_t  m_mode;
 
@@ -174,6 +206,25 @@ private:
    * Clear outdated samples from storage.
    */
   void ClearOutdatedSamples ();
+
+  /**
+   * Add a sample to the end of the ring buffer.
+   *
+   * \param sample Time and value of the sample
+   */
+  void PushSample (const Sample_t& sample);
+
+  /**
+   * Remove all samples from storage.
+   */
+  void ClearSamples ();
+
+  /**
+   * Get the value of the given percentile of the samples in the window.
+   *
+   * \return Value of the percentile
+   */
+  double GetPercentileValue ();
 };
 
 } // namespace ns3
@@ -0,0 +1,315 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/log.h"
+
+#include "satellite-encap-index.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatEncapIndex");
+
+namespace ns3 {
+
+/**
+ * Initial number of slots in the hash table, must be a power of two
+ */
+static const uint32_t SAT_ENCAP_INDEX_MIN_SLOTS = 16;
+
+SatEncapIndex::SatEncapIndex ()
+  : m_slots (),
+  m_size (0),
+  m_usedSlots (0),
+  m_encapsPerSource (),
+  m_encapsPerDestination (),
+  m_emptyList ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint64_t
+SatEncapIndex::PackAddress (Mac48Address address)
+{
+  uint8_t buffer[6];
+  address.CopyTo (buffer);
+
+  uint64_t packed = 0;
+  for (uint32_t i = 0; i < 6; ++i)
+    {
+      packed = (packed << 8) | buffer[i];
+    }
+
+  return packed;
+}
+
+uint64_t
+SatEncapIndex::Hash (uint64_t source, uint64_t destFlow)
+{
+  // Mix the two words with the 64-bit finalizer of MurmurHash3
+  uint64_t h = source * 0x9E3779B97F4A7C15ULL ^ destFlow;
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ULL;
+  h ^= h >> 33;
+
+  return h;
+}
+
+uint32_t
+SatEncapIndex::Lookup (uint64_t source, uint64_t destFlow) const
+{
+  uint32_t slots = m_slots.size ();
+
+  if (slots == 0)
+    {
+      return 0;
+    }
+
+  uint32_t mask = slots - 1;
+  uint32_t i = Hash (source, destFlow) & mask;
+
+  // The table always has empty slots, thus the probing terminates
+  while (m_slots[i].m_state != SLOT_EMPTY)
+    {
+      if (m_slots[i].m_state == SLOT_USED
+          && m_slots[i].m_source == source
+          && m_slots[i].m_destFlow == destFlow)
+        {
+          return i;
+        }
+
+      i = (i + 1) & mask;
+    }
+
+  return slots;
+}
+
+void
+SatEncapIndex::Rehash (uint32_t slots)
+{
+  NS_LOG_FUNCTION (this << slots);
+
+  std::vector<Slot_t> old;
+  old.swap (m_slots);
+
+  Slot_t empty;
+  empty.m_source = 0;
+  empty.m_destFlow = 0;
+  empty.m_state = SLOT_EMPTY;
+  m_slots.assign (slots, empty);
+  m_usedSlots = 0;
+
+  uint32_t mask = slots - 1;
+
+  for (std::vector<Slot_t>::iterator it = old.begin (); it != old.end (); ++it)
+    {
+      if (it->m_state == SLOT_USED)
+        {
+          uint32_t i = Hash (it->m_source, it->m_destFlow) & mask;
+
+          while (m_slots[i].m_state != SLOT_EMPTY)
+            {
+              i = (i + 1) & mask;
+            }
+
+          m_slots[i] = *it;
+          m_usedSlots++;
+        }
+    }
+}
+
+bool
+SatEncapIndex::Insert (Ptr<EncapKey> key, Ptr<SatBaseEncapsulator> encap)
+{
+  NS_LOG_FUNCTION (this << key->m_source << key->m_destination << (uint32_t)(uint8_t) key->m_flowId);
+
+  uint64_t source = PackAddress (key->m_source);
+  uint64_t destination = PackAddress (key->m_destination);
+  uint64_t destFlow = (destination << 8) | (uint8_t) key->m_flowId;
+
+  if (Lookup (source, destFlow) < m_slots.size ())
+    {
+      return false;
+    }
+
+  // Keep the load factor, including the deleted slots, at most one half
+  if ((m_usedSlots + 1) * 2 > m_slots.size ())
+    {
+      uint32_t slots = SAT_ENCAP_INDEX_MIN_SLOTS;
+      while ((m_size + 1) * 2 > slots)
+        {
+          slots *= 2;
+        }
+      Rehash (slots);
+    }
+
+  uint32_t mask = m_slots.size () - 1;
+  uint32_t i = Hash (source, destFlow) & mask;
+
+  while (m_slots[i].m_state == SLOT_USED)
+    {
+      i = (i + 1) & mask;
+    }
+
+  if (m_slots[i].m_state == SLOT_EMPTY)
+    {
+      m_usedSlots++;
+    }
+
+  m_slots[i].m_source = source;
+  m_slots[i].m_destFlow = destFlow;
+  m_slots[i].m_state = SLOT_USED;
+  m_slots[i].m_key = key;
+  m_slots[i].m_encap = encap;
+  m_size++;
+
+  m_encapsPerSource[source].push_back (encap);
+  m_encapsPerDestination[destination].push_back (encap);
+
+  return true;
+}
+
+void
+SatEncapIndex::RemoveFromList (EncapsPerAddress_t &container, uint64_t address, Ptr<SatBaseEncapsulator> encap)
+{
+  EncapsPerAddress_t::iterator it = container.find (address);
+
+  if (it != container.end ())
+    {
+      for (EncapList_t::iterator lit = it->second.begin (); lit != it->second.end (); ++lit)
+        {
+          if (*lit == encap)
+            {
+              it->second.erase (lit);
+              break;
+            }
+        }
+
+      if (it->second.empty ())
+        {
+          container.erase (it);
+        }
+    }
+}
+
+bool
+SatEncapIndex::Erase (Mac48Address source, Mac48Address dest, uint8_t flowId)
+{
+  NS_LOG_FUNCTION (this << source << dest << (uint32_t) flowId);
+
+  uint64_t packedSource = PackAddress (source);
+  uint64_t packedDest = PackAddress (dest);
+  uint32_t i = Lookup (packedSource, (packedDest << 8) | flowId);
+
+  if (i >= m_slots.size ())
+    {
+      return false;
+    }
+
+  RemoveFromList (m_encapsPerSource, packedSource, m_slots[i].m_encap);
+  RemoveFromList (m_encapsPerDestination, packedDest, m_slots[i].m_encap);
+
+  m_slots[i].m_state = SLOT_DELETED;
+  m_slots[i].m_key = 0;
+  m_slots[i].m_encap = 0;
+  m_size--;
+
+  return true;
+}
+
+Ptr<SatBaseEncapsulator>
+SatEncapIndex::Find (Mac48Address source, Mac48Address dest, uint8_t flowId) const
+{
+  NS_LOG_FUNCTION (this << source << dest << (uint32_t) flowId);
+
+  uint32_t i = Lookup (PackAddress (source), (PackAddress (dest) << 8) | flowId);
+
+  if (i < m_slots.size ())
+    {
+      return m_slots[i].m_encap;
+    }
+
+  return 0;
+}
+
+Ptr<EncapKey>
+SatEncapIndex::FindKey (Mac48Address source, Mac48Address dest, uint8_t flowId) const
+{
+  NS_LOG_FUNCTION (this << source << dest << (uint32_t) flowId);
+
+  uint32_t i = Lookup (PackAddress (source), (PackAddress (dest) << 8) | flowId);
+
+  if (i < m_slots.size ())
+    {
+      return m_slots[i].m_key;
+    }
+
+  return 0;
+}
+
+const SatEncapIndex::EncapList_t &
+SatEncapIndex::GetBySource (Mac48Address source) const
+{
+  NS_LOG_FUNCTION (this << source);
+
+  EncapsPerAddress_t::const_iterator it = m_encapsPerSource.find (PackAddress (source));
+
+  if (it != m_encapsPerSource.end ())
+    {
+      return it->second;
+    }
+
+  return m_emptyList;
+}
+
+const SatEncapIndex::EncapList_t &
+SatEncapIndex::GetByDestination (Mac48Address dest) const
+{
+  NS_LOG_FUNCTION (this << dest);
+
+  EncapsPerAddress_t::const_iterator it = m_encapsPerDestination.find (PackAddress (dest));
+
+  if (it != m_encapsPerDestination.end ())
+    {
+      return it->second;
+    }
+
+  return m_emptyList;
+}
+
+void
+SatEncapIndex::Clear ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_slots.clear ();
+  m_size = 0;
+  m_usedSlots = 0;
+  m_encapsPerSource.clear ();
+  m_encapsPerDestination.clear ();
+}
+
+uint32_t
+SatEncapIndex::GetSize () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return m_size;
+}
+
+} // namespace ns3
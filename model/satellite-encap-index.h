@@ -0,0 +1,240 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_ENCAP_INDEX_H_
+#define SATELLITE_ENCAP_INDEX_H_
+
+#include <vector>
+#include <map>
+#include <stdint.h>
+#include <ns3/ptr.h>
+#include <ns3/simple-ref-count.h>
+#include <ns3/mac48-address.h>
+#include <ns3/satellite-base-encapsulator.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ * \brief EncapKey class is used as a key in the encapsulator/decapsulator container. It
+ * will hold the flow information related to one single encapsulator/decapsulator.
+ */
+class EncapKey : public SimpleRefCount <EncapKey>
+{
+public:
+  Mac48Address  m_source;
+  Mac48Address  m_destination;
+  int8_t        m_flowId;
+
+  EncapKey (const Mac48Address source, const Mac48Address dest, const uint8_t flowId)
+    : m_source (source),
+    m_destination (dest),
+    m_flowId (flowId)
+  {
+  }
+};
+
+/**
+ * \ingroup satellite
+ * \brief EncapKeyCompare is used as a custom compare method within
+ * EncapContainer map. Encap key has three member variables (source
+ * address, dest address and flow id) and to be able to store them in
+ * a map container, a custom compare method needs to be implemented.
+ */
+class EncapKeyCompare
+{
+public:
+  bool operator() (Ptr<EncapKey> key1, Ptr<EncapKey> key2) const
+  {
+    if ( key1->m_source == key2->m_source )
+      {
+        if ( key1->m_destination == key2->m_destination )
+          {
+            return key1->m_flowId < key2->m_flowId;
+          }
+        else
+          {
+            return key1->m_destination < key2->m_destination;
+          }
+      }
+    else
+      {
+        return key1->m_source < key2->m_source;
+      }
+  }
+};
+
+/**
+ * \ingroup satellite
+ * \brief SatEncapIndex is an open addressing hash table used by the LLC to
+ * find encapsulators and decapsulators per packet. The key is packed by value
+ * from the source address, destination address and flow id, thus no EncapKey
+ * needs to be allocated for a lookup. The index also keeps the encapsulators
+ * grouped by source and by destination address for the per UT queries.
+ *
+ * The index does not own the ordering of the encapsulators, the ordered
+ * EncapContainer map is still used when the encapsulators are iterated.
+ */
+class SatEncapIndex
+{
+public:
+  /**
+   * Container of encapsulators related to one address
+   */
+  typedef std::vector< Ptr<SatBaseEncapsulator> > EncapList_t;
+
+  /**
+   * Default constructor
+   */
+  SatEncapIndex ();
+
+  /**
+   * \brief Add an encapsulator to the index.
+   * \param key Key of the encapsulator
+   * \param encap Encapsulator
+   * \return false if the key is already in the index, otherwise true
+   */
+  bool Insert (Ptr<EncapKey> key, Ptr<SatBaseEncapsulator> encap);
+
+  /**
+   * \brief Remove an encapsulator from the index.
+   * \param source Source MAC address
+   * \param dest Destination MAC address
+   * \param flowId Flow identifier
+   * \return false if the key is not in the index, otherwise true
+   */
+  bool Erase (Mac48Address source, Mac48Address dest, uint8_t flowId);
+
+  /**
+   * \brief Find an encapsulator.
+   * \param source Source MAC address
+   * \param dest Destination MAC address
+   * \param flowId Flow identifier
+   * \return Encapsulator or NULL if not found
+   */
+  Ptr<SatBaseEncapsulator> Find (Mac48Address source, Mac48Address dest, uint8_t flowId) const;
+
+  /**
+   * \brief Find the stored key of an encapsulator.
+   * \param source Source MAC address
+   * \param dest Destination MAC address
+   * \param flowId Flow identifier
+   * \return Key or NULL if not found
+   */
+  Ptr<EncapKey> FindKey (Mac48Address source, Mac48Address dest, uint8_t flowId) const;
+
+  /**
+   * \brief Get the encapsulators with the given source address.
+   * \param source Source MAC address
+   * \return Encapsulators, empty if none
+   */
+  const EncapList_t & GetBySource (Mac48Address source) const;
+
+  /**
+   * \brief Get the encapsulators with the given destination address.
+   * \param dest Destination MAC address
+   * \return Encapsulators, empty if none
+   */
+  const EncapList_t & GetByDestination (Mac48Address dest) const;
+
+  /**
+   * \brief Remove all the encapsulators from the index.
+   */
+  void Clear ();
+
+  /**
+   * \brief Get the number of encapsulators in the index.
+   * \return Number of encapsulators
+   */
+  uint32_t GetSize () const;
+
+private:
+  /**
+   * Slot states of the hash table
+   */
+  typedef enum
+  {
+    SLOT_EMPTY,
+    SLOT_USED,
+    SLOT_DELETED
+  } SlotState_t;
+
+  /**
+   * One slot of the hash table
+   */
+  typedef struct
+  {
+    uint64_t m_source;
+    uint64_t m_destFlow;
+    uint8_t m_state;
+    Ptr<EncapKey> m_key;
+    Ptr<SatBaseEncapsulator> m_encap;
+  } Slot_t;
+
+  typedef std::map<uint64_t, EncapList_t> EncapsPerAddress_t;
+
+  /**
+   * \brief Pack a MAC address to an integer.
+   * \param address MAC address
+   * \return Address as integer
+   */
+  static uint64_t PackAddress (Mac48Address address);
+
+  /**
+   * \brief Calculate the hash of a packed key.
+   * \param source Packed source address
+   * \param destFlow Packed destination address and flow id
+   * \return Hash value
+   */
+  static uint64_t Hash (uint64_t source, uint64_t destFlow);
+
+  /**
+   * \brief Find the slot of a packed key.
+   * \param source Packed source address
+   * \param destFlow Packed destination address and flow id
+   * \return Slot index or the number of slots if not found
+   */
+  uint32_t Lookup (uint64_t source, uint64_t destFlow) const;
+
+  /**
+   * \brief Re-insert all the used slots to a table of given size.
+   * \param slots Number of slots, power of two
+   */
+  void Rehash (uint32_t slots);
+
+  /**
+   * \brief Remove an encapsulator from an address list.
+   * \param container Address container
+   * \param address Packed address
+   * \param encap Encapsulator to remove
+   */
+  static void RemoveFromList (EncapsPerAddress_t &container, uint64_t address, Ptr<SatBaseEncapsulator> encap);
+
+  std::vector<Slot_t> m_slots;
+  uint32_t m_size;
+  uint32_t m_usedSlots;
+
+  EncapsPerAddress_t m_encapsPerSource;
+  EncapsPerAddress_t m_encapsPerDestination;
+  EncapList_t m_emptyList;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_ENCAP_INDEX_H_ */
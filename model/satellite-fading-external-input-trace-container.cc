@@ -96,6 +96,7 @@ SatFadingExternalInputTraceContainer::~SatFadingExternalInputTraceContainer ()
 
   m_utFadingMap.clear ();
   m_gwFadingMap.clear ();
+  m_loadedTraces.clear ();
 }
 
 void
@@ -381,12 +382,14 @@ SatFadingExternalInputTraceContainer::CreateFadingTrace (SatFadingExternalInputT
 
   // find from loaded list
 
-  TraceInputContainer_t::iterator it = m_loadedTraces.find (fileName);
+  TraceInputContainer_t::key_type key = std::make_pair (fileName, fileType);
+  TraceInputContainer_t::iterator it = m_loadedTraces.find (key);
 
   if ( it == m_loadedTraces.end ())
     {
       // create if not found
       trace = Create<SatFadingExternalInputTrace> (fileType, m_dataPath + fileName);
+      m_loadedTraces.insert (std::make_pair (key, trace));
     }
   else
     {
@@ -100,7 +100,7 @@ private:
   typedef std::pair <std::string, GeoCoordinate > TraceFileContainerItem_t;
   typedef std::vector<TraceFileContainerItem_t> TraceFileContainer_t;
 
-  typedef std::map<std::string, Ptr<SatFadingExternalInputTrace> > TraceInputContainer_t;
+  typedef std::map<std::pair<std::string, SatFadingExternalInputTrace::TraceFileType_e>, Ptr<SatFadingExternalInputTrace> > TraceInputContainer_t;
 
   /**
    * Container of the UT fading traces
@@ -162,7 +162,7 @@ private:
   TraceFileContainer_t  m_gwRtnDownFileNames;
 
   /**
-   * Loaded trace files
+   * Loaded trace files, shared between all the nodes using the same file
    */
   TraceInputContainer_t m_loadedTraces;
 
@@ -18,8 +18,12 @@
  * Author: Jani Puttonen <jani.puttonen@magister.fi>
  */
 
-#include <fstream>
 #include <algorithm>
+#include <cmath>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "ns3/simulator.h"
 #include "ns3/log.h"
 #include "satellite-fading-external-input-trace.h"
@@ -33,14 +37,24 @@ namespace ns3 {
 SatFadingExternalInputTrace::SatFadingExternalInputTrace ()
   : m_traceFileType (),
   m_startTime (),
-  m_timeInterval ()
+  m_timeInterval (),
+  m_columns (0),
+  m_rows (0),
+  m_traceData (0),
+  m_mapping (0),
+  m_mappingLength (0)
 {
   NS_FATAL_ERROR ("SatFadingExternalInputTrace::SatFadingExternalInputTrace - Constructor not in use");
 }
 
 SatFadingExternalInputTrace::SatFadingExternalInputTrace (TraceFileType_e type, std::string fileName)
   : m_startTime (-1.0),
-  m_timeInterval (-1.0)
+  m_timeInterval (-1.0),
+  m_columns (0),
+  m_rows (0),
+  m_traceData (0),
+  m_mapping (0),
+  m_mappingLength (0)
 {
   NS_LOG_FUNCTION (this);
 
@@ -52,6 +66,11 @@ SatFadingExternalInputTrace::SatFadingExternalInputTrace (TraceFileType_e type,
 SatFadingExternalInputTrace::~SatFadingExternalInputTrace ()
 {
   NS_LOG_FUNCTION (this);
+
+  if (m_mapping != 0)
+    {
+      munmap (m_mapping, m_mappingLength);
+    }
 }
 
 
@@ -59,65 +78,77 @@ void SatFadingExternalInputTrace::ReadTrace (std::string filePathName)
 {
   NS_LOG_FUNCTION (this << filePathName);
 
-  // READ FROM THE SPECIFIED INPUT FILE
-  std::ifstream *ifs = new std::ifstream (filePathName.c_str (), std::ios::in | std::ios::binary);
+  // OPEN THE SPECIFIED INPUT FILE
+  int fd = open (filePathName.c_str (), O_RDONLY);
 
-  if (!ifs->is_open ())
+  if (fd < 0)
     {
       // script might be launched by test.py, try a different base path
-      delete ifs;
       filePathName = "../../" + filePathName;
-      ifs = new std::ifstream (filePathName.c_str (), std::ifstream::in);
+      fd = open (filePathName.c_str (), O_RDONLY);
 
-      if (!ifs->is_open ())
+      if (fd < 0)
         {
           NS_FATAL_ERROR ("The file " << filePathName << " is not found.");
         }
     }
 
   // Currently supports two or three column formats
-  uint32_t columns = (m_traceFileType == FT_TWO_COLUMN) ? 2 : 3;
-
-  float temp;
-  int32_t count (0);
-  std::vector<float> values;
-  ifs->read ((char*)&temp, sizeof(float));
-  m_startTime = temp;
+  m_columns = (m_traceFileType == FT_TWO_COLUMN) ? 2 : 3;
 
-  // While state is good
-  while (ifs->good ())
+  struct stat st;
+  if (fstat (fd, &st) != 0)
     {
-      // Store previous value
-      values.push_back (temp);
+      close (fd);
+      NS_FATAL_ERROR ("The file " << filePathName << " cannot be read.");
+    }
+
+  // Only complete rows are used
+  m_rows = st.st_size / (m_columns * sizeof (float));
 
-      // Read the new value
-      ++count;
-      ifs->read ((char*)&temp, sizeof(float));
+  if (m_rows > 0)
+    {
+      void *mapping = mmap (0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
 
-      // Handle previous value
-      if (count % columns == 0)
+      if (mapping != MAP_FAILED)
         {
-          NS_ASSERT (values.size () == columns);
+          m_mapping = mapping;
+          m_mappingLength = st.st_size;
+          m_traceData = static_cast<const float *> (mapping);
+        }
+      else
+        {
+          NS_LOG_WARN ("Mapping the file " << filePathName << " failed, reading it to memory");
 
-          m_traceVector.push_back (values);
-          values.clear ();
+          m_traceBuffer.resize (m_rows * m_columns);
+          ssize_t length = m_traceBuffer.size () * sizeof (float);
 
-          // Calculate the sampling interval
-          if (m_timeInterval < 0.0)
+          if (pread (fd, &m_traceBuffer[0], length, 0) != length)
             {
-              m_timeInterval = temp - m_startTime;
+              close (fd);
+              NS_FATAL_ERROR ("The file " << filePathName << " cannot be read.");
             }
+
+          m_traceData = &m_traceBuffer[0];
+        }
+
+      m_startTime = GetValue (0, TIME_INDEX);
+
+      // Calculate the sampling interval
+      if (m_rows > 1)
+        {
+          m_timeInterval = GetValue (1, TIME_INDEX) - m_startTime;
         }
     }
-  ifs->close ();
-  delete ifs;
+
+  close (fd);
 }
 
 double
 SatFadingExternalInputTrace::GetFading () const
 {
   NS_LOG_FUNCTION (this);
-  NS_ASSERT (!m_traceVector.empty ());
+  NS_ASSERT (m_rows > 0);
 
   float simTime = Simulator::Now ().GetSeconds ();
 
@@ -129,17 +160,17 @@ SatFadingExternalInputTrace::GetFading () const
   // Calculate the index to the time sample just before current time
   uint32_t lowerIndex = (uint32_t)(std::floor (std::abs (simTime - m_startTime) / m_timeInterval));
 
-  if (lowerIndex >= m_traceVector.size ())
+  if (lowerIndex + 1 >= m_rows)
     {
-      NS_LOG_ERROR (this << " calculated index exceeds trace file size!");
+      NS_FATAL_ERROR (this << " calculated index exceeds trace file size!");
     }
 
-  float lowerKey = m_traceVector.at (lowerIndex).at (TIME_INDEX);
-  float upperKey = m_traceVector.at (lowerIndex + 1).at (TIME_INDEX);
+  float lowerKey = GetValue (lowerIndex, TIME_INDEX);
+  float upperKey = GetValue (lowerIndex + 1, TIME_INDEX);
 
   // Interpolation in linear domain
-  float lowerVal = SatUtils::DbToLinear (m_traceVector.at (lowerIndex).at (FADING_INDEX));
-  float upperVal = SatUtils::DbToLinear (m_traceVector.at (lowerIndex + 1).at (FADING_INDEX));
+  float lowerVal = SatUtils::DbToLinear (GetValue (lowerIndex, FADING_INDEX));
+  float upperVal = SatUtils::DbToLinear (GetValue (lowerIndex + 1, FADING_INDEX));
 
   // y = y0 + (y1 - y0) * (x - x0) / (x1 - x0)
   double fading = lowerVal + (upperVal - lowerVal)
@@ -161,17 +192,16 @@ bool
 SatFadingExternalInputTrace::TestFadingTrace () const
 {
   NS_LOG_FUNCTION (this);
-  NS_ASSERT (!m_traceVector.empty ());
+  NS_ASSERT (m_rows > 0);
 
-  std::vector<std::vector<float> >::const_iterator cit;
   float prevTime (-1.0);
   float currTime (-1.0);
 
-  for (cit = m_traceVector.begin (); cit != m_traceVector.end (); ++cit)
+  for (uint32_t row = 0; row < m_rows; ++row)
     {
       if (prevTime > 0)
         {
-          currTime = cit->at (TIME_INDEX);
+          currTime = GetValue (row, TIME_INDEX);
           double diff = std::abs ( std::abs (currTime - prevTime) - m_timeInterval);
 
           // Test that the the time samples are from constant interval and
@@ -181,7 +211,7 @@ SatFadingExternalInputTrace::TestFadingTrace () const
               return false;
             }
         }
-      prevTime = cit->at (TIME_INDEX);
+      prevTime = GetValue (row, TIME_INDEX);
     }
 
   // Succeeded
@@ -28,9 +28,10 @@ namespace ns3 {
 
 /**
  * \ingroup satellite
- * \brief The class for satellite fading external input trace. The class reads
- * fading trace input samples from a file and provides the current fading value
- * for this specific fading file.
+ * \brief The class for satellite fading external input trace. The class maps
+ * fading trace input samples from a file into memory and provides the current
+ * fading value for this specific fading file. The same object is shared by all
+ * the nodes using the same fading file.
  */
 class SatFadingExternalInputTrace : public SimpleRefCount <SatFadingExternalInputTrace>
 {
@@ -73,11 +74,23 @@ public:
 
 private:
   /**
-   * Read the fading trace from a binary file
+   * Map the fading trace from a binary file. If the file cannot be
+   * mapped, it is read into m_traceBuffer instead.
    * \param filePathName Path and file name of the fading file
    */
   void ReadTrace (std::string filePathName);
 
+  /**
+   * Get a value from the fading trace
+   * \param row Row (time sample) index
+   * \param column Column index
+   * \return the value
+   */
+  inline float GetValue (uint32_t row, uint32_t column) const
+  {
+    return m_traceData[row * m_columns + column];
+  }
+
   /**
    * There may be different fading file types.
    * - FT_TWO_COLUMN
@@ -107,9 +120,31 @@ private:
   float m_timeInterval;
 
   /**
-   * Container for the fading trace.
+   * Number of columns in the fading trace.
+   */
+  uint32_t m_columns;
+
+  /**
+   * Number of complete rows (time samples) in the fading trace.
+   */
+  uint32_t m_rows;
+
+  /**
+   * Fading trace as a flat row-major array, pointing either to the mapped
+   * file or to m_traceBuffer.
+   */
+  const float *m_traceData;
+
+  /**
+   * Start and length of the mapped file, zero if the file is not mapped.
+   */
+  void *m_mapping;
+  size_t m_mappingLength;
+
+  /**
+   * Container for the fading trace, used only if the file cannot be mapped.
    */
-  std::vector<std::vector<float> > m_traceVector;
+  std::vector<float> m_traceBuffer;
 };
 
 } // namespace ns3
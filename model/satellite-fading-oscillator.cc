@@ -92,4 +92,155 @@ SatFadingOscillator::DoDispose ()
   Object::DoDispose ();
 }
 
+SatFadingOscillatorBank::SatFadingOscillatorBank ()
+  : m_amplitudeReal (),
+  m_amplitudeImag (),
+  m_phase (),
+  m_omega (),
+  m_phaseAt (),
+  m_cosine (),
+  m_sine ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatFadingOscillatorBank::AddOscillator (std::complex<double> amplitude, double initialPhase, double omega)
+{
+  NS_LOG_FUNCTION (this << amplitude << " " << initialPhase << " " << omega);
+
+  m_amplitudeReal.push_back (amplitude.real ());
+  m_amplitudeImag.push_back (amplitude.imag ());
+  m_phase.push_back (initialPhase);
+  m_omega.push_back (omega);
+
+  m_phaseAt.resize (m_phase.size ());
+  m_cosine.resize (m_phase.size ());
+  m_sine.resize (m_phase.size ());
+}
+
+void
+SatFadingOscillatorBank::AddOscillator (double amplitude, double initialPhase, double omega)
+{
+  NS_LOG_FUNCTION (this << amplitude << " " << initialPhase << " " << omega);
+
+  AddOscillator (std::complex<double> (amplitude, 0.0), initialPhase, omega);
+}
+
+uint32_t
+SatFadingOscillatorBank::GetSize () const
+{
+  return m_phase.size ();
+}
+
+void
+SatFadingOscillatorBank::Clear ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_amplitudeReal.clear ();
+  m_amplitudeImag.clear ();
+  m_phase.clear ();
+  m_omega.clear ();
+  m_phaseAt.clear ();
+  m_cosine.clear ();
+  m_sine.clear ();
+}
+
+void
+SatFadingOscillatorBank::ComputePhases (double timeInSeconds)
+{
+  const uint32_t size = m_phase.size ();
+  const double* omega = m_omega.data ();
+  const double* phase = m_phase.data ();
+  double* phaseAt = m_phaseAt.data ();
+
+  for (uint32_t i = 0; i < size; i++)
+    {
+      phaseAt[i] = timeInSeconds * omega[i] + phase[i];
+    }
+}
+
+std::complex<double>
+SatFadingOscillatorBank::GetComplexSumAt (double timeInSeconds)
+{
+  NS_LOG_FUNCTION (this << timeInSeconds);
+
+  std::complex<double> sum;
+  GetComplexSumsAt (&timeInSeconds, 1, &sum);
+  return sum;
+}
+
+std::complex<double>
+SatFadingOscillatorBank::GetCosineWaveSumAt (double timeInSeconds)
+{
+  NS_LOG_FUNCTION (this << timeInSeconds);
+
+  std::complex<double> sum;
+  GetCosineWaveSumsAt (&timeInSeconds, 1, &sum);
+  return sum;
+}
+
+void
+SatFadingOscillatorBank::GetComplexSumsAt (const double* timesInSeconds, uint32_t count, std::complex<double>* sums)
+{
+  NS_LOG_FUNCTION (this << count);
+
+  const uint32_t size = m_phase.size ();
+  const double* phaseAt = m_phaseAt.data ();
+  double* cosine = m_cosine.data ();
+
+  for (uint32_t t = 0; t < count; t++)
+    {
+      ComputePhases (timesInSeconds[t]);
+
+      for (uint32_t i = 0; i < size; i++)
+        {
+          cosine[i] = std::cos (phaseAt[i]);
+        }
+
+      // accumulate in the oscillator order to keep the results of
+      // summing SatFadingOscillator::GetComplexValueAt
+      double sumReal = 0.0;
+      double sumImag = 0.0;
+      for (uint32_t i = 0; i < size; i++)
+        {
+          sumReal += m_amplitudeReal[i] * cosine[i];
+          sumImag += m_amplitudeImag[i] * cosine[i];
+        }
+      sums[t] = std::complex<double> (sumReal, sumImag);
+    }
+}
+
+void
+SatFadingOscillatorBank::GetCosineWaveSumsAt (const double* timesInSeconds, uint32_t count, std::complex<double>* sums)
+{
+  NS_LOG_FUNCTION (this << count);
+
+  const uint32_t size = m_phase.size ();
+  const double* phaseAt = m_phaseAt.data ();
+  double* cosine = m_cosine.data ();
+  double* sine = m_sine.data ();
+
+  for (uint32_t t = 0; t < count; t++)
+    {
+      ComputePhases (timesInSeconds[t]);
+
+      for (uint32_t i = 0; i < size; i++)
+        {
+          cosine[i] = std::cos (phaseAt[i]);
+          sine[i] = std::sin (phaseAt[i]);
+        }
+
+      // accumulate in the oscillator order to keep the results of
+      // summing SatFadingOscillator::GetCosineWaveValueAt
+      std::complex<double> sum (0.0, 0.0);
+      for (uint32_t i = 0; i < size; i++)
+        {
+          sum += m_amplitudeReal[i] * std::exp (std::complex<double> (cosine[i], sine[i]));
+        }
+      sums[t] = sum;
+    }
+}
+
 } // namespace ns3
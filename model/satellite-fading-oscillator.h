@@ -25,6 +25,7 @@
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include <complex>
+#include <vector>
 
 namespace ns3 {
 
@@ -113,6 +114,124 @@ private:
 
 };
 
+/**
+ * \ingroup satellite
+ *
+ * \brief Bank of fading oscillators stored as structure of arrays.
+ * The bank gives the same values as summing the corresponding
+ * SatFadingOscillator objects in the order they were added, but keeps
+ * amplitudes, phases and rotation speeds in contiguous arrays so that the
+ * phase and trigonometric evaluation runs in simple loops the compiler is
+ * able to vectorize.
+ */
+class SatFadingOscillatorBank
+{
+public:
+  /**
+   * \brief Constructor
+   */
+  SatFadingOscillatorBank ();
+
+  /**
+   * \brief Add an oscillator with complex amplitude
+   * \param amplitude amplitude
+   * \param initialPhase initial phase
+   * \param omega rotation speed
+   */
+  void AddOscillator (std::complex<double> amplitude, double initialPhase, double omega);
+
+  /**
+   * \brief Add an oscillator with real amplitude
+   * \param amplitude amplitude
+   * \param initialPhase initial phase
+   * \param omega rotation speed
+   */
+  void AddOscillator (double amplitude, double initialPhase, double omega);
+
+  /**
+   * \brief Get the number of oscillators in the bank
+   * \return number of oscillators
+   */
+  uint32_t GetSize () const;
+
+  /**
+   * \brief Remove all oscillators from the bank
+   */
+  void Clear ();
+
+  /**
+   * \brief Sum of SatFadingOscillator::GetComplexValueAt over the bank
+   * \param timeInSeconds time in seconds
+   * \return complex sum
+   */
+  std::complex<double> GetComplexSumAt (double timeInSeconds);
+
+  /**
+   * \brief Sum of SatFadingOscillator::GetCosineWaveValueAt over the bank
+   * \param timeInSeconds time in seconds
+   * \return complex sum
+   */
+  std::complex<double> GetCosineWaveSumAt (double timeInSeconds);
+
+  /**
+   * \brief Evaluate GetComplexSumAt at several times
+   * \param timesInSeconds times in seconds
+   * \param count number of times
+   * \param sums complex sums, one per time
+   */
+  void GetComplexSumsAt (const double* timesInSeconds, uint32_t count, std::complex<double>* sums);
+
+  /**
+   * \brief Evaluate GetCosineWaveSumAt at several times
+   * \param timesInSeconds times in seconds
+   * \param count number of times
+   * \param sums complex sums, one per time
+   */
+  void GetCosineWaveSumsAt (const double* timesInSeconds, uint32_t count, std::complex<double>* sums);
+
+private:
+  /**
+   * \brief Compute the phases of all oscillators at a time
+   * \param timeInSeconds time in seconds
+   */
+  void ComputePhases (double timeInSeconds);
+
+  /**
+   * \brief Real parts of the amplitudes
+   */
+  std::vector<double> m_amplitudeReal;
+
+  /**
+   * \brief Imaginary parts of the amplitudes
+   */
+  std::vector<double> m_amplitudeImag;
+
+  /**
+   * \brief Initial phases
+   */
+  std::vector<double> m_phase;
+
+  /**
+   * \brief Rotation speeds
+   */
+  std::vector<double> m_omega;
+
+  /**
+   * \brief Scratch buffer for the phases at the evaluated time
+   */
+  std::vector<double> m_phaseAt;
+
+  /**
+   * \brief Scratch buffer for the cosines of the phases
+   */
+  std::vector<double> m_cosine;
+
+  /**
+   * \brief Scratch buffer for the sines of the phases
+   */
+  std::vector<double> m_sine;
+};
+
 } // namespace ns3
 
 #endif /* SATELLITE_FADING_OSCILLATOR_H */
@@ -0,0 +1,433 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+#include "ns3/singleton.h"
+#include "satellite-flat-interference.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatFlatInterference");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatFlatPerPacketInterference);
+
+TypeId
+SatFlatPerPacketInterference::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatFlatPerPacketInterference")
+    .SetParent<SatInterference> ()
+    .AddConstructor<SatFlatPerPacketInterference> ();
+
+  return tid;
+}
+
+TypeId
+SatFlatPerPacketInterference::GetInstanceTypeId (void) const
+{
+  NS_LOG_FUNCTION (this);
+
+  return GetTypeId ();
+}
+
+SatFlatPerPacketInterference::SatFlatPerPacketInterference ()
+  : m_changes (),
+  m_head (0),
+  m_prefixPowerW (1, 0.0),
+  m_prefixValidUntil (0),
+  m_residualPowerW (0.0),
+  m_rxing (false),
+  m_nextEventId (0),
+  m_enableTraceOutput (false),
+  m_channelType (),
+  m_rxBandwidth_Hz ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SatFlatPerPacketInterference::SatFlatPerPacketInterference (SatEnums::ChannelType_t channelType, double rxBandwidthHz)
+  : m_changes (),
+  m_head (0),
+  m_prefixPowerW (1, 0.0),
+  m_prefixValidUntil (0),
+  m_residualPowerW (0.0),
+  m_rxing (false),
+  m_nextEventId (0),
+  m_enableTraceOutput (true),
+  m_channelType (channelType),
+  m_rxBandwidth_Hz (rxBandwidthHz)
+{
+  NS_LOG_FUNCTION (this << channelType << rxBandwidthHz);
+
+  if (m_rxBandwidth_Hz <= std::numeric_limits<double>::epsilon ())
+    {
+      NS_FATAL_ERROR ("SatFlatPerPacketInterference::SatFlatPerPacketInterference - Invalid value");
+    }
+}
+
+SatFlatPerPacketInterference::~SatFlatPerPacketInterference ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Reset ();
+}
+
+Ptr<SatInterference::InterferenceChangeEvent>
+SatFlatPerPacketInterference::DoAdd (Time duration, double power, Address rxAddress)
+{
+  NS_LOG_FUNCTION (this << duration << power << rxAddress );
+
+  Ptr<SatInterference::InterferenceChangeEvent> event;
+  event = Create<SatInterference::InterferenceChangeEvent> (m_nextEventId++, duration, power, rxAddress);
+  Time now = event->GetStartTime ();
+
+  NS_LOG_INFO ( "Add change: Duration= " << duration << ", Power= " << power << ", Time: " << now );
+
+  bool residualChanged = false;
+
+  // do update and clean-ups, if we are not receiving
+  if (!m_rxing)
+    {
+      while (m_head < m_changes.size () && m_changes[m_head].time <= now)
+        {
+          NS_LOG_INFO ( "Change to erase: Time= " << m_changes[m_head].time << ", Id= " << m_changes[m_head].eventId
+                                                  << ", PowerValue= " << m_changes[m_head].powerW);
+
+          m_residualPowerW += m_changes[m_head].powerW;
+          m_head++;
+          residualChanged = true;
+
+          NS_LOG_INFO ( "First power after erase: " << m_residualPowerW);
+        }
+
+      // reuse the front of the array once more than half of it has expired
+      if (m_head > 0 && m_head >= m_changes.size () / 2)
+        {
+          m_changes.erase (m_changes.begin (), m_changes.begin () + m_head);
+          m_prefixPowerW.resize (m_changes.size () + 1);
+          m_head = 0;
+          residualChanged = true;
+        }
+    }
+
+  NS_LOG_INFO ( "Change count before addition: " << m_changes.size () - m_head );
+
+  // if no changes in future, first power should be zero
+  if ( m_changes.size () == m_head )
+    {
+      if ( ( m_residualPowerW != 0 ) && std::fabs (m_residualPowerW) < std::numeric_limits<long double>::epsilon () )
+        {
+          // if we end up here,
+          // reset first power (this probably due to roundin problem with very small values)
+          m_residualPowerW = 0;
+          residualChanged = true;
+        }
+    }
+
+  if (residualChanged)
+    {
+      ResetPrefixSum ();
+    }
+
+  InterferenceChange_t startChange = {now, event->GetId (), power, false};
+  InterferenceChange_t endChange = {event->GetEndTime (), event->GetId (), -(long double) power, true};
+  InsertChange (startChange);
+  InsertChange (endChange);
+
+  NS_LOG_INFO ( "Change count after addition: " << m_changes.size () - m_head );
+
+  if ( m_residualPowerW < 0 )
+    {
+      // First power should never leak negative
+      NS_FATAL_ERROR ("First power negative!!!");
+    }
+
+  return event;
+}
+
+void
+SatFlatPerPacketInterference::InsertChange (const InterferenceChange_t& change)
+{
+  NS_LOG_FUNCTION (this << change.time << change.eventId);
+
+  // insert after changes with the same time, as std::multimap does
+  std::vector<InterferenceChange_t>::iterator position =
+    std::upper_bound (m_changes.begin () + m_head, m_changes.end (), change.time,
+                      [] (const Time& time, const InterferenceChange_t& item)
+                      {
+                        return time < item.time;
+                      });
+
+  uint32_t index = position - m_changes.begin ();
+  m_changes.insert (position, change);
+  m_prefixPowerW.resize (m_changes.size () + 1);
+
+  // power before the inserted change is not affected
+  m_prefixValidUntil = std::min (m_prefixValidUntil, index);
+}
+
+uint32_t
+SatFlatPerPacketInterference::FindChange (Time time, uint32_t eventId, bool isEndEvent) const
+{
+  NS_LOG_FUNCTION (this << time << eventId << isEndEvent);
+
+  std::vector<InterferenceChange_t>::const_iterator it =
+    std::lower_bound (m_changes.begin () + m_head, m_changes.end (), time,
+                      [] (const InterferenceChange_t& item, const Time& time)
+                      {
+                        return item.time < time;
+                      });
+
+  for (; it != m_changes.end () && it->time == time; ++it)
+    {
+      if (it->eventId == eventId && it->isEndEvent == isEndEvent)
+        {
+          return it - m_changes.begin ();
+        }
+    }
+
+  return m_changes.size ();
+}
+
+double
+SatFlatPerPacketInterference::GetPowerBefore (uint32_t index)
+{
+  NS_LOG_FUNCTION (this << index);
+
+  // extend the prefix sum with the same operations as a full walk
+  // over the changes, so that the rounding is identical
+  while (m_prefixValidUntil < index)
+    {
+      double ifPowerW = m_prefixPowerW[m_prefixValidUntil];
+      ifPowerW += m_changes[m_prefixValidUntil].powerW;
+      m_prefixPowerW[++m_prefixValidUntil] = ifPowerW;
+    }
+
+  return m_prefixPowerW[index];
+}
+
+void
+SatFlatPerPacketInterference::ResetPrefixSum ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_prefixPowerW[m_head] = m_residualPowerW;
+  m_prefixValidUntil = m_head;
+}
+
+std::vector< std::pair<double, double> >
+SatFlatPerPacketInterference::DoCalculate (Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+  NS_LOG_FUNCTION (this);
+
+  if ( m_rxing == false )
+    {
+      NS_FATAL_ERROR ("Receiving is not set on!!!");
+    }
+
+  double rxDuration = event->GetDuration ().GetDouble ();
+  double rxEndTime = event->GetEndTime ().GetDouble ();
+
+  uint32_t startIndex = FindChange (event->GetStartTime (), event->GetId (), false);
+  uint32_t endIndex = FindChange (event->GetEndTime (), event->GetId (), true);
+  double ifPowerW;
+
+  if (startIndex < endIndex)
+    {
+      // own event is not updated to ifPower, changes after own 'start'
+      // are weighted with the relative part of duration
+      ifPowerW = GetPowerBefore (startIndex);
+      onOwnStartReached (ifPowerW);
+
+      for (uint32_t i = startIndex + 1; i < endIndex; i++)
+        {
+          double itemTime = m_changes[i].time.GetDouble ();
+          onInterferentEvent (((rxEndTime - itemTime) / rxDuration), m_changes[i].powerW, ifPowerW);
+
+          NS_LOG_INFO ( "Update (partial): ID: " << m_changes[i].eventId << ", Power (W)= " << m_changes[i].powerW <<
+                        ", Time= " << m_changes[i].time << ", DeltaTime= " << (rxEndTime - itemTime) );
+        }
+    }
+  else
+    {
+      // own 'start' has expired, all changes until own 'stop' are full
+      ifPowerW = GetPowerBefore (endIndex);
+    }
+
+  NS_LOG_INFO ("Calculate: IfPower (W)= " << ifPowerW <<
+               ", Event ID= " << event->GetId () <<
+               ", Duration= " << event->GetDuration () <<
+               ", StartTime= " << event->GetStartTime () <<
+               ", EndTime= " << event->GetEndTime ());
+
+  if (m_enableTraceOutput)
+    {
+      std::vector<double> tempVector;
+      tempVector.push_back (Now ().GetSeconds ());
+      tempVector.push_back (ifPowerW / m_rxBandwidth_Hz);
+      Singleton<SatInterferenceOutputTraceContainer>::Get ()->AddToContainer (std::make_pair (event->GetSatEarthStationAddress (), m_channelType), tempVector);
+    }
+
+  std::vector< std::pair<double, double> > ifPowerPerFragment;
+  ifPowerPerFragment.emplace_back (1.0, ifPowerW);
+
+  return ifPowerPerFragment;
+}
+
+void
+SatFlatPerPacketInterference::onOwnStartReached (double ifPowerW)
+{
+  // do nothing, meant for subclasses to override
+}
+
+void
+SatFlatPerPacketInterference::onInterferentEvent (long double timeRatio, double interferenceValue, double& ifPowerW)
+{
+  ifPowerW += timeRatio * interferenceValue;
+}
+
+void
+SatFlatPerPacketInterference::DoReset (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_changes.clear ();
+  m_head = 0;
+  m_prefixPowerW.assign (1, 0.0);
+  m_prefixValidUntil = 0;
+  m_rxing = false;
+  m_residualPowerW = 0.0;
+}
+
+void
+SatFlatPerPacketInterference::DoNotifyRxStart (Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+  NS_LOG_FUNCTION (this);
+
+  std::pair<std::set<uint32_t>::iterator, bool> result = m_rxEventIds.insert (event->GetId ());
+
+  NS_ASSERT (result.second);
+  m_rxing = true;
+}
+
+void
+SatFlatPerPacketInterference::DoNotifyRxEnd (Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_rxEventIds.erase (event->GetId ());
+
+  if (m_rxEventIds.empty ())
+    {
+      m_rxing = false;
+    }
+}
+
+void
+SatFlatPerPacketInterference::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  SatInterference::DoDispose ();
+}
+
+void
+SatFlatPerPacketInterference::SetRxBandwidth (double rxBandwidth)
+{
+  NS_LOG_FUNCTION (this << rxBandwidth);
+
+  if (rxBandwidth <= std::numeric_limits<double>::epsilon ())
+    {
+      NS_FATAL_ERROR ("SatFlatPerPacketInterference::SetRxBandwidth - Invalid value");
+    }
+
+  m_rxBandwidth_Hz = rxBandwidth;
+}
+
+
+NS_OBJECT_ENSURE_REGISTERED (SatFlatPerFragmentInterference);
+
+TypeId
+SatFlatPerFragmentInterference::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatFlatPerFragmentInterference")
+    .SetParent<SatFlatPerPacketInterference> ()
+    .AddConstructor<SatFlatPerFragmentInterference> ();
+
+  return tid;
+}
+
+TypeId
+SatFlatPerFragmentInterference::GetInstanceTypeId (void) const
+{
+  NS_LOG_FUNCTION (this);
+
+  return GetTypeId ();
+}
+
+SatFlatPerFragmentInterference::SatFlatPerFragmentInterference ()
+  : SatFlatPerPacketInterference (),
+  m_fragments ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SatFlatPerFragmentInterference::SatFlatPerFragmentInterference (SatEnums::ChannelType_t channelType, double rxBandwidthHz)
+  : SatFlatPerPacketInterference (channelType, rxBandwidthHz),
+  m_fragments ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SatFlatPerFragmentInterference::~SatFlatPerFragmentInterference ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+std::vector< std::pair<double, double> >
+SatFlatPerFragmentInterference::DoCalculate (Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_fragments.Clear ();
+
+  // Use the per packet interference computation hooks to store
+  // interferences at each event associated to the current packet
+  SatFlatPerPacketInterference::DoCalculate (event);
+
+  return m_fragments.GetFragments ();
+}
+
+void
+SatFlatPerFragmentInterference::onOwnStartReached (double ifPowerW)
+{
+  m_fragments.AddOwnStart (ifPowerW);
+}
+
+void
+SatFlatPerFragmentInterference::onInterferentEvent (long double timeRatio, double interferenceValue, double& ifPowerW)
+{
+  m_fragments.AddInterferentEvent (timeRatio, interferenceValue, ifPowerW);
+}
+
+}
+// namespace ns3
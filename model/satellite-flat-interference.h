@@ -0,0 +1,313 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_FLAT_INTERFERENCE_H
+#define SATELLITE_FLAT_INTERFERENCE_H
+
+#include <set>
+#include <vector>
+
+#include "satellite-interference.h"
+#include "satellite-per-fragment-interference.h"
+#include "satellite-interference-output-trace-container.h"
+#include "satellite-enums.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ * \brief Packet by packet interference stored in a flat timeline.
+ *
+ * Gives the same results as SatPerPacketInterference, but the interference
+ * changes are kept in a time ordered array instead of a multimap. Expired
+ * changes are dropped by advancing the head of the array, which is compacted
+ * only when the head passes half of the array, so that the array memory is
+ * reused instead of allocating two tree nodes per burst.
+ *
+ * The interference power accumulated over the changes is cached as a prefix
+ * sum, computed in the same order and precision as the walk of
+ * SatPerPacketInterference. The power at the start of a packet is then read
+ * from the prefix sum, and only the changes overlapping the packet are
+ * walked in DoCalculate.
+ */
+class SatFlatPerPacketInterference : public SatInterference
+{
+public:
+  /**
+   * Derived from Object
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * Derived from Object
+   * \return the object TypeId
+   */
+  TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * Default constructor, interference output trace disabled.
+   */
+  SatFlatPerPacketInterference ();
+
+  /**
+   * Constructor with interference output trace enabled.
+   * \param channelType Channel type
+   * \param rxBandwidthHz Receiver bandwidth in Hertz
+   */
+  SatFlatPerPacketInterference (SatEnums::ChannelType_t channelType, double rxBandwidthHz);
+
+  /**
+   * Destructor
+   */
+  ~SatFlatPerPacketInterference ();
+
+  /**
+   * Dispose of this class instance
+   */
+  void DoDispose ();
+
+  /**
+   * Set the receiver bandwidth
+   * \param rxBandwidth Receiver bandwidth in Hertz
+   */
+  void SetRxBandwidth (double rxBandwidth);
+
+protected:
+  /**
+   * Calculates interference power for the given reference
+   *
+   * \param event Reference event which for interference is calculated.
+   *
+   * \return Calculated power value at end of receiving
+   */
+  virtual std::vector< std::pair<double, double> > DoCalculate (Ptr<SatInterference::InterferenceChangeEvent> event);
+
+  /**
+   * Called during DoCalculate when the start of the event whose
+   * interferences are being calculated has been reached.
+   * See SatPerPacketInterference::onOwnStartReached.
+   */
+  virtual void onOwnStartReached (double ifPowerW);
+
+  /**
+   * Called during DoCalculate for every change overlapping the event whose
+   * interferences are being calculated.
+   * See SatPerPacketInterference::onInterferentEvent.
+   */
+  virtual void onInterferentEvent (long double timeRatio, double interferenceValue, double& ifPowerW);
+
+private:
+  /**
+   * \brief Interference change in the timeline
+   */
+  typedef struct
+  {
+    Time time;
+    uint32_t eventId;
+    long double powerW;
+    bool isEndEvent;
+  } InterferenceChange_t;
+
+  /**
+   * Adds interference power to interference object.
+   *
+   * \param rxDuration Duration of the receiving.
+   * \param rxPower Receiving power.
+   * \param rxAddress Address of the receiver
+   *
+   * \return the pointer to interference event as a reference of the addition
+   */
+  virtual Ptr<SatInterference::InterferenceChangeEvent> DoAdd (Time rxDuration, double rxPower, Address rxAddress);
+
+  /**
+   * Resets current interference.
+   */
+  virtual void DoReset (void);
+
+  /**
+   * Notifies that RX is started by a receiver.
+   *
+   * \param event Interference reference event of receiver
+   */
+  virtual void DoNotifyRxStart (Ptr<SatInterference::InterferenceChangeEvent> event);
+
+  /**
+   * Notifies that RX is ended by a receiver.
+   *
+   * \param event Interference reference event of receiver
+   */
+  virtual void DoNotifyRxEnd (Ptr<SatInterference::InterferenceChangeEvent> event);
+
+  /**
+   * Insert a change after the changes with the same or an earlier time.
+   * \param change Change to insert
+   */
+  void InsertChange (const InterferenceChange_t& change);
+
+  /**
+   * Find a change of an event.
+   * \param time Time of the change
+   * \param eventId Id of the event
+   * \param isEndEvent Is the change the end of the event
+   * \return index of the change, or the end of the timeline if not found
+   */
+  uint32_t FindChange (Time time, uint32_t eventId, bool isEndEvent) const;
+
+  /**
+   * Get the interference power accumulated over the changes before an index.
+   * \param index Index of the change
+   * \return accumulated interference power
+   */
+  double GetPowerBefore (uint32_t index);
+
+  /**
+   * Restart the prefix sum from the residual power at the head.
+   */
+  void ResetPrefixSum ();
+
+  SatFlatPerPacketInterference (const SatFlatPerPacketInterference &o);
+  SatFlatPerPacketInterference &operator = (const SatFlatPerPacketInterference &o);
+
+  /**
+   * \brief Interference changes ordered by time. The changes before m_head
+   * have expired.
+   */
+  std::vector<InterferenceChange_t> m_changes;
+
+  /**
+   * \brief Index of the first change in use
+   */
+  uint32_t m_head;
+
+  /**
+   * \brief Interference power accumulated before each change, i.e.
+   * m_prefixPowerW[i] is the power before m_changes[i].
+   */
+  std::vector<double> m_prefixPowerW;
+
+  /**
+   * \brief Index of the last valid value in m_prefixPowerW
+   */
+  uint32_t m_prefixValidUntil;
+
+  /**
+   * \brief notified interference event IDs
+   */
+  std::set <uint32_t> m_rxEventIds;
+
+  /**
+   * \brief Residual power value for interference.
+   * Sum of the expired changes.
+   */
+  long double m_residualPowerW;
+
+  /**
+   * \brief flag to indicate that at least one receiving is on
+   */
+  bool m_rxing;
+
+  /**
+   * \brief event id for Events
+   */
+  uint32_t m_nextEventId;
+
+  /**
+   * \brief flag to indicate that the interference output trace is enabled
+   */
+  bool m_enableTraceOutput;
+
+  /**
+   * \brief Channel type used in the interference output trace
+   */
+  SatEnums::ChannelType_t m_channelType;
+
+  /**
+   * \brief RX Bandwidth in Hz
+   */
+  double m_rxBandwidth_Hz;
+};
+
+/**
+ * \ingroup satellite
+ * \brief Fragment by fragment interference stored in a flat timeline.
+ * Gives the same results as SatPerFragmentInterference.
+ */
+class SatFlatPerFragmentInterference : public SatFlatPerPacketInterference
+{
+public:
+  /**
+   * Derived from Object
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * Derived from Object
+   * \return the object TypeId
+   */
+  TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * Default constructor, interference output trace disabled.
+   */
+  SatFlatPerFragmentInterference ();
+
+  /**
+   * Constructor with interference output trace enabled.
+   * \param channelType Channel type
+   * \param rxBandwidthHz Receiver bandwidth in Hertz
+   */
+  SatFlatPerFragmentInterference (SatEnums::ChannelType_t channelType, double rxBandwidthHz);
+
+  /**
+   * Destructor
+   */
+  ~SatFlatPerFragmentInterference ();
+
+protected:
+  /**
+   * Calculates interference power for the given reference
+   *
+   * \param event Reference event which for interference is calculated.
+   *
+   * \return Calculated power values for each fragment of the event
+   */
+  virtual std::vector< std::pair<double, double> > DoCalculate (Ptr<SatInterference::InterferenceChangeEvent> event);
+
+  /**
+   * Store the interference power at the start of the event.
+   */
+  virtual void onOwnStartReached (double ifPowerW);
+
+  /**
+   * Store the interference power at each change overlapping the event.
+   */
+  virtual void onInterferentEvent (long double timeRatio, double interferenceValue, double& ifPowerW);
+
+private:
+  /**
+   * \brief Interference power of the fragments of the event
+   */
+  SatFragmentInterferenceCollector m_fragments;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_FLAT_INTERFERENCE_H */
@@ -94,6 +94,18 @@ SatFwdLinkSchedulerDefault::DoDispose ()
   m_bbFrameContainer = NULL;
 }
 
+int64_t
+SatFwdLinkSchedulerDefault::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+  currentStream += SatFwdLinkScheduler::AssignStreams (currentStream);
+  currentStream += m_bbFrameContainer->AssignStreams (currentStream);
+
+  return (currentStream - stream);
+}
+
 
 std::pair<Ptr<SatBbFrame>, const Time>
 SatFwdLinkSchedulerDefault::GetNextFrame ()
@@ -84,6 +84,14 @@ public:
    */
   virtual std::pair<Ptr<SatBbFrame>, const Time> GetNextFrame ();
 
+  /**
+   * Assign fixed random variable stream numbers to the random variables
+   * used by the scheduler and its BB frame containers.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  virtual int64_t AssignStreams (int64_t stream);
+
 private:
 
   /**
@@ -18,6 +18,8 @@
  * Author: Bastien Tauran <bastien.tauran@viveris.fr>
  */
 
+#include <algorithm>
+
 #include "satellite-fwd-link-scheduler-time-slicing.h"
 
 #include "satellite-utils.h"
@@ -58,6 +60,7 @@ SatFwdLinkSchedulerTimeSlicing::SatFwdLinkSchedulerTimeSlicing () : SatFwdLinkSc
 
 SatFwdLinkSchedulerTimeSlicing::SatFwdLinkSchedulerTimeSlicing (Ptr<SatBbFrameConf> conf, Mac48Address address, double carrierBandwidthInHz) :
     SatFwdLinkScheduler (conf, address, carrierBandwidthInHz),
+    m_totalDuration (Seconds (0)),
     m_lastSliceAssigned (1),
     m_lastSliceDequeued (1)
 {
@@ -68,7 +71,7 @@ SatFwdLinkSchedulerTimeSlicing::SatFwdLinkSchedulerTimeSlicing (Ptr<SatBbFrameCo
   std::vector<SatEnums::SatModcod_t> modCods = conf->GetModCodsUsed ();
 
   // Create control and broadcast container
-  m_bbFrameContainers.insert (std::pair<uint8_t, Ptr<SatBbFrameContainer>> (0, CreateObject<SatBbFrameContainer> (modCods, m_bbFrameConf)));
+  m_bbFrameContainers.push_back (CreateObject<SatBbFrameContainer> (modCods, m_bbFrameConf));
   m_bbFrameContainers.at (0)->SetMaxSymbolRate (m_carrierBandwidthInHz);
 
   // Initialize containers
@@ -76,32 +79,31 @@ SatFwdLinkSchedulerTimeSlicing::SatFwdLinkSchedulerTimeSlicing (Ptr<SatBbFrameCo
     {
       Ptr <SatBbFrameContainer> container = CreateObject<SatBbFrameContainer> (modCods, m_bbFrameConf);
       container->SetMaxSymbolRate (m_carrierBandwidthInHz / m_numberOfSlices);
-      m_bbFrameContainers.insert (std::pair<uint8_t, Ptr<SatBbFrameContainer>> (i+1, container));
+      m_bbFrameContainers.push_back (container);
+      m_sliceDurations.insert (container->GetTotalDuration ());
     }
 
   // Initialize number of symbols sent per slice
-  for(uint8_t i = 0; i <= m_numberOfSlices; i++)
-    {
-      m_symbolsSent.insert (std::pair<uint8_t, uint32_t> (i, 0));
-    }
+  m_symbolsSent.assign (m_numberOfSlices + 1, 0);
 
   // Check if all symbol rates are high enough
-  for (std::map<uint8_t, Ptr <SatBbFrameContainer>>::iterator it = m_bbFrameContainers.begin(); it != m_bbFrameContainers.end(); it++ )
+  for (uint32_t sliceId = 0; sliceId < m_bbFrameContainers.size (); sliceId++ )
     {
-      uint32_t maxSymbolPerCycle = it->second->GetMaxSymbolRate ()*m_periodicInterval.GetSeconds ();
+      Ptr<SatBbFrameContainer> container = m_bbFrameContainers[sliceId];
+      uint32_t maxSymbolPerCycle = container->GetMaxSymbolRate ()*m_periodicInterval.GetSeconds ();
       uint32_t symbolsMostRobustModcod;
       if (m_bbFrameConf->GetMostRobustModcod (SatEnums::NORMAL_FRAME) != SatEnums::SAT_NONVALID_MODCOD)
         {
-          symbolsMostRobustModcod = it->second->GetFrameSymbols(m_bbFrameConf->GetMostRobustModcod (SatEnums::NORMAL_FRAME));
+          symbolsMostRobustModcod = container->GetFrameSymbols(m_bbFrameConf->GetMostRobustModcod (SatEnums::NORMAL_FRAME));
         }
       else
         {
           //We are using only short Frames, as new ModCod exists for normal Frames.
-          symbolsMostRobustModcod = it->second->GetFrameSymbols(m_bbFrameConf->GetMostRobustModcod (SatEnums::SHORT_FRAME));
+          symbolsMostRobustModcod = container->GetFrameSymbols(m_bbFrameConf->GetMostRobustModcod (SatEnums::SHORT_FRAME));
         }
       if (symbolsMostRobustModcod > maxSymbolPerCycle)
         {
-          NS_FATAL_ERROR ("Symbol rate of slice " + std::to_string(it->first) + " (" + std::to_string(it->second->GetMaxSymbolRate ())
+          NS_FATAL_ERROR ("Symbol rate of slice " + std::to_string(sliceId) + " (" + std::to_string(container->GetMaxSymbolRate ())
               + " Baud) is too low to allow at least one BBFrame of the most robust ModCod. Must be at least "
               + std::to_string((uint32_t) (symbolsMostRobustModcod / m_periodicInterval.GetSeconds ())) + " Baud");
         }
@@ -121,6 +123,23 @@ SatFwdLinkSchedulerTimeSlicing::DoDispose ()
   NS_LOG_FUNCTION (this);
   SatFwdLinkScheduler::DoDispose ();
   m_bbFrameContainers.clear ();
+  m_sliceDurations.clear ();
+}
+
+int64_t
+SatFwdLinkSchedulerTimeSlicing::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+  currentStream += SatFwdLinkScheduler::AssignStreams (currentStream);
+
+  for (std::vector<Ptr<SatBbFrameContainer> >::iterator it = m_bbFrameContainers.begin (); it != m_bbFrameContainers.end (); ++it)
+    {
+      currentStream += (*it)->AssignStreams (currentStream);
+    }
+
+  return (currentStream - stream);
 }
 
 
@@ -135,7 +154,7 @@ SatFwdLinkSchedulerTimeSlicing::GetNextFrame ()
   // Send slice control messages first if there is any.
   if (!m_bbFrameContainers.at (0)->IsEmpty (0, m_bbFrameConf->GetDefaultModCod ()))
     {
-      frame = m_bbFrameContainers.at (0)->GetNextFrame ();
+      frame = DequeueFrame (0);
       if (frame != NULL)
         {
           frame->SetSliceId (0);
@@ -155,7 +174,7 @@ SatFwdLinkSchedulerTimeSlicing::GetNextFrame ()
           uint32_t symbols = m_symbolsSent.at(m_lastSliceDequeued) + m_symbolsSent.at(0);
           double maxSymbolRate = m_bbFrameContainers.at (m_lastSliceDequeued)->GetMaxSymbolRate ();
 
-          frame = m_bbFrameContainers.at (m_lastSliceDequeued)->GetNextFrame ();
+          frame = DequeueFrame (m_lastSliceDequeued);
           if (frame != NULL)
             {
               m_symbolsSent.at(m_lastSliceDequeued) += ceil(frame->GetDuration ().GetSeconds ()*m_carrierBandwidthInHz);
@@ -223,17 +242,12 @@ SatFwdLinkSchedulerTimeSlicing::SendAndClearSymbolsSentStat ()
 {
   NS_LOG_FUNCTION (this);
 
-  for (std::map<uint8_t, uint32_t>::iterator it = m_symbolsSent.begin(); it != m_symbolsSent.end(); it++ )
+  for (uint32_t sliceId = 0; sliceId < m_symbolsSent.size (); sliceId++ )
     {
-      m_schedulingSymbolRateTrace (it->first, it->second / Seconds (1).GetSeconds ());
+      m_schedulingSymbolRateTrace (sliceId, m_symbolsSent[sliceId] / Seconds (1).GetSeconds ());
     }
 
-  m_symbolsSent.clear ();
-
-  for(uint8_t i = 0; i <= m_numberOfSlices; i++)
-    {
-      m_symbolsSent.insert (std::pair<uint8_t, uint32_t> (i, 0));
-    }
+  std::fill (m_symbolsSent.begin (), m_symbolsSent.end (), 0);
 }
 
 void
@@ -302,11 +316,11 @@ SatFwdLinkSchedulerTimeSlicing::ScheduleBbFrames ()
             {
               if ((flowId == 0) || (address == Mac48Address::GetBroadcast ()))
                 {
-                  m_bbFrameContainers.at (0)->AddData (flowId, modcod, p);
+                  AddData (0, flowId, modcod, p);
                 }
               else
                 {
-                  m_bbFrameContainers.at (slice)->AddData (flowId, modcod, p);
+                  AddData (slice, flowId, modcod, p);
                   frameBytes = m_bbFrameContainers.at (slice)->GetBytesLeftInTailFrame (flowId, modcod);
                 }
             }
@@ -325,7 +339,7 @@ SatFwdLinkSchedulerTimeSlicing::ScheduleBbFrames ()
             }
         }
 
-      m_bbFrameContainers.at (slice)->MergeBbFrames (m_carrierBandwidthInHz);
+      MergeBbFrames (slice);
     }
 }
 
@@ -344,17 +358,62 @@ SatFwdLinkSchedulerTimeSlicing::GetSchedulingObjects (std::vector< Ptr<SatSchedu
 }
 
 Time
-SatFwdLinkSchedulerTimeSlicing::GetTotalDuration ()
+SatFwdLinkSchedulerTimeSlicing::GetTotalDuration () const
 {
   NS_LOG_FUNCTION (this);
 
-  Time duration = Time (0);
-  for (std::map<uint8_t, Ptr<SatBbFrameContainer>>::iterator it = m_bbFrameContainers.begin(); it != m_bbFrameContainers.end(); it++ )
+  return m_totalDuration;
+}
+
+Ptr<SatBbFrame>
+SatFwdLinkSchedulerTimeSlicing::DequeueFrame (uint8_t sliceId)
+{
+  NS_LOG_FUNCTION (this << (uint32_t) sliceId);
+
+  Time oldDuration = m_bbFrameContainers.at (sliceId)->GetTotalDuration ();
+  Ptr<SatBbFrame> frame = m_bbFrameContainers.at (sliceId)->GetNextFrame ();
+  UpdateDuration (sliceId, oldDuration);
+
+  return frame;
+}
+
+void
+SatFwdLinkSchedulerTimeSlicing::AddData (uint8_t sliceId, uint32_t priorityClass, SatEnums::SatModcod_t modcod, Ptr<Packet> data)
+{
+  NS_LOG_FUNCTION (this << (uint32_t) sliceId << priorityClass << modcod);
+
+  Time oldDuration = m_bbFrameContainers.at (sliceId)->GetTotalDuration ();
+  m_bbFrameContainers.at (sliceId)->AddData (priorityClass, modcod, data);
+  UpdateDuration (sliceId, oldDuration);
+}
+
+void
+SatFwdLinkSchedulerTimeSlicing::MergeBbFrames (uint8_t sliceId)
+{
+  NS_LOG_FUNCTION (this << (uint32_t) sliceId);
+
+  Time oldDuration = m_bbFrameContainers.at (sliceId)->GetTotalDuration ();
+  m_bbFrameContainers.at (sliceId)->MergeBbFrames (m_carrierBandwidthInHz);
+  UpdateDuration (sliceId, oldDuration);
+}
+
+void
+SatFwdLinkSchedulerTimeSlicing::UpdateDuration (uint8_t sliceId, Time oldDuration)
+{
+  NS_LOG_FUNCTION (this << (uint32_t) sliceId << oldDuration);
+
+  Time newDuration = m_bbFrameContainers.at (sliceId)->GetTotalDuration ();
+
+  if (newDuration != oldDuration)
     {
-        duration += it->second->GetTotalDuration ();
-    }
+      m_totalDuration += newDuration - oldDuration;
 
-  return duration;
+      if (sliceId > 0)
+        {
+          m_sliceDurations.erase (m_sliceDurations.find (oldDuration));
+          m_sliceDurations.insert (newDuration);
+        }
+    }
 }
 
 void
@@ -389,23 +448,19 @@ SatFwdLinkSchedulerTimeSlicing::CanOpenBbFrame (Mac48Address address, uint32_t p
 
   if (sliceId == 0)
     {
-      // This is broadcast -> need to test all slices >= 1
+      // This is broadcast -> need to test all slices >= 1. The symbols of a slice
+      // grow with its duration, thus it is enough to test the longest slice.
+      if (m_sliceDurations.empty ())
+        {
+          return true;
+        }
+
       uint32_t symbols = GetSymbols (0, modcod);
-        for (std::map<uint8_t, Ptr<SatBbFrameContainer>>::iterator it = m_bbFrameContainers.begin(); it != m_bbFrameContainers.end(); it++ )
-          {
-            if (it->first == 0)
-              {
-                continue;
-              }
-            double symbolRate = (symbols + GetSymbols (it->first, SatEnums::SAT_NONVALID_MODCOD))/ m_periodicInterval.GetSeconds ();
-            if (symbolRate > maxSymbolRate)
-              {
-                // One slice will not respect constraints
-                return false;
-              }
-          }
-      // Constraints are respected for all slices
-      return true;
+      uint32_t sliceSymbols = m_sliceDurations.rbegin ()->GetSeconds ()*m_carrierBandwidthInHz;
+      double symbolRate = (symbols + sliceSymbols)/ m_periodicInterval.GetSeconds ();
+
+      // Constraints are respected for all slices, if respected by the longest one
+      return symbolRate <= maxSymbolRate;
     }
   else
     {
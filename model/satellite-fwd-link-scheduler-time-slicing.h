@@ -23,6 +23,7 @@
 
 #include "ns3/satellite-fwd-link-scheduler.h"
 #include "ns3/pointer.h"
+#include <set>
 
 namespace ns3 {
 
@@ -79,6 +80,14 @@ public:
    */
   virtual std::pair<Ptr<SatBbFrame>, const Time> GetNextFrame ();
 
+  /**
+   * Assign fixed random variable stream numbers to the random variables
+   * used by the scheduler and its BB frame containers.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  virtual int64_t AssignStreams (int64_t stream);
+
 private:
 
   /**
@@ -109,11 +118,58 @@ private:
    */
   void GetSchedulingObjects (std::vector< Ptr<SatSchedulingObject> > & output);
 
+protected:
   /*
    * Give the total sending time of all the BBFrames in all the slices.
    * \return The total duration.
    */
-  Time GetTotalDuration ();
+  Time GetTotalDuration () const;
+
+  /**
+   * Get the next frame of a slice and update the duration counters.
+   * \param sliceId The slice
+   * \return The frame or NULL if the slice has no frames
+   */
+  Ptr<SatBbFrame> DequeueFrame (uint8_t sliceId);
+
+  /**
+   * Add data to the container of a slice and update the duration counters.
+   * \param sliceId The slice
+   * \param priorityClass Priority class of the data
+   * \param modcod MODCOD of the data
+   * \param data The data
+   */
+  void AddData (uint8_t sliceId, uint32_t priorityClass, SatEnums::SatModcod_t modcod, Ptr<Packet> data);
+
+  /**
+   * Merge the BBFrames of a slice and update the duration counters.
+   * \param sliceId The slice
+   */
+  void MergeBbFrames (uint8_t sliceId);
+
+  /**
+   * The containers for BBFrames, indexed by slice
+   */
+  std::vector<Ptr<SatBbFrameContainer> > m_bbFrameContainers;
+
+  /**
+   * Total duration of the BBFrames in all the slices, i.e. the sum of the
+   * total durations of m_bbFrameContainers
+   */
+  Time m_totalDuration;
+
+  /**
+   * Total durations of the BBFrames of the slices other than the control slice 0
+   */
+  std::multiset<Time> m_sliceDurations;
+
+private:
+  /**
+   * Update the duration counters after the frames of a slice have changed.
+   * \param sliceId The slice
+   * \param oldDuration Total duration of the slice before the change
+   */
+  void UpdateDuration (uint8_t sliceId, Time oldDuration);
 
   /*
    * Send a control packet to the UT to inform which slices to subscribe
@@ -139,11 +195,6 @@ private:
    */
   uint32_t GetSymbols (uint8_t sliceId, SatEnums::SatModcod_t modcod);
 
-  /**
-   * The containers for BBFrames. The keys are the slices and the values the associated container
-   */
-  std::map<uint8_t, Ptr<SatBbFrameContainer>> m_bbFrameContainers;
-
   /**
    * The association between a destination MAC address and its slice.
    * Slice 0 is the container for control BBFrames that are broadcasted to all UT.
@@ -151,9 +202,9 @@ private:
   std::map<Mac48Address, uint8_t> m_slicesMapping;
 
   /**
-   * The number of symbols sent for each slice during an allocation cycle.
+   * The number of symbols sent for each slice during an allocation cycle, indexed by slice.
    */
-  std::map<uint8_t, uint32_t> m_symbolsSent;
+  std::vector<uint32_t> m_symbolsSent;
 
   /**
    * The number of slices
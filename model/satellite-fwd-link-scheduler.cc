@@ -129,12 +129,24 @@ SatFwdLinkScheduler::GetTypeId (void)
                    MakeEnumAccessor (&SatFwdLinkScheduler::m_cnoEstimatorMode),
                    MakeEnumChecker (SatCnoEstimator::LAST, "LastValueInWindow",
                                     SatCnoEstimator::MINIMUM, "MinValueInWindow",
-                                    SatCnoEstimator::AVERAGE, "AverageValueInWindow"))
+                                    SatCnoEstimator::AVERAGE, "AverageValueInWindow",
+                                    SatCnoEstimator::EWMA, "EwmaValueInWindow",
+                                    SatCnoEstimator::PERCENTILE, "PercentileValueInWindow"))
     .AddAttribute ( "CnoEstimationWindow",
                     "Time window for C/N0 estimation.",
                     TimeValue (Seconds (5000)),
                     MakeTimeAccessor (&SatFwdLinkScheduler::m_cnoEstimationWindow),
                     MakeTimeChecker ())
+    .AddAttribute ( "CnoEstimationEwmaWeight",
+                    "Weight of a new sample in C/N0 estimation mode EwmaValueInWindow, in range (0, 1].",
+                    DoubleValue (0.1),
+                    MakeDoubleAccessor (&SatFwdLinkScheduler::m_cnoEstimationEwmaWeight),
+                    MakeDoubleChecker<double> (0.0, 1.0))
+    .AddAttribute ( "CnoEstimationPercentile",
+                    "Percentile of the samples in C/N0 estimation mode PercentileValueInWindow.",
+                    DoubleValue (10.0),
+                    MakeDoubleAccessor (&SatFwdLinkScheduler::m_cnoEstimationPercentile),
+                    MakeDoubleChecker<double> (0.0, 100.0))
     .AddTraceSource ( "SymbolRate",
                       "Scheduler symbol rate for a given packet",
                       MakeTraceSourceAccessor (&SatFwdLinkScheduler::m_schedulingSymbolRateTrace),
@@ -155,6 +167,8 @@ SatFwdLinkScheduler::GetInstanceTypeId (void) const
 SatFwdLinkScheduler::SatFwdLinkScheduler ()
   : m_additionalSortCriteria (SatFwdLinkScheduler::NO_SORT),
   m_cnoEstimatorMode (SatCnoEstimator::LAST),
+  m_cnoEstimationEwmaWeight (0.1),
+  m_cnoEstimationPercentile (10.0),
   m_carrierBandwidthInHz (0.0)
 {
   NS_LOG_FUNCTION (this);
@@ -166,6 +180,8 @@ SatFwdLinkScheduler::SatFwdLinkScheduler (Ptr<SatBbFrameConf> conf, Mac48Address
   m_bbFrameConf (conf),
   m_additionalSortCriteria (SatFwdLinkScheduler::NO_SORT),
   m_cnoEstimatorMode (SatCnoEstimator::LAST),
+  m_cnoEstimationEwmaWeight (0.1),
+  m_cnoEstimationPercentile (10.0),
   m_carrierBandwidthInHz (carrierBandwidthInHz)
 {
   NS_LOG_FUNCTION (this);
@@ -262,6 +278,15 @@ SatFwdLinkScheduler::GetDefaultFrameDuration () const
   return m_bbFrameConf->GetBbFrameDuration (m_bbFrameConf->GetDefaultModCod (), SatEnums::NORMAL_FRAME);
 }
 
+int64_t
+SatFwdLinkScheduler::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  m_random->SetStream (stream);
+  return 1;
+}
+
 void
 SatFwdLinkScheduler::PeriodicTimerExpired ()
 {
@@ -369,8 +394,24 @@ SatFwdLinkScheduler::CreateCnoEstimator ()
     case SatCnoEstimator::LAST:
     case SatCnoEstimator::MINIMUM:
     case SatCnoEstimator::AVERAGE:
-      estimator = Create<SatBasicCnoEstimator> (m_cnoEstimatorMode, m_cnoEstimationWindow);
-      break;
+    case SatCnoEstimator::EWMA:
+    case SatCnoEstimator::PERCENTILE:
+      {
+        Ptr<SatBasicCnoEstimator> basicEstimator = Create<SatBasicCnoEstimator> (m_cnoEstimatorMode, m_cnoEstimationWindow);
+
+        // The parameters are validated only in the modes using them
+        if (m_cnoEstimatorMode == SatCnoEstimator::EWMA)
+          {
+            basicEstimator->SetEwmaWeight (m_cnoEstimationEwmaWeight);
+          }
+        else if (m_cnoEstimatorMode == SatCnoEstimator::PERCENTILE)
+          {
+            basicEstimator->SetPercentile (m_cnoEstimationPercentile);
+          }
+
+        estimator = basicEstimator;
+        break;
+      }
 
     default:
       NS_FATAL_ERROR ("Not supported C/N0 estimation mode!!!");
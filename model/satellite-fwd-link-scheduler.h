@@ -216,6 +216,14 @@ public:
    */
   Time GetDefaultFrameDuration () const;
 
+  /**
+   * Assign fixed random variable stream numbers to the random variables
+   * used by the scheduler and its BB frame containers.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  virtual int64_t AssignStreams (int64_t stream);
+
 protected:
 
   typedef std::map<Mac48Address, Ptr<SatCnoEstimator> > CnoEstimatorMap_t;
@@ -343,6 +351,16 @@ protected:
    */
   Time m_cnoEstimationWindow;
 
+  /**
+   * Weight of a new sample in C/N0 estimation mode EWMA.
+   */
+  double m_cnoEstimationEwmaWeight;
+
+  /**
+   * Percentile of the samples in C/N0 estimation mode PERCENTILE.
+   */
+  double m_cnoEstimationPercentile;
+
   /**
    * Carrier bandwidth in hertz where scheduler is associated to.
    */
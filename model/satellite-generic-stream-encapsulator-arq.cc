@@ -324,6 +324,11 @@ SatGenericStreamEncapsulatorArq::ArqReTxTimerExpired (uint8_t seqNo)
 
           // Push to the retransmission buffer
           m_retxBuffer.insert (std::make_pair (seqNo, context));
+
+          if (!m_txBufferCallback.IsNull ())
+            {
+              m_txBufferCallback ();
+            }
         }
       // Maximum retransmissions reached
       else
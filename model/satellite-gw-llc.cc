@@ -62,9 +62,53 @@ SatGwLlc::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
 
+  m_activeEncaps.clear ();
+  m_schedulingObjectPool.clear ();
+
   SatLlc::DoDispose ();
 }
 
+bool
+SatGwLlc::Enque (Ptr<Packet> packet, Address dest, uint8_t flowId)
+{
+  NS_LOG_FUNCTION (this << packet << dest << (uint32_t) flowId);
+
+  bool result = SatLlc::Enque (packet, dest, flowId);
+
+  Ptr<EncapKey> key = m_encapIndex.FindKey (m_nodeInfo->GetMacAddress (), Mac48Address::ConvertFrom (dest), flowId);
+  NS_ASSERT (key != 0);
+
+  ActivateEncap (key);
+
+  return result;
+}
+
+void
+SatGwLlc::ActivateEncap (Ptr<EncapKey> key)
+{
+  NS_LOG_FUNCTION (this << key->m_source << key->m_destination << (uint32_t)(key->m_flowId));
+
+  if (m_activeEncaps.find (key) == m_activeEncaps.end ())
+    {
+      Ptr<SatBaseEncapsulator> encap = m_encapIndex.Find (key->m_source, key->m_destination, key->m_flowId);
+
+      if (encap == 0)
+        {
+          NS_FATAL_ERROR ("Encapsulator not found for key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ")");
+        }
+
+      ActiveEncap_t entry;
+      entry.m_encap = encap;
+      m_activeEncaps.insert (std::make_pair (key, entry));
+    }
+}
+
+void
+SatGwLlc::TxBufferNotificationHelper (SatGwLlc *self, Ptr<EncapKey> key)
+{
+  self->ActivateEncap (key);
+}
+
 
 Ptr<Packet>
 SatGwLlc::NotifyTxOpportunity (uint32_t bytes, Mac48Address utAddr, uint8_t flowId, uint32_t &bytesLeft, uint32_t &nextMinTxO)
@@ -72,12 +116,11 @@ SatGwLlc::NotifyTxOpportunity (uint32_t bytes, Mac48Address utAddr, uint8_t flow
   NS_LOG_FUNCTION (this << utAddr << bytes << (uint32_t) flowId);
 
   Ptr<Packet> packet;
-  Ptr<EncapKey> key = Create<EncapKey> (m_nodeInfo->GetMacAddress (), utAddr, flowId);
-  EncapContainer_t::iterator it = m_encaps.find (key);
+  Ptr<SatBaseEncapsulator> encap = m_encapIndex.Find (m_nodeInfo->GetMacAddress (), utAddr, flowId);
 
-  if (it != m_encaps.end ())
+  if (encap != 0)
     {
-      packet = it->second->NotifyTxOpportunity (bytes, bytesLeft, nextMinTxO);
+      packet = encap->NotifyTxOpportunity (bytes, bytesLeft, nextMinTxO);
 
       if (packet)
         {
@@ -121,12 +164,12 @@ SatGwLlc::CreateEncap (Ptr<EncapKey> key)
 
   Ptr<SatQueue> queue = CreateObject<SatQueue> (key->m_flowId);
   gwEncap->SetQueue (queue);
+  gwEncap->SetTxBufferCallback (MakeBoundCallback (&SatGwLlc::TxBufferNotificationHelper, this, key));
 
   NS_LOG_INFO ("Create encapsulator with key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ")");
 
   // Store the encapsulator
-  std::pair<EncapContainer_t::iterator, bool> result = m_encaps.insert (std::make_pair (key, gwEncap));
-  if (result.second == false)
+  if (!InsertEncap (key, gwEncap))
     {
       NS_FATAL_ERROR ("Insert to map with key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ") failed!");
     }
@@ -154,8 +197,7 @@ SatGwLlc::CreateDecap (Ptr<EncapKey> key)
   NS_LOG_INFO ("Create decapsulator with key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ")");
 
   // Store the decapsulator
-  std::pair<EncapContainer_t::iterator, bool> result = m_decaps.insert (std::make_pair (key, gwDecap));
-  if (result.second == false)
+  if (!InsertDecap (key, gwDecap))
     {
       NS_FATAL_ERROR ("Insert to map with key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ") failed!");
     }
@@ -169,20 +211,48 @@ void SatGwLlc::GetSchedulingContexts (std::vector< Ptr<SatSchedulingObject> > &
   // Head of link queuing delay
   Time holDelay;
 
-  // Then the user data
-  for (EncapContainer_t::const_iterator cit = m_encaps.begin ();
-       cit != m_encaps.end ();
-       ++cit)
+  // Visit only the backlogged encapsulators, the active container has
+  // the same ordering as m_encaps.
+  ActiveEncapContainer_t::iterator it = m_activeEncaps.begin ();
+  while (it != m_activeEncaps.end ())
     {
-      uint32_t buf = cit->second->GetTxBufferSizeInBytes ();
+      uint32_t buf = it->second.m_encap->GetTxBufferSizeInBytes ();
 
       if (buf > 0)
         {
-          holDelay = cit->second->GetHolDelay ();
-          uint32_t minTxOpportunityInBytes = cit->second->GetMinTxOpportunityInBytes ();
-          Ptr<SatSchedulingObject> so =
-            Create<SatSchedulingObject> (cit->first->m_destination, buf, minTxOpportunityInBytes, holDelay, cit->first->m_flowId);
-          output.push_back (so);
+          holDelay = it->second.m_encap->GetHolDelay ();
+          uint32_t minTxOpportunityInBytes = it->second.m_encap->GetMinTxOpportunityInBytes ();
+
+          if (it->second.m_schedulingObject == 0)
+            {
+              if (m_schedulingObjectPool.empty ())
+                {
+                  it->second.m_schedulingObject =
+                    Create<SatSchedulingObject> (it->first->m_destination, buf, minTxOpportunityInBytes, holDelay, it->first->m_flowId);
+                }
+              else
+                {
+                  it->second.m_schedulingObject = m_schedulingObjectPool.back ();
+                  m_schedulingObjectPool.pop_back ();
+                  it->second.m_schedulingObject->Set (it->first->m_destination, buf, minTxOpportunityInBytes, holDelay, it->first->m_flowId);
+                }
+            }
+          else
+            {
+              it->second.m_schedulingObject->Set (it->first->m_destination, buf, minTxOpportunityInBytes, holDelay, it->first->m_flowId);
+            }
+
+          output.push_back (it->second.m_schedulingObject);
+          ++it;
+        }
+      else
+        {
+          // Encapsulator went idle, release it from the active container
+          if (it->second.m_schedulingObject != 0)
+            {
+              m_schedulingObjectPool.push_back (it->second.m_schedulingObject);
+            }
+          m_activeEncaps.erase (it++);
         }
     }
 }
@@ -193,17 +263,15 @@ SatGwLlc::GetNBytesInQueue (Mac48Address utAddress) const
   NS_LOG_FUNCTION (this << utAddress);
 
   uint32_t sum = 0;
+  const SatEncapIndex::EncapList_t & encaps = m_encapIndex.GetByDestination (utAddress);
 
-  for (EncapContainer_t::const_iterator it = m_encaps.begin ();
-       it != m_encaps.end (); ++it)
+  for (SatEncapIndex::EncapList_t::const_iterator it = encaps.begin ();
+       it != encaps.end (); ++it)
     {
-      if (it->first->m_destination == utAddress)
-        {
-          NS_ASSERT (it->second != 0);
-          Ptr<SatQueue> queue = it->second->GetQueue ();
-          NS_ASSERT (queue != 0);
-          sum += queue->GetNBytes ();
-        }
+      NS_ASSERT ((*it) != 0);
+      Ptr<SatQueue> queue = (*it)->GetQueue ();
+      NS_ASSERT (queue != 0);
+      sum += queue->GetNBytes ();
     }
 
   return sum;
@@ -215,17 +283,15 @@ SatGwLlc::GetNPacketsInQueue (Mac48Address utAddress) const
   NS_LOG_FUNCTION (this << utAddress);
 
   uint32_t sum = 0;
+  const SatEncapIndex::EncapList_t & encaps = m_encapIndex.GetByDestination (utAddress);
 
-  for (EncapContainer_t::const_iterator it = m_encaps.begin ();
-       it != m_encaps.end (); ++it)
+  for (SatEncapIndex::EncapList_t::const_iterator it = encaps.begin ();
+       it != encaps.end (); ++it)
     {
-      if (it->first->m_destination == utAddress)
-        {
-          NS_ASSERT (it->second != 0);
-          Ptr<SatQueue> queue = it->second->GetQueue ();
-          NS_ASSERT (queue != 0);
-          sum += queue->GetNPackets ();
-        }
+      NS_ASSERT ((*it) != 0);
+      Ptr<SatQueue> queue = (*it)->GetQueue ();
+      NS_ASSERT (queue != 0);
+      sum += queue->GetNPackets ();
     }
 
   return sum;
@@ -23,6 +23,7 @@
 
 #include "ns3/ptr.h"
 #include "satellite-llc.h"
+#include "satellite-scheduling-object.h"
 
 namespace ns3 {
 
@@ -53,6 +54,17 @@ public:
    */
   virtual ~SatGwLlc ();
 
+  /**
+    * \brief Called from higher layer (SatNetDevice) to enque packet to LLC.
+    * The encapsulator of the packet is marked as backlogged for scheduling.
+    *
+    * \param packet packet sent from above down to SatMac
+    * \param dest Destination MAC address of the packet
+    * \param flowId Flow identifier
+    * \return Boolean indicating whether the enque operation succeeded
+    */
+  virtual bool Enque (Ptr<Packet> packet, Address dest, uint8_t flowId);
+
   /**
     *  \brief Called from lower layer (MAC) to inform a tx
     *  opportunity of certain amount of bytes
@@ -69,6 +81,9 @@ public:
   /**
    * \brief Create and fill the scheduling objects based on LLC layer information.
    * Scheduling objects may be used at the MAC layer to assist in scheduling.
+   * Only the backlogged encapsulators are visited, in encapsulator key order.
+   * The scheduling objects are reused between calls, i.e. they are valid only
+   * until the next call of this method.
    * \param output reference to an output vector that will be filled with
    *               pointer to scheduling objects
    */
@@ -112,6 +127,46 @@ protected:
    */
   virtual void CreateDecap (Ptr<EncapKey> key);
 
+private:
+  /**
+   * \brief Mark the encapsulator of the given key as backlogged.
+   * \param key Encapsulator key
+   */
+  void ActivateEncap (Ptr<EncapKey> key);
+
+  /**
+   * \brief Helper for the encapsulator Tx buffer callback.
+   * \param self Pointer to the LLC owning the encapsulator
+   * \param key Encapsulator key
+   */
+  static void TxBufferNotificationHelper (SatGwLlc *self, Ptr<EncapKey> key);
+
+  /**
+   * Backlogged encapsulator entry.
+   */
+  typedef struct
+  {
+    Ptr<SatBaseEncapsulator> m_encap;
+    Ptr<SatSchedulingObject> m_schedulingObject;
+  } ActiveEncap_t;
+
+  /**
+   * Container of the encapsulators which may have data buffered for
+   * transmission. Entries with empty buffers are removed lazily when the
+   * scheduling contexts are collected.
+   */
+  typedef std::map<Ptr<EncapKey>, ActiveEncap_t, EncapKeyCompare> ActiveEncapContainer_t;
+
+  /**
+   * Backlogged encapsulators, ordered in the same way as m_encaps.
+   */
+  mutable ActiveEncapContainer_t m_activeEncaps;
+
+  /**
+   * Scheduling objects released by idle encapsulators, kept for reuse.
+   */
+  mutable std::vector< Ptr<SatSchedulingObject> > m_schedulingObjectPool;
+
 };
 
 } // namespace ns3
@@ -0,0 +1,277 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ns3/log.h"
+#include "ns3/boolean.h"
+#include "ns3/string.h"
+#include "satellite-utils.h"
+#include "satellite-link-results-bundle.h"
+
+
+NS_LOG_COMPONENT_DEFINE ("SatLinkResultsBundle");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatLinkResultsBundle);
+
+/// Size of the bundle header in bytes
+static const uint64_t BUNDLE_HEADER_SIZE = 24;
+
+/// Size of a bundle directory entry in bytes
+static const uint64_t BUNDLE_ENTRY_SIZE = 72;
+
+/// Magic string in the beginning of the bundle
+static const char BUNDLE_MAGIC[8] = { 'S', 'N', 'S', '3', 'L', 'R', 'B', '\0' };
+
+
+TypeId
+SatLinkResultsBundle::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatLinkResultsBundle")
+    .SetParent<Object> ()
+    .AddConstructor<SatLinkResultsBundle> ()
+    .AddAttribute ("EnableBundle",
+                   "Read the link results primarily from the binary bundle file.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&SatLinkResultsBundle::m_enableBundle),
+                   MakeBooleanChecker ())
+    .AddAttribute ("BundleFileName",
+                   "Name of the binary bundle file in the link results directory.",
+                   StringValue ("linkresults.bundle"),
+                   MakeStringAccessor (&SatLinkResultsBundle::m_bundleFileName),
+                   MakeStringChecker ())
+  ;
+  return tid;
+}
+
+TypeId
+SatLinkResultsBundle::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+
+SatLinkResultsBundle::SatLinkResultsBundle ()
+  : m_enableBundle (true),
+  m_bundleFileName ("linkresults.bundle"),
+  m_bundleOpened (false),
+  m_bundleDirectory (),
+  m_bundleData (0),
+  m_bundleSize (0),
+  m_bundleDirectoryEntries (),
+  m_tables ()
+{
+  NS_LOG_FUNCTION (this);
+
+  ObjectBase::ConstructSelf (AttributeConstructionList ());
+}
+
+
+SatLinkResultsBundle::~SatLinkResultsBundle ()
+{
+  NS_LOG_FUNCTION (this);
+
+  CloseBundle ();
+}
+
+
+void
+SatLinkResultsBundle::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  CloseBundle ();
+  m_tables.clear ();
+
+  Object::DoDispose ();
+}
+
+
+Ptr<SatLookUpTable>
+SatLinkResultsBundle::GetLookUpTable (std::string linkResultPath)
+{
+  NS_LOG_FUNCTION (this << linkResultPath);
+
+  std::map<std::string, Ptr<SatLookUpTable> >::const_iterator it = m_tables.find (linkResultPath);
+
+  if (it != m_tables.end ())
+    {
+      return it->second;
+    }
+
+  std::string directory;
+  std::string name = linkResultPath;
+  std::string::size_type separator = linkResultPath.find_last_of ('/');
+
+  if (separator != std::string::npos)
+    {
+      directory = linkResultPath.substr (0, separator + 1);
+      name = linkResultPath.substr (separator + 1);
+    }
+
+  Ptr<SatLookUpTable> table;
+
+  if (m_enableBundle)
+    {
+      if (!m_bundleOpened)
+        {
+          OpenBundle (directory);
+        }
+
+      if (directory == m_bundleDirectory)
+        {
+          table = CreateFromBundle (name);
+        }
+    }
+
+  if (table == 0)
+    {
+      table = CreateObject<SatLookUpTable> (linkResultPath);
+    }
+
+  m_tables.insert (std::make_pair (linkResultPath, table));
+
+  return table;
+}
+
+
+void
+SatLinkResultsBundle::OpenBundle (std::string directory)
+{
+  NS_LOG_FUNCTION (this << directory);
+
+  m_bundleOpened = true;
+  m_bundleDirectory = directory;
+
+  std::string bundlePath = directory + m_bundleFileName;
+
+  int fd = open (bundlePath.c_str (), O_RDONLY);
+
+  if (fd < 0)
+    {
+      NS_LOG_INFO ("Link results bundle " << bundlePath << " not found, using text files");
+      return;
+    }
+
+  struct stat st;
+
+  if (fstat (fd, &st) != 0 || (uint64_t) st.st_size < BUNDLE_HEADER_SIZE)
+    {
+      NS_LOG_WARN ("Link results bundle " << bundlePath << " is truncated, using text files");
+      close (fd);
+      return;
+    }
+
+  void *data = mmap (0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close (fd);
+
+  if (data == MAP_FAILED)
+    {
+      NS_LOG_WARN ("Mapping the link results bundle " << bundlePath << " failed, using text files");
+      return;
+    }
+
+  m_bundleData = static_cast<const uint8_t*> (data);
+  m_bundleSize = st.st_size;
+
+  uint32_t version, tableCount;
+  uint64_t checksum;
+  std::memcpy (&version, m_bundleData + 8, sizeof (uint32_t));
+  std::memcpy (&tableCount, m_bundleData + 12, sizeof (uint32_t));
+  std::memcpy (&checksum, m_bundleData + 16, sizeof (uint64_t));
+
+  if (std::memcmp (m_bundleData, BUNDLE_MAGIC, sizeof (BUNDLE_MAGIC)) != 0
+      || version != BUNDLE_VERSION
+      || BUNDLE_HEADER_SIZE + tableCount * BUNDLE_ENTRY_SIZE > m_bundleSize
+      || SatUtils::CalculateChecksum (m_bundleData + BUNDLE_HEADER_SIZE, m_bundleSize - BUNDLE_HEADER_SIZE) != checksum)
+    {
+      NS_LOG_WARN ("Link results bundle " << bundlePath << " is invalid, using text files");
+      CloseBundle ();
+      return;
+    }
+
+  for (uint32_t i = 0; i < tableCount; ++i)
+    {
+      const uint8_t *entry = m_bundleData + BUNDLE_HEADER_SIZE + i * BUNDLE_ENTRY_SIZE;
+
+      char name[BUNDLE_NAME_LENGTH + 1];
+      std::memcpy (name, entry, BUNDLE_NAME_LENGTH);
+      name[BUNDLE_NAME_LENGTH] = '\0';
+
+      uint32_t rows;
+      uint64_t offset;
+      std::memcpy (&rows, entry + BUNDLE_NAME_LENGTH, sizeof (uint32_t));
+      std::memcpy (&offset, entry + BUNDLE_NAME_LENGTH + 8, sizeof (uint64_t));
+
+      if (offset % sizeof (double) != 0 || offset + 2 * sizeof (double) * (uint64_t) rows > m_bundleSize)
+        {
+          NS_LOG_WARN ("Link results bundle " << bundlePath << " has an invalid entry " << name << ", using text files");
+          CloseBundle ();
+          return;
+        }
+
+      m_bundleDirectoryEntries[name] = std::make_pair (rows, offset);
+    }
+
+  NS_LOG_INFO ("Mapped link results bundle " << bundlePath << " with " << tableCount << " tables");
+}
+
+
+void
+SatLinkResultsBundle::CloseBundle ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_bundleData != 0)
+    {
+      munmap (const_cast<uint8_t*> (m_bundleData), m_bundleSize);
+      m_bundleData = 0;
+      m_bundleSize = 0;
+    }
+
+  m_bundleDirectoryEntries.clear ();
+}
+
+
+Ptr<SatLookUpTable>
+SatLinkResultsBundle::CreateFromBundle (std::string name) const
+{
+  NS_LOG_FUNCTION (this << name);
+
+  std::map<std::string, std::pair<uint32_t, uint64_t> >::const_iterator it = m_bundleDirectoryEntries.find (name);
+
+  if (m_bundleData == 0 || it == m_bundleDirectoryEntries.end ())
+    {
+      return 0;
+    }
+
+  uint32_t rows = it->second.first;
+  const double *esNoDb = reinterpret_cast<const double*> (m_bundleData + it->second.second);
+  const double *bler = esNoDb + rows;
+
+  return CreateObject<SatLookUpTable> (name, esNoDb, bler, rows);
+}
+
+} // end of namespace ns3
@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_LINK_RESULTS_BUNDLE_H
+#define SATELLITE_LINK_RESULTS_BUNDLE_H
+
+#include <map>
+#include <string>
+
+#include "ns3/object.h"
+#include "satellite-look-up-table.h"
+
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Shared store of the link result look up tables.
+ *
+ * The class is used through Singleton, so that all SatLinkResults instances
+ * share the same read-only SatLookUpTable objects, i.e. each link results file
+ * is loaded only once per simulation.
+ *
+ * The tables are read primarily from a single binary bundle file (created with
+ * ext-utils/generate_link_results_bundle.py) located in the same directory as
+ * the text files. The bundle is memory mapped and verified with its version and
+ * checksum. Tables missing from the bundle, or all the tables if the bundle is
+ * not available or is invalid, are parsed from the text files.
+ *
+ * Bundle format (little-endian, all offsets from the beginning of the file):
+ * - Header: magic "SNS3LRB\0" (8 bytes), version (uint32), table count (uint32),
+ *   FNV-1a 64-bit checksum of the rest of the file (uint64)
+ * - Directory entry per table: file name (56 bytes, zero padded), row count (uint32),
+ *   reserved (uint32), data offset (uint64)
+ * - Data per table: row count Es/No values (double) followed by row count BLER values (double)
+ */
+class SatLinkResultsBundle : public Object
+{
+public:
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId ();
+
+  /**
+   * \brief Get the type ID of instance
+   * \return the object TypeId
+   */
+  virtual TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * \brief Constructor
+   */
+  SatLinkResultsBundle ();
+
+  /**
+   * \brief Destructor
+   */
+  virtual ~SatLinkResultsBundle ();
+
+  /**
+   * \brief Get the look up table of a link results file. The table is loaded
+   * at the first request and shared with all the following requests.
+   * \param linkResultPath Path to the link results text file
+   * \return The look up table
+   */
+  Ptr<SatLookUpTable> GetLookUpTable (std::string linkResultPath);
+
+  /**
+   * \brief Version of the supported bundle format
+   */
+  static const uint32_t BUNDLE_VERSION = 1;
+
+  /**
+   * \brief Length of the zero padded table name in the bundle directory
+   */
+  static const uint32_t BUNDLE_NAME_LENGTH = 56;
+
+private:
+  virtual void DoDispose ();
+
+  /**
+   * \brief Map and verify the bundle file in the given directory.
+   * \param directory Directory of the link results files
+   */
+  void OpenBundle (std::string directory);
+
+  /**
+   * \brief Unmap the bundle file.
+   */
+  void CloseBundle ();
+
+  /**
+   * \brief Create a look up table from the bundle.
+   * \param name File name of the link results
+   * \return The look up table, or zero if the table is not in the bundle
+   */
+  Ptr<SatLookUpTable> CreateFromBundle (std::string name) const;
+
+  /**
+   * \brief Flag telling whether the bundle file is used
+   */
+  bool m_enableBundle;
+
+  /**
+   * \brief Name of the bundle file in the link results directory
+   */
+  std::string m_bundleFileName;
+
+  /**
+   * \brief Flag telling whether opening the bundle has been tried
+   */
+  bool m_bundleOpened;
+
+  /**
+   * \brief Directory from which the bundle was opened
+   */
+  std::string m_bundleDirectory;
+
+  /**
+   * \brief Start of the mapped bundle file, zero if not mapped
+   */
+  const uint8_t* m_bundleData;
+
+  /**
+   * \brief Size of the mapped bundle file
+   */
+  uint64_t m_bundleSize;
+
+  /**
+   * \brief Directory of the bundle, table name to row count and data offset
+   */
+  std::map<std::string, std::pair<uint32_t, uint64_t> > m_bundleDirectoryEntries;
+
+  /**
+   * \brief Loaded look up tables keyed by the link results file path
+   */
+  std::map<std::string, Ptr<SatLookUpTable> > m_tables;
+};
+
+} // end of namespace ns3
+
+#endif /* SATELLITE_LINK_RESULTS_BUNDLE_H */
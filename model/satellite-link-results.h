@@ -84,6 +84,13 @@ protected:
    */
   virtual void DoInitialize () = 0;
 
+  /**
+   * \brief Get a look up table shared through SatLinkResultsBundle.
+   * \param linkResultPath Path to the link results text file
+   * \return The look up table
+   */
+  Ptr<SatLookUpTable> LoadLookUpTable (std::string linkResultPath) const;
+
   /**
    * \brief The base path where the text
    *        files containing link results data can be found.
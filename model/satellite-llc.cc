@@ -92,6 +92,7 @@ SatLlc::DoDispose ()
       it->second = 0;
     }
   m_encaps.clear ();
+  m_encapIndex.Clear ();
 
   for ( it = m_decaps.begin (); it != m_decaps.end (); ++it)
     {
@@ -99,6 +100,7 @@ SatLlc::DoDispose ()
       it->second = 0;
     }
   m_decaps.clear ();
+  m_decapIndex.Clear ();
 
   Object::DoDispose ();
 }
@@ -111,26 +113,25 @@ SatLlc::Enque (Ptr<Packet> packet, Address dest, uint8_t flowId)
   NS_LOG_INFO ("dest=" << dest );
   NS_LOG_INFO ("UID is " << packet->GetUid ());
 
-  Ptr<EncapKey> key = Create<EncapKey> (m_nodeInfo->GetMacAddress (), Mac48Address::ConvertFrom (dest), flowId);
+  Mac48Address destMacAddress = Mac48Address::ConvertFrom (dest);
+  Ptr<SatBaseEncapsulator> encap = m_encapIndex.Find (m_nodeInfo->GetMacAddress (), destMacAddress, flowId);
 
-  EncapContainer_t::iterator it = m_encaps.find (key);
-
-  if (it == m_encaps.end ())
+  if (encap == 0)
     {
       /**
        * Encapsulator not found, thus create a new one. This method is
        * implemented in the inherited classes, which knows which type
        * of encapsulator to create.
        */
-      CreateEncap (key);
-      it = m_encaps.find (key);
+      CreateEncap (Create<EncapKey> (m_nodeInfo->GetMacAddress (), destMacAddress, flowId));
+      encap = m_encapIndex.Find (m_nodeInfo->GetMacAddress (), destMacAddress, flowId);
     }
 
   // Store packet arrival time
   SatTimeTag timeTag (Simulator::Now ());
   packet->AddPacketTag (timeTag);
 
-  it->second->EnquePdu (packet, Mac48Address::ConvertFrom (dest));
+  encap->EnquePdu (packet, destMacAddress);
 
   SatEnums::SatLinkDir_t ld =
     (m_nodeInfo->GetNodeType () == SatEnums::NT_UT) ? SatEnums::LD_RETURN : SatEnums::LD_FORWARD;
@@ -173,8 +174,7 @@ SatLlc::Receive (Ptr<Packet> packet, Mac48Address source, Mac48Address dest)
   if (mSuccess)
     {
       uint32_t flowId = flowIdTag.GetFlowId ();
-      Ptr<EncapKey> key = Create<EncapKey> (source, dest, flowId);
-      EncapContainer_t::iterator it = m_decaps.find (key);
+      Ptr<SatBaseEncapsulator> decap = m_decapIndex.Find (source, dest, flowId);
 
       // Control messages not received by this method
       if (flowId == SatEnums::CONTROL_FID)
@@ -182,18 +182,18 @@ SatLlc::Receive (Ptr<Packet> packet, Mac48Address source, Mac48Address dest)
           NS_FATAL_ERROR ("Control messages should not be received by SatLlc::Receive () method!");
         }
 
-      if (it == m_decaps.end ())
+      if (decap == 0)
         {
           /**
            * Decapsulator not found, thus create a new one. This method is
            * implemented in the inherited classes, which knows which type
            * of decapsulator to create.
            */
-          CreateDecap (key);
-          it = m_decaps.find (key);
+          CreateDecap (Create<EncapKey> (source, dest, flowId));
+          decap = m_decapIndex.Find (source, dest, flowId);
         }
 
-      it->second->ReceivePdu (packet);
+      decap->ReceivePdu (packet);
     }
 }
 
@@ -211,12 +211,11 @@ SatLlc::ReceiveAck (Ptr<SatArqAckMessage> ack, Mac48Address source, Mac48Address
    */
   uint32_t flowId = ack->GetFlowId ();
 
-  Ptr<EncapKey> key = Create<EncapKey> (dest, source, flowId);
-  EncapContainer_t::iterator it = m_encaps.find (key);
+  Ptr<SatBaseEncapsulator> encap = m_encapIndex.Find (dest, source, flowId);
 
-  if (it != m_encaps.end ())
+  if (encap != 0)
     {
-      it->second->ReceiveAck (ack);
+      encap->ReceiveAck (ack);
     }
   else
     {
@@ -270,15 +269,11 @@ SatLlc::AddEncap (Mac48Address source, Mac48Address dest, uint8_t flowId, Ptr<Sa
 {
   NS_LOG_FUNCTION (this << source << dest << (uint32_t) flowId);
 
-  Ptr<EncapKey> key = Create<EncapKey> (source, dest, flowId);
-  EncapContainer_t::iterator it = m_encaps.find (key);
-
-  if (it == m_encaps.end ())
+  if (m_encapIndex.Find (source, dest, flowId) == 0)
     {
       NS_LOG_INFO ("Add encapsulator with key (" << source << ", " << dest << ", " << (uint32_t) flowId << ")");
 
-      std::pair<EncapContainer_t::iterator, bool> result = m_encaps.insert (std::make_pair (key, enc));
-      if (result.second == false)
+      if (!InsertEncap (Create<EncapKey> (source, dest, flowId), enc))
         {
           NS_FATAL_ERROR ("Insert to map with key (" << source << ", " << dest << ", " << (uint32_t) flowId << ") failed!");
         }
@@ -294,15 +289,11 @@ SatLlc::AddDecap (Mac48Address source, Mac48Address dest, uint8_t flowId, Ptr<Sa
 {
   NS_LOG_FUNCTION (this << source << dest << (uint32_t) flowId);
 
-  Ptr<EncapKey> key = Create<EncapKey> (source, dest, flowId);
-  EncapContainer_t::iterator it = m_decaps.find (key);
-
-  if (it == m_decaps.end ())
+  if (m_decapIndex.Find (source, dest, flowId) == 0)
     {
       NS_LOG_INFO ("Add Decapsulator with key (" << source << ", " << dest << ", " << (uint32_t) flowId << ")");
 
-      std::pair<EncapContainer_t::iterator, bool> result = m_decaps.insert (std::make_pair (key, dec));
-      if (result.second == false)
+      if (!InsertDecap (Create<EncapKey> (source, dest, flowId), dec))
         {
           NS_FATAL_ERROR ("Insert to map with key (" << source << ", " << dest << ", " << (uint32_t) flowId << ") failed!");
         }
@@ -313,6 +304,45 @@ SatLlc::AddDecap (Mac48Address source, Mac48Address dest, uint8_t flowId, Ptr<Sa
     }
 }
 
+bool
+SatLlc::InsertEncap (Ptr<EncapKey> key, Ptr<SatBaseEncapsulator> encap)
+{
+  NS_LOG_FUNCTION (this << key->m_source << key->m_destination << (uint32_t)(key->m_flowId));
+
+  std::pair<EncapContainer_t::iterator, bool> result = m_encaps.insert (std::make_pair (key, encap));
+
+  if (result.second)
+    {
+      m_encapIndex.Insert (key, encap);
+    }
+
+  return result.second;
+}
+
+bool
+SatLlc::InsertDecap (Ptr<EncapKey> key, Ptr<SatBaseEncapsulator> decap)
+{
+  NS_LOG_FUNCTION (this << key->m_source << key->m_destination << (uint32_t)(key->m_flowId));
+
+  std::pair<EncapContainer_t::iterator, bool> result = m_decaps.insert (std::make_pair (key, decap));
+
+  if (result.second)
+    {
+      m_decapIndex.Insert (key, decap);
+    }
+
+  return result.second;
+}
+
+void
+SatLlc::EraseEncap (EncapContainer_t::iterator it)
+{
+  NS_LOG_FUNCTION (this << it->first->m_source << it->first->m_destination << (uint32_t)(it->first->m_flowId));
+
+  m_encapIndex.Erase (it->first->m_source, it->first->m_destination, it->first->m_flowId);
+  m_encaps.erase (it);
+}
+
 void
 SatLlc::SetNodeInfo (Ptr<SatNodeInfo> nodeInfo)
 {
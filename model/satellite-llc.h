@@ -29,6 +29,7 @@
 #include <ns3/simple-ref-count.h>
 #include <ns3/mac48-address.h>
 #include <ns3/satellite-base-encapsulator.h>
+#include <ns3/satellite-encap-index.h>
 
 namespace ns3 {
 
@@ -39,56 +40,6 @@ class SatControlMessage;
 class SatSchedulingObject;
 class SatNodeInfo;
 
-/**
- * \ingroup satellite
- * \brief EncapKey class is used as a key in the encapsulator/decapsulator container. It
- * will hold the flow information related to one single encapsulator/decapsulator.
- */
-class EncapKey : public SimpleRefCount <EncapKey>
-{
-public:
-  Mac48Address  m_source;
-  Mac48Address  m_destination;
-  int8_t        m_flowId;
-
-  EncapKey (const Mac48Address source, const Mac48Address dest, const uint8_t flowId)
-    : m_source (source),
-    m_destination (dest),
-    m_flowId (flowId)
-  {
-  }
-};
-
-/**
- * \ingroup satellite
- * \brief EncapKeyCompare is used as a custom compare method within
- * EncapContainer map. Encap key has three member variables (source
- * address, dest address and flow id) and to be able to store them in
- * a map container, a custom compare method needs to be implemented.
- */
-class EncapKeyCompare
-{
-public:
-  bool operator() (Ptr<EncapKey> key1, Ptr<EncapKey> key2) const
-  {
-    if ( key1->m_source == key2->m_source )
-      {
-        if ( key1->m_destination == key2->m_destination )
-          {
-            return key1->m_flowId < key2->m_flowId;
-          }
-        else
-          {
-            return key1->m_destination < key2->m_destination;
-          }
-      }
-    else
-      {
-        return key1->m_source < key2->m_source;
-      }
-  }
-};
-
 /**
  * \ingroup satellite
  * \brief SatLlc base class holds the UT specific SatBaseEncapsulator instances, which are responsible
@@ -335,6 +286,28 @@ protected:
    */
   virtual void ReceiveAck (Ptr<SatArqAckMessage> ack, Mac48Address source, Mac48Address dest);
 
+  /**
+   * \brief Store a new encapsulator to the encapsulator map and index.
+   * \param key Encapsulator key
+   * \param encap Encapsulator
+   * \return false if the key is already in use, otherwise true
+   */
+  bool InsertEncap (Ptr<EncapKey> key, Ptr<SatBaseEncapsulator> encap);
+
+  /**
+   * \brief Store a new decapsulator to the decapsulator map and index.
+   * \param key Decapsulator key
+   * \param decap Decapsulator
+   * \return false if the key is already in use, otherwise true
+   */
+  bool InsertDecap (Ptr<EncapKey> key, Ptr<SatBaseEncapsulator> decap);
+
+  /**
+   * \brief Remove an encapsulator from the encapsulator map and index.
+   * \param it Iterator of the encapsulator map
+   */
+  void EraseEncap (EncapContainer_t::iterator it);
+
   /**
    * Trace callback used for packet tracing:
    */
@@ -364,6 +337,16 @@ protected:
    */
   EncapContainer_t m_decaps;
 
+  /**
+   * Hash index of the encapsulators for per packet lookups
+   */
+  SatEncapIndex m_encapIndex;
+
+  /**
+   * Hash index of the decapsulators for per packet lookups
+   */
+  SatEncapIndex m_decapIndex;
+
   /**
    * Is FWD link ARQ enabled
    */
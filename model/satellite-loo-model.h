@@ -131,12 +131,12 @@ private:
   /**
    * \brief Direct signal oscillators
    */
-  std::vector< std::vector< Ptr<SatFadingOscillator> > > m_directSignalOscillators;
+  std::vector<SatFadingOscillatorBank> m_directSignalOscillators;
 
   /**
    * \brief Multipath oscillators
    */
-  std::vector< std::vector< Ptr<SatFadingOscillator> > > m_multipathOscillators;
+  std::vector<SatFadingOscillatorBank> m_multipathOscillators;
 
   /**
    * \brief Function for constructing direct signal oscillators
@@ -148,22 +148,6 @@ private:
    */
   void ConstructMultipathOscillators ();
 
-  /**
-   * \brief Function for calculating cosine wave oscillator complex sum
-   * \param oscillator oscillator
-   * \param timeInSeconds current time in seconds
-   * \return sum
-   */
-  std::complex<double> GetOscillatorCosineWaveSum (std::vector< Ptr<SatFadingOscillator> > oscillator, double timeInSeconds);
-
-  /**
-   * \brief Function for calculating oscillator complex sum
-   * \param oscillator oscillator
-   * \param timeInSeconds current time in seconds
-   * \return sum
-   */
-  std::complex<double> GetOscillatorComplexSum (std::vector< Ptr<SatFadingOscillator> > oscillator, double timeInSeconds);
-
   /**
    * \brief Function for setting the state
    * \param newState new state
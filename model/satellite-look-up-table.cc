@@ -20,6 +20,8 @@
  */
 
 #include <cmath>
+#include <algorithm>
+#include <functional>
 
 #include "ns3/log.h"
 #include "ns3/fatal-error.h"
@@ -34,12 +36,34 @@ NS_OBJECT_ENSURE_REGISTERED (SatLookUpTable);
 
 
 SatLookUpTable::SatLookUpTable (std::string linkResultPath)
+  : m_ifs (0)
 {
   NS_LOG_FUNCTION (this << linkResultPath);
   Load (linkResultPath);
 }
 
 
+SatLookUpTable::SatLookUpTable (std::string name, const double* esNoDb, const double* bler, uint32_t rows)
+  : m_ifs (0)
+{
+  NS_LOG_FUNCTION (this << name << rows);
+
+  m_esNoDb.reserve (rows);
+  m_bler.reserve (rows);
+
+  for (uint32_t i = 0; i < rows; ++i)
+    {
+      AddRow (esNoDb[i], bler[i], name);
+    }
+
+  // at least contains one row
+  if (m_esNoDb.empty ())
+    {
+      NS_FATAL_ERROR ("Error reading data from " << name << ".");
+    }
+}
+
+
 SatLookUpTable::~SatLookUpTable ()
 {
   NS_LOG_FUNCTION (this);
@@ -97,15 +121,9 @@ SatLookUpTable::GetBler (double esNoDb) const
       return 1.0;
     }
 
-  uint16_t i = 1;
-
-  while ((i < n) && (esNoDb > m_esNoDb[i]))
-    {
-      i++;
-    }
-
-  NS_LOG_DEBUG (this << " i=" << i << " esno[i]=" << m_esNoDb[i]
-                     << " bler[i]=" << m_bler[i]);
+  // Binary search for the first entry (after the first one) for which esNoDb <= esno[i].
+  // Es/No values are verified to be strictly increasing when loaded.
+  uint16_t i = std::lower_bound (m_esNoDb.begin () + 1, m_esNoDb.end (), esNoDb) - m_esNoDb.begin ();
 
   if (i >= n)
     {
@@ -127,6 +145,9 @@ SatLookUpTable::GetBler (double esNoDb) const
       NS_ASSERT (i > 0);
       NS_ASSERT (i < n);
 
+      NS_LOG_DEBUG (this << " i=" << i << " esno[i]=" << m_esNoDb[i]
+                         << " bler[i]=" << m_bler[i]);
+
       double esno = esNoDb;
       double esno0 = m_esNoDb[i - 1];
       double esno1 = m_esNoDb[i];
@@ -163,18 +184,19 @@ SatLookUpTable::GetEsNoDb (double blerTarget) const
       NS_FATAL_ERROR ("The BLER target is set to be too high!");
     }
 
-  double sinr = 0.0;
-  // Go through the list from end to beginning
-  for (uint32_t i = 0; i < n; ++i)
+  // Binary search for the first entry for which blerTarget >= bler[i].
+  // BLER values are verified to be non-increasing when loaded.
+  uint32_t i = std::lower_bound (m_bler.begin (), m_bler.end (), blerTarget, std::greater<double> ()) - m_bler.begin ();
+
+  // The requested BLER equals to the highest BLER entry
+  if (i == 0)
     {
-      if (blerTarget >= m_bler[i])
-        {
-          sinr = SatUtils::Interpolate (blerTarget, m_bler[i - 1], m_bler[i], m_esNoDb[i - 1], m_esNoDb[i]);
-          NS_LOG_INFO (this << " Interpolate: " << blerTarget << " to SINR = " << sinr << "(bler0: " << m_bler[i - 1] << ", bler1: " << m_bler[i] << ", sinr0: " << m_esNoDb[i - 1] << ", sinr1: " << m_esNoDb[i] << ")");
-          return sinr;
-        }
+      return m_esNoDb[0];
     }
 
+  double sinr = SatUtils::Interpolate (blerTarget, m_bler[i - 1], m_bler[i], m_esNoDb[i - 1], m_esNoDb[i]);
+  NS_LOG_INFO (this << " Interpolate: " << blerTarget << " to SINR = " << sinr << "(bler0: " << m_bler[i - 1] << ", bler1: " << m_bler[i] << ", sinr0: " << m_esNoDb[i - 1] << ", sinr1: " << m_esNoDb[i] << ")");
+
   return sinr;
 } // end of double SatLookUpTable::GetSinr (double bler) const
 
@@ -201,27 +223,12 @@ SatLookUpTable::Load (std::string linkResultPath)
         }
     }
 
-  double lastEsNoDb = -100.0; // very low value
-  double lastBler = 1.0; // maximum value
-
   double esNoDb, bler;
   *m_ifs >> esNoDb >> bler;
 
   while (m_ifs->good ())
     {
-      NS_LOG_DEBUG (this << " sinrDb=" << esNoDb << ", bler=" << bler);
-
-      // SANITY CHECK PART I
-      if ((esNoDb <= lastEsNoDb) || (bler > lastBler))
-        {
-          NS_FATAL_ERROR ("The file " << linkResultPath << " is not properly sorted.");
-        }
-
-      // record the values
-      m_esNoDb.push_back (esNoDb);
-      m_bler.push_back (bler);
-      lastEsNoDb = esNoDb;
-      lastBler = bler;
+      AddRow (esNoDb, bler, "the file " + linkResultPath);
 
       // get next row
       *m_ifs >> esNoDb >> bler;
@@ -245,4 +252,24 @@ SatLookUpTable::Load (std::string linkResultPath)
 } // end of void Load (std::string linkResultPath)
 
 
+void
+SatLookUpTable::AddRow (double esNoDb, double bler, std::string name)
+{
+  NS_LOG_DEBUG (this << " sinrDb=" << esNoDb << ", bler=" << bler);
+
+  double lastEsNoDb = m_esNoDb.empty () ? -100.0 : m_esNoDb.back (); // very low value
+  double lastBler = m_bler.empty () ? 1.0 : m_bler.back (); // maximum value
+
+  // SANITY CHECK PART I
+  if ((esNoDb <= lastEsNoDb) || (bler > lastBler))
+    {
+      NS_FATAL_ERROR ("The link results in " << name << " are not properly sorted.");
+    }
+
+  // record the values
+  m_esNoDb.push_back (esNoDb);
+  m_bler.push_back (bler);
+}
+
+
 } // end of namespace ns3
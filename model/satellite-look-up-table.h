@@ -44,6 +44,16 @@ public:
    */
   SatLookUpTable (std::string linkResultPath);
 
+  /**
+   * Constructor with already loaded link results, e.g. from a link
+   * results bundle.
+   * \param name Name of the link results used in error messages
+   * \param esNoDb Es/No values in dB
+   * \param bler BLER values corresponding to the Es/No values
+   * \param rows Number of rows in the link results
+   */
+  SatLookUpTable (std::string name, const double* esNoDb, const double* bler, uint32_t rows);
+
   /**
    * Destructor for SatLookUpTable
    */
@@ -78,6 +88,14 @@ private:
    */
   void Load (std::string linkResultPath);
 
+  /**
+   * \brief Add a row to the link results
+   * \param esNoDb Es/No value in dB
+   * \param bler BLER value
+   * \param name Name of the link results used in error messages
+   */
+  void AddRow (double esNoDb, double bler, std::string name);
+
   std::vector<double> m_esNoDb;
   std::vector<double> m_bler;
   std::ifstream *m_ifs;
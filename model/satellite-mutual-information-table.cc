@@ -20,6 +20,7 @@
  */
 
 #include <cmath>
+#include <algorithm>
 
 #include "ns3/log.h"
 #include "ns3/double.h"
@@ -105,15 +106,9 @@ SatMutualInformationTable::GetNormalizedSymbolInformation (double snirDb) const
       return 0.0;
     }
 
-  uint16_t i = 1;
-
-  while ((i < n) && (snirDb > m_snirDb[i]))
-    {
-      i++;
-    }
-
-  NS_LOG_DEBUG (this << " i=" << i << " snir[i]=" << m_snirDb[i]
-                     << " symbolInformation[i]=" << m_symbolInformation[i]);
+  // Binary search for the first entry (after the first one) for which snirDb <= snir[i].
+  // SNIR values are verified to be strictly increasing when loaded.
+  uint16_t i = std::lower_bound (m_snirDb.begin () + 1, m_snirDb.end (), snirDb) - m_snirDb.begin ();
 
   if (i >= n)
     {
@@ -127,6 +122,9 @@ SatMutualInformationTable::GetNormalizedSymbolInformation (double snirDb) const
       NS_ASSERT (i > 0);
       NS_ASSERT (i < n);
 
+      NS_LOG_DEBUG (this << " i=" << i << " snir[i]=" << m_snirDb[i]
+                         << " symbolInformation[i]=" << m_symbolInformation[i]);
+
       double snir = snirDb;
       double snir0 = m_snirDb[i - 1];
       double snir1 = m_snirDb[i];
@@ -173,17 +171,16 @@ SatMutualInformationTable::GetSnirDb (double symbolInformationTarget) const
       return m_snirDb[n - 1];
     }
 
-  double snir = 0.0;
-  // Go through the list from end to beginning
-  for (uint32_t i = 0; i < n; ++i)
-    {
-      if (symbolInformationTarget <= m_symbolInformation[i])
-        {
-          snir = SatUtils::Interpolate (symbolInformationTarget, m_symbolInformation[i - 1], m_symbolInformation[i], m_snirDb[i - 1], m_snirDb[i]);
-          NS_LOG_INFO (this << " Interpolate: " << symbolInformationTarget << " to snir = " << snir << "(symbolInformation0: " << m_symbolInformation[i - 1] << ", symbolInformation1: " << m_symbolInformation[i] << ", snir0: " << m_snirDb[i - 1] << ", snir1: " << m_snirDb[i] << ")");
-          return snir;
-        }
-    }
+  // Binary search for the first entry for which symbolInformationTarget <= symbolInformation[i].
+  // Symbol Information values are verified to be non-decreasing when loaded, and the
+  // target is known to be higher than the first entry, thus i > 0.
+  uint32_t i = std::lower_bound (m_symbolInformation.begin (), m_symbolInformation.end (), symbolInformationTarget) - m_symbolInformation.begin ();
+
+  NS_ASSERT (i > 0);
+  NS_ASSERT (i < n);
+
+  double snir = SatUtils::Interpolate (symbolInformationTarget, m_symbolInformation[i - 1], m_symbolInformation[i], m_snirDb[i - 1], m_snirDb[i]);
+  NS_LOG_INFO (this << " Interpolate: " << symbolInformationTarget << " to snir = " << snir << "(symbolInformation0: " << m_symbolInformation[i - 1] << ", symbolInformation1: " << m_symbolInformation[i] << ", snir0: " << m_snirDb[i - 1] << ", snir1: " << m_snirDb[i] << ")");
 
   return snir;
 } // end of double SatMutualInformationTable::GetSnir (double symbolInformationTarget) const
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <new>
+
+#include "satellite-object-pool.h"
+
+namespace ns3 {
+
+// No logging in this file, since the pool is used by the allocation
+// operators and the log components may not exist yet.
+
+SatObjectPool::SatObjectPool (size_t blockSize)
+  : m_blockSize (blockSize),
+  m_freeBlocks (),
+  m_nAllocations (0),
+  m_nHeapAllocations (0),
+  m_nInUse (0)
+{
+}
+
+SatObjectPool::~SatObjectPool ()
+{
+  for (std::vector<void*>::iterator it = m_freeBlocks.begin (); it != m_freeBlocks.end (); ++it)
+    {
+      ::operator delete (*it);
+    }
+  m_freeBlocks.clear ();
+}
+
+void*
+SatObjectPool::Allocate (size_t size)
+{
+  if (size != m_blockSize)
+    {
+      return ::operator new (size);
+    }
+
+  void* p;
+
+  if (m_freeBlocks.empty ())
+    {
+      p = ::operator new (m_blockSize);
+      m_nHeapAllocations++;
+    }
+  else
+    {
+      p = m_freeBlocks.back ();
+      m_freeBlocks.pop_back ();
+    }
+
+  m_nAllocations++;
+  m_nInUse++;
+
+  return p;
+}
+
+void
+SatObjectPool::Deallocate (void* p, size_t size)
+{
+  if (p == 0)
+    {
+      return;
+    }
+
+  if (size != m_blockSize)
+    {
+      ::operator delete (p);
+      return;
+    }
+
+  m_freeBlocks.push_back (p);
+  m_nInUse--;
+}
+
+} // namespace ns3
@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_OBJECT_POOL_H_
+#define SATELLITE_OBJECT_POOL_H_
+
+#include <cstddef>
+#include <vector>
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ * \brief SatObjectPool is a free list of fixed size memory blocks. It is used
+ * by the class specific allocation operators of frequently created objects,
+ * e.g. SatBbFrame and SatSignalParameters, so that the memory of the released
+ * objects is reused instead of returning it to the heap. Since only the
+ * allocation is changed, the objects are still created with Create<> and
+ * CreateObject<> and reference counted with Ptr<>.
+ *
+ * Requests of other sizes than the block size, e.g. from derived classes, are
+ * passed to the global allocation operators. The pool keeps counters of the
+ * requests to allow verifying the reduction of the heap allocations.
+ */
+class SatObjectPool
+{
+public:
+  /**
+   * Constructor
+   * \param blockSize Size of the pooled memory blocks in bytes
+   */
+  SatObjectPool (size_t blockSize);
+
+  /**
+   * Destructor, releases the free blocks. The pools of the allocation
+   * operators are never destroyed, since the pooled objects may be released
+   * during the destruction of the static objects. Only pools with a limited
+   * lifetime, e.g. local pools, are destroyed.
+   */
+  ~SatObjectPool ();
+
+  /**
+   * \brief Allocate memory for an object.
+   * \param size Size of the object in bytes
+   * \return Pointer to the allocated memory
+   */
+  void* Allocate (size_t size);
+
+  /**
+   * \brief Release the memory of an object.
+   * \param p Pointer to the memory returned by Allocate
+   * \param size Size of the object in bytes
+   */
+  void Deallocate (void* p, size_t size);
+
+  /**
+   * \brief Get the number of allocation requests served by the pool.
+   * \return Number of allocations
+   */
+  inline uint64_t GetNAllocations () const
+  {
+    return m_nAllocations;
+  }
+
+  /**
+   * \brief Get the number of allocations which needed new memory from the heap.
+   * \return Number of heap allocations
+   */
+  inline uint64_t GetNHeapAllocations () const
+  {
+    return m_nHeapAllocations;
+  }
+
+  /**
+   * \brief Get the number of allocated objects not yet released.
+   * \return Number of objects in use
+   */
+  inline uint64_t GetNInUse () const
+  {
+    return m_nInUse;
+  }
+
+  /**
+   * \brief Get the number of released blocks waiting for reuse.
+   * \return Number of free blocks
+   */
+  inline uint64_t GetNFree () const
+  {
+    return m_freeBlocks.size ();
+  }
+
+private:
+  size_t m_blockSize;
+  std::vector<void*> m_freeBlocks;
+  uint64_t m_nAllocations;
+  uint64_t m_nHeapAllocations;
+  uint64_t m_nInUse;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_OBJECT_POOL_H_ */
@@ -26,6 +26,72 @@ NS_LOG_COMPONENT_DEFINE ("SatPerFragmentInterference");
 
 namespace ns3 {
 
+SatFragmentInterferenceCollector::SatFragmentInterferenceCollector ()
+  : m_ifPowerAtEventChangeW (),
+  m_maxFragmentsCount (1)
+{
+}
+
+
+void
+SatFragmentInterferenceCollector::Clear ()
+{
+  m_ifPowerAtEventChangeW.clear ();
+  m_ifPowerAtEventChangeW.reserve (m_maxFragmentsCount);
+}
+
+
+void
+SatFragmentInterferenceCollector::AddOwnStart (double ifPowerW)
+{
+  m_ifPowerAtEventChangeW.emplace_back (0.0, ifPowerW);
+}
+
+
+void
+SatFragmentInterferenceCollector::AddInterferentEvent (long double timeRatio, double interferenceValue, double& ifPowerW)
+{
+  ifPowerW += interferenceValue;
+  m_ifPowerAtEventChangeW.emplace_back (1.0 - timeRatio, ifPowerW);
+}
+
+
+std::vector< std::pair<double, double> >
+SatFragmentInterferenceCollector::GetFragments ()
+{
+  std::size_t fragmentsCount = m_ifPowerAtEventChangeW.size ();
+  if (!fragmentsCount)
+    {
+      NS_FATAL_ERROR ("Interference computation did not find a single fragment");
+    }
+
+  if (fragmentsCount > m_maxFragmentsCount)
+    {
+      m_maxFragmentsCount = fragmentsCount;
+    }
+
+  // Convert time ratio into durations
+  std::vector< std::pair<double, double> > ifPowerPerFragment;
+  ifPowerPerFragment.reserve (fragmentsCount);
+
+  std::vector<std::pair<double, double>>::const_iterator iter = m_ifPowerAtEventChangeW.begin ();
+  std::pair<double, double> eventChangeInPower = *iter;
+  for (++iter; iter != m_ifPowerAtEventChangeW.end (); ++iter)
+    {
+      ifPowerPerFragment.emplace_back (iter->first - eventChangeInPower.first, eventChangeInPower.second);
+      eventChangeInPower = *iter;
+    }
+
+  // Account for the last fragment duration
+  if (eventChangeInPower.first != 1.0)
+    {
+      ifPowerPerFragment.emplace_back (1.0 - eventChangeInPower.first, eventChangeInPower.second);
+    }
+
+  return ifPowerPerFragment;
+}
+
+
 NS_OBJECT_ENSURE_REGISTERED (SatPerFragmentInterference);
 
 TypeId
@@ -49,8 +115,7 @@ SatPerFragmentInterference::GetInstanceTypeId (void) const
 
 SatPerFragmentInterference::SatPerFragmentInterference ()
   : SatPerPacketInterference (),
-  m_ifPowerAtEventChangeW (),
-  m_maxFragmentsCount (1)
+  m_fragments ()
 {
   NS_LOG_FUNCTION (this);
 }
@@ -58,8 +123,7 @@ SatPerFragmentInterference::SatPerFragmentInterference ()
 
 SatPerFragmentInterference::SatPerFragmentInterference (SatEnums::ChannelType_t channelType, double rxBandwidthHz)
   : SatPerPacketInterference (channelType, rxBandwidthHz),
-  m_ifPowerAtEventChangeW (),
-  m_maxFragmentsCount (1)
+  m_fragments ()
 {
   NS_LOG_FUNCTION (this);
 }
@@ -76,43 +140,13 @@ SatPerFragmentInterference::DoCalculate (Ptr<SatInterference::InterferenceChange
 {
   NS_LOG_FUNCTION (this);
 
-  m_ifPowerAtEventChangeW.clear ();
-  m_ifPowerAtEventChangeW.reserve (m_maxFragmentsCount);
+  m_fragments.Clear ();
 
   // Use the per packet interference computation hooks to store
   // interferences at each event associated to the current packet
   SatPerPacketInterference::DoCalculate (event);
 
-  std::size_t fragmentsCount = m_ifPowerAtEventChangeW.size ();
-  if (!fragmentsCount)
-    {
-      NS_FATAL_ERROR ("Interference computation did not find a single fragment");
-    }
-
-  if (fragmentsCount > m_maxFragmentsCount)
-    {
-      m_maxFragmentsCount = fragmentsCount;
-    }
-
-  // Convert time ratio into durations
-  std::vector< std::pair<double, double> > ifPowerPerFragment;
-  ifPowerPerFragment.reserve (fragmentsCount);
-
-  std::vector<std::pair<double, double>>::const_iterator iter = m_ifPowerAtEventChangeW.begin ();
-  std::pair<double, double> eventChangeInPower = *iter;
-  for (++iter; iter != m_ifPowerAtEventChangeW.end (); ++iter)
-    {
-      ifPowerPerFragment.emplace_back (iter->first - eventChangeInPower.first, eventChangeInPower.second);
-      eventChangeInPower = *iter;
-    }
-
-  // Account for the last fragment duration
-  if (eventChangeInPower.first != 1.0)
-    {
-      ifPowerPerFragment.emplace_back (1.0 - eventChangeInPower.first, eventChangeInPower.second);
-    }
-
-  return ifPowerPerFragment;
+  return m_fragments.GetFragments ();
 }
 
 
@@ -121,7 +155,7 @@ SatPerFragmentInterference::onOwnStartReached (double ifPowerW)
 {
   // Hook into per packet interference computation to store
   // interference level at the beginning of the packet
-  m_ifPowerAtEventChangeW.emplace_back(0.0, ifPowerW);
+  m_fragments.AddOwnStart (ifPowerW);
 }
 
 
@@ -130,8 +164,7 @@ SatPerFragmentInterference::onInterferentEvent (long double timeRatio, double in
 {
   // Hook into per packet interference computation to store
   // interference level at each event change
-  ifPowerW += interferenceValue;
-  m_ifPowerAtEventChangeW.emplace_back(1.0 - timeRatio, ifPowerW);
+  m_fragments.AddInterferentEvent (timeRatio, interferenceValue, ifPowerW);
 }
 
 }
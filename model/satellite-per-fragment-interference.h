@@ -25,6 +25,53 @@
 
 namespace ns3 {
 
+/**
+ * \ingroup satellite
+ * \brief Collector of the interference power of the fragments of a packet,
+ * fed by the hooks of a packet by packet interference computation. Shared by
+ * SatPerFragmentInterference and SatFlatPerFragmentInterference.
+ */
+class SatFragmentInterferenceCollector
+{
+public:
+  /**
+   * Default constructor
+   */
+  SatFragmentInterferenceCollector ();
+
+  /**
+   * Forget the fragments of the previous packet.
+   */
+  void Clear ();
+
+  /**
+   * Store the interference level at the beginning of the packet.
+   * \param ifPowerW interference power at the start of the packet
+   */
+  void AddOwnStart (double ifPowerW);
+
+  /**
+   * Update the interference power by the power of an interferent event and
+   * store the interference level at the event change.
+   * \param timeRatio ratio of the time from the event change to the end of
+   * the packet to the packet duration
+   * \param interferenceValue the interference value of the event
+   * \param ifPowerW the current interference power, which is updated
+   */
+  void AddInterferentEvent (long double timeRatio, double interferenceValue, double& ifPowerW);
+
+  /**
+   * Convert the stored interference levels into fragments.
+   * \return (relative duration, interference power) of each fragment
+   */
+  std::vector< std::pair<double, double> > GetFragments ();
+
+private:
+  std::vector<std::pair<double, double>> m_ifPowerAtEventChangeW;
+
+  uint32_t m_maxFragmentsCount;
+};
+
 /**
  * \ingroup satellite
  * \brief Packet fragment by packet fragment interference. Interference
@@ -97,9 +144,7 @@ protected:
   void onInterferentEvent (long double timeRatio, double interferenceValue, double& ifPowerW);
 
 private:
-  std::vector<std::pair<double, double>> m_ifPowerAtEventChangeW;
-
-  uint32_t m_maxFragmentsCount;
+  SatFragmentInterferenceCollector m_fragments;
 };
 
 }  // namespace ns3
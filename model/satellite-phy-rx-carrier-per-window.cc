@@ -54,7 +54,8 @@ SatPhyRxCarrierPerWindow::SatPhyRxCarrierPerWindow (uint32_t carrierId,
   m_spreadingFactor (0),
   m_windowEndSchedulingInitialized (false),
   m_detectionThreshold (0.0),
-  m_sicEnabled (true)
+  m_sicEnabled (true),
+  m_nextSequenceNumber (0)
 {
   NS_LOG_FUNCTION (this);
   NS_LOG_INFO ("Constructor called with arguments " << carrierId << ", " << carrierConf << ", and " << randomAccessEnabled);
@@ -154,6 +155,11 @@ SatPhyRxCarrierPerWindow::GetTypeId (void)
 void
 SatPhyRxCarrierPerWindow::DoDispose ()
 {
+  m_snirIndex.clear ();
+  m_windowPackets.clear ();
+  m_windowMaxEndTimes.clear ();
+  m_essaPacketContainer.clear ();
+
   SatPhyRxCarrierPerSlot::DoDispose ();
 }
 
@@ -183,6 +189,7 @@ SatPhyRxCarrierPerWindow::ReceiveSlot (SatPhyRxCarrier::rxParams_s packetRxParam
   params.isInsideWindow = false;
   params.meanSinr = -1.0;
   params.preambleMeanSinr = -1.0;
+  params.sequenceNumber = 0;
 
   // Calculate SINR, gamma and ifPowerPerFragment
   CalculatePacketInterferenceVectors (params);
@@ -373,6 +380,9 @@ SatPhyRxCarrierPerWindow::ProcessWindow (Time startTime, Time endTime)
   /// Get packets in window
   std::pair<packetList_t::iterator, packetList_t::iterator> windowBounds = GetWindowBounds (startTime, endTime);
 
+  /// Index the packets by SNIR and arrival time
+  BuildWindowIndices (windowBounds);
+
   uint32_t i = 0;
   while (i < m_windowSicIterations)
     {
@@ -389,6 +399,7 @@ SatPhyRxCarrierPerWindow::ProcessWindow (Time startTime, Time endTime)
 
           NS_LOG_INFO ("SatPhyRxCarrierPerWindow::DoWindowEnd - Process packet " << packet_it->rxParams->m_txInfo.crdsaUniquePacketId << " from " << packet_it->sourceAddress);
           /// MIESM (block 3)
+          RemoveFromSnirIndex (packet_it);
           packet_it->hasBeenUpdated = false;
           /// Get effective SINR
           double sinrEffective = GetEffectiveSnir (*packet_it);
@@ -430,6 +441,10 @@ SatPhyRxCarrierPerWindow::ProcessWindow (Time startTime, Time endTime)
       /// If decoded, Packet could be deleted, since interference information
       /// is stored in each packet; but we'll keep it for logging purposes
     }
+  m_snirIndex.clear ();
+  m_windowPackets.clear ();
+  m_windowMaxEndTimes.clear ();
+
   /// measure random access load in window
   if (IsRandomAccessDynamicLoadControlEnabled ())
     {
@@ -450,9 +465,16 @@ SatPhyRxCarrierPerWindow::DoSic (packetList_t::iterator processedPacket, std::pa
 
   NS_LOG_INFO ("SatPhyRxCarrierPerWindow::DoSic - eliminate interference from packet " << processedPacket->rxParams->m_txInfo.crdsaUniquePacketId << " from " << processedPacket->sourceAddress);
 
+  /// Skip the packets ending before the processed packet: the running maximum of the
+  /// end times gives the first packet which may still overlap with it
+  std::vector<Time>::iterator firstOverlap = std::upper_bound (m_windowMaxEndTimes.begin (), m_windowMaxEndTimes.end (), processedPacket->arrivalTime);
+
   /// Update SIC on interfering packets
-  for (packetList_t::iterator packet_it = windowBounds.first; packet_it != windowBounds.second; packet_it++)
+  for (std::vector<packetList_t::iterator>::iterator window_it = m_windowPackets.begin () + (firstOverlap - m_windowMaxEndTimes.begin ());
+       window_it != m_windowPackets.end (); window_it++)
     {
+      packetList_t::iterator packet_it = *window_it;
+
       /// Stop iterating for packets arriving after the processed packet
       if (packet_it->arrivalTime >= processedPacket->arrivalTime + processedPacket->duration)
         {
@@ -474,7 +496,9 @@ SatPhyRxCarrierPerWindow::DoSic (packetList_t::iterator processedPacket, std::pa
       /// Eliminate residual interference and recalculate the packets vectors
       GetInterferenceEliminationModel ()->EliminateInterferences (packet_it->rxParams, processedPacket->rxParams, processedPacket->meanSinr * m_spreadingFactor, normalizedTimes.first, normalizedTimes.second);
 
+      RemoveFromSnirIndex (packet_it);
       CalculatePacketInterferenceVectors (*packet_it);
+      AddToSnirIndex (packet_it);
     }
 
   /// Update packet Rx power and set the SIC flag (what for ??)
@@ -633,20 +657,54 @@ SatPhyRxCarrierPerWindow::GetHighestSnirPacket (const std::pair<SatPhyRxCarrierP
   NS_LOG_FUNCTION (this);
   NS_LOG_INFO ("SatPhyRxCarrierPerWindow::GetHighestSnirPacket");
 
-  SatPhyRxCarrierPerWindow::packetList_t::iterator it, max = windowBounds.second;
-  for (it = windowBounds.first; it != windowBounds.second; it++)
+  /// The index contains only packets not decoded, updated and inside the window
+  if (m_snirIndex.empty ())
     {
-      if (it->hasBeenDecoded || !(it->hasBeenUpdated) || !(it->isInsideWindow))
-        {
-          continue;
-        }
-      /// Check if bigger SINR
-      if ((max == windowBounds.second) || (it->meanSinr > max->meanSinr))
-        {
-          max = it;
-        }
+      return windowBounds.second;
+    }
+  return m_snirIndex.begin ()->second;
+}
+
+void
+SatPhyRxCarrierPerWindow::BuildWindowIndices (std::pair<packetList_t::iterator, packetList_t::iterator> windowBounds)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_snirIndex.clear ();
+  m_windowPackets.clear ();
+  m_windowMaxEndTimes.clear ();
+
+  Time maxEndTime;
+  for (packetList_t::iterator it = windowBounds.first; it != windowBounds.second; it++)
+    {
+      AddToSnirIndex (it);
+
+      Time endTime = it->arrivalTime + it->duration;
+      maxEndTime = (m_windowPackets.empty () || endTime > maxEndTime) ? endTime : maxEndTime;
+
+      m_windowPackets.push_back (it);
+      m_windowMaxEndTimes.push_back (maxEndTime);
+    }
+}
+
+void
+SatPhyRxCarrierPerWindow::AddToSnirIndex (packetList_t::iterator packet)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (packet->hasBeenDecoded || !(packet->hasBeenUpdated) || !(packet->isInsideWindow))
+    {
+      return;
     }
-  return max;
+  m_snirIndex.insert (std::make_pair (std::make_pair (packet->meanSinr, packet->sequenceNumber), packet));
+}
+
+void
+SatPhyRxCarrierPerWindow::RemoveFromSnirIndex (packetList_t::iterator packet)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_snirIndex.erase (std::make_pair (packet->meanSinr, packet->sequenceNumber));
 }
 
 bool
@@ -665,6 +723,7 @@ SatPhyRxCarrierPerWindow::AddEssaPacket (SatPhyRxCarrierPerWindow::essaPacketRxP
   NS_LOG_INFO ("SatPhyRxCarrierPerWindow::AddEssaPacket - Add packet " << essaPacketParams.rxParams->m_txInfo.crdsaUniquePacketId << " from " << essaPacketParams.sourceAddress << " Arrival Time: " << essaPacketParams.arrivalTime.GetSeconds () << " Duration: " << essaPacketParams.duration.GetSeconds ());
 
   /// Insert received packet in packets container
+  essaPacketParams.sequenceNumber = m_nextSequenceNumber++;
   m_essaPacketContainer.push_back (essaPacketParams);
 }
 
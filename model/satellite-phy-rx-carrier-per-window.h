@@ -21,6 +21,10 @@
 #ifndef SATELLITE_PHY_RX_CARRIER_PER_WINDOW_H
 #define SATELLITE_PHY_RX_CARRIER_PER_WINDOW_H
 
+#include <list>
+#include <map>
+#include <vector>
+
 #include <ns3/singleton.h>
 #include <ns3/satellite-rtn-link-time.h>
 #include <ns3/satellite-crdsa-replica-tag.h>
@@ -65,6 +69,7 @@ public:
     std::vector< std::pair<double, double> > gamma;
     Time arrivalTime;
     Time duration;
+    uint64_t sequenceNumber;
   } essaPacketRxParams_s;
 
   /**
@@ -153,6 +158,25 @@ protected:
 
 private:
   typedef std::list<SatPhyRxCarrierPerWindow::essaPacketRxParams_s> packetList_t;
+
+  /**
+   * \brief Key of the SNIR index: mean SNIR and sequence number of the packet
+   */
+  typedef std::pair<double, uint64_t> snirIndexKey_t;
+
+  /**
+   * \brief Ordering of the SNIR index: highest mean SNIR first, and the
+   * earliest received packet first among equal mean SNIRs
+   */
+  struct HigherSnirFirst
+  {
+    bool operator() (const snirIndexKey_t& a, const snirIndexKey_t& b) const
+    {
+      return (a.first > b.first) || (a.first == b.first && a.second < b.second);
+    }
+  };
+
+  typedef std::map<snirIndexKey_t, packetList_t::iterator, HigherSnirFirst> snirIndex_t;
   /**
    * \brief Function for storing the received E-SSA packets
    */
@@ -205,6 +229,22 @@ private:
    */
   packetList_t::iterator GetHighestSnirPacket (const std::pair<packetList_t::iterator, packetList_t::iterator> windowBounds);
 
+  /**
+   * \brief Build the SNIR and arrival time indices of the packets in the window
+   */
+  void BuildWindowIndices (std::pair<packetList_t::iterator, packetList_t::iterator> windowBounds);
+
+  /**
+   * \brief Add a packet to the SNIR index if it can be selected for decoding,
+   * i.e. it is inside the window, updated and not decoded
+   */
+  void AddToSnirIndex (packetList_t::iterator packet);
+
+  /**
+   * \brief Remove a packet from the SNIR index
+   */
+  void RemoveFromSnirIndex (packetList_t::iterator packet);
+
   /**
    * \brief Get the normalized start and end time between two interfering packets
    */
@@ -281,6 +321,28 @@ private:
    * \brief Enable Sic
    */
   uint32_t m_sicEnabled;
+
+  /**
+   * \brief Sequence number of the next received packet
+   */
+  uint64_t m_nextSequenceNumber;
+
+  /**
+   * \brief Packets of the processed window which can be selected for
+   * decoding, ordered by their mean SNIR
+   */
+  snirIndex_t m_snirIndex;
+
+  /**
+   * \brief Packets of the processed window in the container order
+   */
+  std::vector<packetList_t::iterator> m_windowPackets;
+
+  /**
+   * \brief Running maximum of the packet end times over m_windowPackets,
+   * used to skip the packets ending before a decoded packet in SIC
+   */
+  std::vector<Time> m_windowMaxEndTimes;
 };
 
 
@@ -25,12 +25,12 @@
 #include <ns3/boolean.h>
 #include <ns3/satellite-utils.h>
 #include <ns3/satellite-constant-interference.h>
+#include <ns3/satellite-flat-interference.h>
 #include <ns3/satellite-per-fragment-interference.h>
 #include <ns3/satellite-per-packet-interference.h>
 #include <ns3/satellite-traced-interference.h>
 #include <ns3/satellite-perfect-interference-elimination.h>
 #include <ns3/satellite-residual-interference-elimination.h>
-#include <ns3/satellite-mac-tag.h>
 #include <ns3/singleton.h>
 #include <ns3/satellite-composite-sinr-output-trace-container.h>
 #include <ns3/satellite-rtn-link-time.h>
@@ -153,6 +153,32 @@ SatPhyRxCarrier::DoCreateInterferenceModel (Ptr<SatPhyRxCarrierConf> carrierConf
           }
         break;
       }
+    case SatPhyRxCarrierConf::IF_PER_PACKET_FLAT:
+      {
+        NS_LOG_INFO (this << " Flat per packet interference model created for carrier: " << carrierId);
+        if (carrierConf->IsIntfOutputTraceEnabled ())
+          {
+            m_satInterference = CreateObject<SatFlatPerPacketInterference> (GetChannelType (), rxBandwidthHz);
+          }
+        else
+          {
+            m_satInterference = CreateObject<SatFlatPerPacketInterference> ();
+          }
+        break;
+      }
+    case SatPhyRxCarrierConf::IF_PER_FRAGMENT_FLAT:
+      {
+        NS_LOG_INFO (this << " Flat per fragment interference model created for carrier: " << carrierId);
+        if (carrierConf->IsIntfOutputTraceEnabled ())
+          {
+            m_satInterference = CreateObject<SatFlatPerFragmentInterference> (GetChannelType (), rxBandwidthHz);
+          }
+        else
+          {
+            m_satInterference = CreateObject<SatFlatPerFragmentInterference> ();
+          }
+        break;
+      }
     case SatPhyRxCarrierConf::IF_TRACE:
       {
         NS_LOG_INFO (this << " Traced interference model created for carrier: " << carrierId);
@@ -258,6 +284,7 @@ SatPhyRxCarrier::DoDispose ()
   m_satInterference = NULL;
   m_satInterferenceElimination = NULL;
   m_uniformVariable = NULL;
+  m_deferredInterferences.clear ();
 
   Object::DoDispose ();
 }
@@ -312,14 +339,10 @@ SatPhyRxCarrier::GetReceiveParams (Ptr<SatSignalParameters> rxParams)
   bool receivePacket = GetDefaultReceiveMode ();
   bool ownAddressFound = false;
 
-  for (SatSignalParameters::PacketsInBurst_t::const_iterator i = rxParams->m_packetsInBurst.begin ();
-       ((i != rxParams->m_packetsInBurst.end ()) && (ownAddressFound == false) ); i++)
+  for (uint32_t i = 0;
+       ((i < rxParams->m_packetsInBurst.size ()) && (ownAddressFound == false) ); i++)
     {
-      SatMacTag tag;
-      (*i)->PeekPacketTag (tag);
-
-      params.destAddress = tag.GetDestAddress ();
-      params.sourceAddress = tag.GetSourceAddress ();
+      rxParams->GetPacketAddresses (i, params.sourceAddress, params.destAddress);
 
       if (( params.destAddress == GetOwnAddress () ))
         {
@@ -367,14 +390,37 @@ SatPhyRxCarrier::StartRx (Ptr<SatSignalParameters> rxParams)
         bool receivePacket = receiveParamTuple.first;
         rxParams_s rxParamsStruct = receiveParamTuple.second;
 
-        // add interference in any case
-        rxParamsStruct.interferenceEvent = CreateInterference (rxParams, rxParamsStruct.sourceAddress);
-
         // Check whether the packet is sent to our beam.
         // In case that RX mode is something else than transparent
         // additionally check that whether the packet was intended for this specific receiver
+        bool ownPacket = receivePacket && ( rxParams->m_beamId == GetBeamId () );
 
-        if ( receivePacket && ( rxParams->m_beamId == GetBeamId () ) )
+        /**
+         * The Rx power of a burst deferred by the channel is needed only, if
+         * the burst is received or it interferes a burst being received.
+         * Otherwise the burst is stored and added to the interference model
+         * only if a reception starts before the burst ends.
+         */
+        if (rxParams->IsRxPowerDeferred ())
+          {
+            if ( !ownPacket && m_state == IDLE )
+              {
+                DeferInterference (rxParamsStruct);
+                break;
+              }
+
+            rxParams->CalculateDeferredRxPower ();
+          }
+
+        if (ownPacket)
+          {
+            AddDeferredInterferences ();
+          }
+
+        // add interference in any case
+        rxParamsStruct.interferenceEvent = CreateInterference (rxParams, rxParamsStruct.sourceAddress);
+
+        if ( ownPacket )
           {
             if (IsReceivingDedicatedAccess () && rxParams->m_txInfo.packetType == SatEnums::PACKET_TYPE_DEDICATED_ACCESS)
               {
@@ -408,6 +454,63 @@ SatPhyRxCarrier::StartRx (Ptr<SatSignalParameters> rxParams)
 }
 
 
+void
+SatPhyRxCarrier::DeferInterference (const rxParams_s &rxParams)
+{
+  NS_LOG_FUNCTION (this);
+
+  Time now = Simulator::Now ();
+
+  /**
+   * Forget the bursts ended before now, they cannot interfere any reception.
+   * A burst ending exactly now is kept, as the eagerly calculated interference
+   * model would still hold its end change when a reception starts now.
+   */
+  std::vector<std::pair<Time, rxParams_s> >::iterator last = m_deferredInterferences.begin ();
+  for (std::vector<std::pair<Time, rxParams_s> >::iterator it = m_deferredInterferences.begin ();
+       it != m_deferredInterferences.end ();
+       ++it)
+    {
+      if (it->first >= now)
+        {
+          *last++ = *it;
+        }
+    }
+  m_deferredInterferences.erase (last, m_deferredInterferences.end ());
+
+  m_deferredInterferences.push_back (std::make_pair (now + rxParams.rxParams->m_duration, rxParams));
+}
+
+void
+SatPhyRxCarrier::AddDeferredInterferences ()
+{
+  NS_LOG_FUNCTION (this << m_deferredInterferences.size ());
+
+  Time now = Simulator::Now ();
+
+  for (std::vector<std::pair<Time, rxParams_s> >::iterator it = m_deferredInterferences.begin ();
+       it != m_deferredInterferences.end ();
+       ++it)
+    {
+      /**
+       * The signal parameters are receiver specific, thus the duration can be
+       * cut to the remaining part of the burst. A burst ending exactly now is
+       * added with zero duration, so that its start and end changes cancel
+       * each other out in the same order as in the eager calculation.
+       */
+      if (it->first >= now)
+        {
+          Ptr<SatSignalParameters> rxParams = it->second.rxParams;
+          rxParams->CalculateDeferredRxPower ();
+          rxParams->m_duration = it->first - now;
+
+          CreateInterference (rxParams, it->second.sourceAddress);
+        }
+    }
+
+  m_deferredInterferences.clear ();
+}
+
 void
 SatPhyRxCarrier::DoCompositeSinrOutputTrace (double cSinr)
 {
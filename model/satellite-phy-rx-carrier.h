@@ -607,6 +607,19 @@ private:
    */
   bool CheckAgainstLinkResultsErrorModelAvi (double cSinr, Ptr<SatSignalParameters> rxParams);
 
+  /**
+   * \brief Store a burst with deferred Rx power as an interference descriptor,
+   * which is taken into account only if a reception starts before the burst ends.
+   * \param rxParams Rx parameters of the burst
+   */
+  void DeferInterference (const rxParams_s &rxParams);
+
+  /**
+   * \brief Calculate the Rx power of the ongoing deferred bursts and add
+   * them to the interference model for their remaining duration.
+   */
+  void AddDeferredInterferences ();
+
   State m_state;                                                                                                                                //< Current state of the carrier
   uint32_t m_beamId;                                                                                                            //< Beam ID
   uint32_t m_carrierId;                                                                                                 //< Carrier ID
@@ -626,6 +639,12 @@ private:
   uint32_t m_rxPacketCounter;
 
   std::map<uint32_t, rxParams_s> m_rxParamsMap; //< Storage for Rx parameters by ID
+
+  /**
+   * \brief Bursts with deferred Rx power received while not receiving, in
+   * arrival order, with their end times
+   */
+  std::vector<std::pair<Time, rxParams_s> > m_deferredInterferences;
   Mac48Address m_ownAddress;                                                                            //< Carrier address
   Ptr<SatNodeInfo> m_nodeInfo;                                                                  //< NodeInfo of the node where carrier is attached
   SatEnums::ChannelType_t m_channelType;                                //< Channel type
@@ -50,6 +50,7 @@ SatPhy::SatPhy (void)
   : m_beamId (0),
   m_eirpWoGainW (0),
   m_isStatisticsTagsEnabled (false),
+  m_isPacketMetadataEnabled (true),
   m_rxNoiseTemperatureDbk (0),
   m_rxMaxAntennaGainDb (0),
   m_rxAntennaLossDb (0),
@@ -70,6 +71,7 @@ SatPhy::SatPhy (CreateParam_t & params)
   : m_beamId (0),
   m_eirpWoGainW (0),
   m_isStatisticsTagsEnabled (false),
+  m_isPacketMetadataEnabled (true),
   m_rxNoiseTemperatureDbk (0),
   m_rxMaxAntennaGainDb (0),
   m_rxAntennaLossDb (0),
@@ -120,6 +122,12 @@ SatPhy::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&SatPhy::m_isStatisticsTagsEnabled),
                    MakeBooleanChecker ())
+    .AddAttribute ("EnablePacketMetadata",
+                   "If true, the addressing information of the transmitted packets is stored into the signal parameters, "
+                   "so that the channel and the receivers do not need to peek the MAC tags of the packets",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&SatPhy::m_isPacketMetadataEnabled),
+                   MakeBooleanChecker ())
     .AddTraceSource ("PacketTrace",
                      "Packet event trace",
                      MakeTraceSourceAccessor (&SatPhy::m_packetTrace),
@@ -340,6 +348,11 @@ SatPhy::SendPdu (PacketContainer_t p, uint32_t carrierId, Time duration, SatSign
   txParams->m_txInfo.packetType = txInfo.packetType;
   txParams->m_txInfo.crdsaUniquePacketId = txInfo.crdsaUniquePacketId;
 
+  if (m_isPacketMetadataEnabled)
+    {
+      txParams->FillPacketMetadata ();
+    }
+
   m_phyTx->StartTx (txParams);
 }
 
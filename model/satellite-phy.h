@@ -550,6 +550,11 @@ private:
    */
   bool m_isStatisticsTagsEnabled;
 
+  /**
+   * `EnablePacketMetadata` attribute.
+   */
+  bool m_isPacketMetadataEnabled;
+
   /**
    * Configured receiver noise temperature in dBK.
    */
@@ -19,6 +19,7 @@
  */
 
 #include <ns3/satellite-env-variables.h>
+#include <ns3/simulator.h>
 #include "satellite-position-input-trace-container.h"
 
 
@@ -76,6 +77,8 @@ SatPositionInputTraceContainer::Reset ()
     {
       m_container.clear ();
     }
+
+  m_trajectories.clear ();
 }
 
 Ptr<SatInputFileStreamTimeDoubleContainer>
@@ -108,11 +111,48 @@ SatPositionInputTraceContainer::FindNode (const std::string& key)
   return iter->second;
 }
 
+void
+SatPositionInputTraceContainer::AddTrajectory (const std::string& key, Ptr<SatTrajectory> trajectory)
+{
+  NS_LOG_FUNCTION (this << key);
+
+  m_trajectories[key] = trajectory;
+}
+
+Ptr<SatTrajectory>
+SatPositionInputTraceContainer::GetTrajectory (const std::string& key)
+{
+  NS_LOG_FUNCTION (this << key);
+
+  trajectoryContainer_t::iterator iter = m_trajectories.find (key);
+
+  if (iter == m_trajectories.end ())
+    {
+      iter = m_trajectories.insert (std::make_pair (key, SatTrajectory::Load (key))).first;
+    }
+
+  return iter->second;
+}
+
 GeoCoordinate
 SatPositionInputTraceContainer::GetPosition (const std::string& key, GeoCoordinate::ReferenceEllipsoid_t refEllipsoid)
 {
   NS_LOG_FUNCTION (this);
 
+  // The trajectories read beforehand and the binary files are read from
+  // the trajectories, the other files with the time double containers
+  trajectoryContainer_t::iterator iter = m_trajectories.find (key);
+
+  if (iter != m_trajectories.end ())
+    {
+      return iter->second->GetPosition (Simulator::Now ().GetSeconds (), refEllipsoid);
+    }
+
+  if (m_container.find (key) == m_container.end () && SatTrajectory::IsBinaryFile (key))
+    {
+      return GetTrajectory (key)->GetPosition (Simulator::Now ().GetSeconds (), refEllipsoid);
+    }
+
   std::vector<double> row = FindNode (key)->InterpolateBetweenClosestTimeSamples ();
   return GeoCoordinate (
     row.at (SatBaseTraceContainer::POSITION_TRACE_DEFAULT_LATITUDE_INDEX),
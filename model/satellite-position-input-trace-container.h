@@ -25,6 +25,7 @@
 #include "satellite-antenna-gain-pattern-container.h"
 #include "satellite-base-trace-container.h"
 #include "geo-coordinate.h"
+#include "satellite-trajectory.h"
 
 namespace ns3 {
 
@@ -42,6 +43,11 @@ public:
    */
   typedef std::map <std::string, Ptr<SatInputFileStreamTimeDoubleContainer> > container_t;
 
+  /**
+   * \brief typedef for map of trajectories
+   */
+  typedef std::map <std::string, Ptr<SatTrajectory> > trajectoryContainer_t;
+
   /**
    * \brief Constructor
    */
@@ -76,6 +82,22 @@ public:
    */
   GeoCoordinate GetPosition (const std::string& key, GeoCoordinate::ReferenceEllipsoid_t refEllipsoid);
 
+  /**
+   * \brief Add a trajectory read beforehand, e.g. in parallel with other
+   * trajectories. The positions of the file are then taken from the trajectory.
+   * \param key filename the trajectory is read from
+   * \param trajectory the trajectory
+   */
+  void AddTrajectory (const std::string& key, Ptr<SatTrajectory> trajectory);
+
+  /**
+   * \brief Function for getting the trajectory of a file, the file is read
+   * if the trajectory is not added yet
+   * \param key filename to read the trajectory from
+   * \return the trajectory
+   */
+  Ptr<SatTrajectory> GetTrajectory (const std::string& key);
+
   /**
    * \brief Function for resetting the variables
    */
@@ -100,6 +122,11 @@ private:
    * \brief Map for containers
    */
   container_t m_container;
+
+  /**
+   * \brief Map for trajectories
+   */
+  trajectoryContainer_t m_trajectories;
 };
 
 } // namespace ns3
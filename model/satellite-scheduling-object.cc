@@ -93,4 +93,16 @@ SatSchedulingObject::GetHolDelay () const
   return m_holDelay;
 }
 
+void
+SatSchedulingObject::Set (Mac48Address addr, uint32_t bytes, uint32_t minTxOpportunity, Time holDelay, uint8_t flowId)
+{
+  NS_LOG_FUNCTION (this << addr << bytes << holDelay << (uint32_t) flowId);
+
+  m_macAddress = addr;
+  m_bufferedBytes = bytes;
+  m_minTxOpportunity = minTxOpportunity;
+  m_holDelay = holDelay;
+  m_flowId = flowId;
+}
+
 } // namespace ns3
@@ -91,6 +91,19 @@ public:
    */
   Time GetHolDelay () const;
 
+  /**
+   * \brief Refill the object with new LLC layer information. Used by the LLC
+   * to reuse the same scheduling object between scheduling rounds instead of
+   * allocating a new one for every backlogged encapsulator.
+   * \param addr MAC address of an UT
+   * \param bytes Amount of bytes at an encapsulator
+   * \param minTxOpportunity Minimum size of the Tx opportunity to be
+   *        able to create a packet.
+   * \param holDelay Head of line queuing delay
+   * \param flowId Flow identifier
+   */
+  void Set (Mac48Address addr, uint32_t bytes, uint32_t minTxOpportunity, Time holDelay, uint8_t flowId);
+
 private:
   Mac48Address m_macAddress;
   uint32_t m_bufferedBytes;
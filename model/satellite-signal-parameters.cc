@@ -22,9 +22,11 @@
 
 #include "ns3/log.h"
 #include "ns3/ptr.h"
+#include "ns3/uinteger.h"
 
 #include "satellite-signal-parameters.h"
 #include "satellite-phy-tx.h"
+#include "satellite-mac-tag.h"
 
 NS_LOG_COMPONENT_DEFINE ("SatSignalParameters");
 
@@ -45,6 +47,7 @@ SatSignalParameters::SatSignalParameters ()
   m_rxAciIfPowerInSatellite_W (),
   m_rxExtNoisePowerInSatellite_W (),
   m_sinrCalculate (),
+  m_rxPowerCalculate (),
   m_ifPower_W (),
   m_ifPowerInSatellite_W (),
   m_ifPowerPerFragment_W (),
@@ -60,6 +63,8 @@ SatSignalParameters::SatSignalParameters ( const SatSignalParameters& p )
       m_packetsInBurst.push_back ((*i)->Copy ());
     }
 
+  m_packetMetadata = p.m_packetMetadata;
+
   m_beamId = p.m_beamId;
   m_carrierId = p.m_carrierId;
   m_duration = p.m_duration;
@@ -85,6 +90,59 @@ SatSignalParameters::SatSignalParameters ( const SatSignalParameters& p )
   SetInterferencePower (p.m_ifPowerPerFragment_W);
 }
 
+void
+SatSignalParameters::FillPacketMetadata ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Ptr<PacketMetadataBlock> metadata = Create<PacketMetadataBlock> ();
+  metadata->m_packets.resize (m_packetsInBurst.size ());
+
+  for (uint32_t i = 0; i < m_packetsInBurst.size (); ++i)
+    {
+      SatMacTag macTag;
+      metadata->m_packets[i].hasMacTag = m_packetsInBurst[i]->PeekPacketTag (macTag);
+      metadata->m_packets[i].sourceAddress = macTag.GetSourceAddress ();
+      metadata->m_packets[i].destAddress = macTag.GetDestAddress ();
+    }
+
+  m_packetMetadata = metadata;
+}
+
+void
+SatSignalParameters::CalculateDeferredRxPower ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (IsRxPowerDeferred ())
+    {
+      Callback<void, Ptr<SatSignalParameters> > rxPowerCalculate = m_rxPowerCalculate;
+      m_rxPowerCalculate.Nullify ();
+      rxPowerCalculate (this);
+    }
+}
+
+bool
+SatSignalParameters::GetPacketAddresses (uint32_t index, Mac48Address &source, Mac48Address &dest) const
+{
+  NS_LOG_FUNCTION (this << index);
+
+  if (m_packetMetadata != 0 && m_packetMetadata->m_packets.size () == m_packetsInBurst.size ())
+    {
+      const packetMetadata_s & metadata = m_packetMetadata->m_packets[index];
+      source = metadata.sourceAddress;
+      dest = metadata.destAddress;
+      return metadata.hasMacTag;
+    }
+
+  SatMacTag macTag;
+  bool mSuccess = m_packetsInBurst[index]->PeekPacketTag (macTag);
+  source = macTag.GetSourceAddress ();
+  dest = macTag.GetDestAddress ();
+
+  return mSuccess;
+}
+
 Ptr<SatSignalParameters>
 SatSignalParameters::Copy ()
 {
@@ -99,9 +157,78 @@ SatSignalParameters::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::SatSignalParameters")
     .SetParent<Object> ()
+    .AddAttribute ("PoolAllocations",
+                   "Number of signal parameters allocated from the pool.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&SatSignalParameters::GetNPoolAllocations),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("PoolHeapAllocations",
+                   "Number of pool allocations which needed new memory from the heap.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&SatSignalParameters::GetNPoolHeapAllocations),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("PoolInUse",
+                   "Number of pooled signal parameters in use.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&SatSignalParameters::GetNPoolInUse),
+                   MakeUintegerChecker<uint64_t> ())
   ;
   return tid;
 }
 
+TypeId
+SatSignalParameters::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+void*
+SatSignalParameters::operator new (size_t size)
+{
+  return GetPool ().Allocate (size);
+}
+
+void
+SatSignalParameters::operator delete (void* p, size_t size)
+{
+  GetPool ().Deallocate (p, size);
+}
+
+SatObjectPool&
+SatSignalParameters::GetPool ()
+{
+  // The pool is never destroyed, since signal parameters may be released
+  // during the destruction of the static objects
+  static SatObjectPool* pool = new SatObjectPool (sizeof (SatSignalParameters));
+  return *pool;
+}
+
+uint64_t
+SatSignalParameters::GetNPoolAllocations () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return GetPool ().GetNAllocations ();
+}
+
+uint64_t
+SatSignalParameters::GetNPoolHeapAllocations () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return GetPool ().GetNHeapAllocations ();
+}
+
+uint64_t
+SatSignalParameters::GetNPoolInUse () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return GetPool ().GetNInUse ();
+}
+
 
 } // namespace ns3
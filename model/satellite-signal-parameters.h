@@ -27,8 +27,11 @@
 #include "ns3/packet.h"
 #include "ns3/nstime.h"
 #include "ns3/object.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/mac48-address.h"
 #include "satellite-enums.h"
 #include "satellite-utils.h"
+#include "satellite-object-pool.h"
 
 namespace ns3 {
 
@@ -64,6 +67,35 @@ public:
    */
   typedef std::vector< Ptr<Packet> > PacketsInBurst_t;
 
+  /**
+   * \brief Struct for storing the packet specific addressing information,
+   * i.e. a copy of the SatMacTag contents of a packet in the burst
+   */
+  typedef struct
+  {
+    bool hasMacTag;
+    Mac48Address sourceAddress;
+    Mac48Address destAddress;
+  } packetMetadata_s;
+
+  /**
+   * Container of the packet metadata, in the same order as the packets
+   */
+  typedef std::vector<packetMetadata_s> PacketMetadata_t;
+
+  /**
+   * \brief Block of the packet metadata of a burst. The block is not modified
+   * after it is filled, so it is shared by all the copies of the signal parameters.
+   */
+  class PacketMetadataBlock : public SimpleRefCount<PacketMetadataBlock>
+  {
+  public:
+    /**
+     * Metadata of the packets in burst
+     */
+    PacketMetadata_t m_packets;
+  };
+
   /**
    * default constructor
    */
@@ -82,6 +114,33 @@ public:
    */
   static TypeId GetTypeId (void);
 
+  /**
+   * \brief Get the type ID of instance. The signal parameters are created
+   * with Create<> and Copy (), which do not set the instance type ID.
+   * \return the object TypeId
+   */
+  TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * \brief Allocate the memory of signal parameters from the signal parameters pool.
+   * \param size Size of the object
+   * \return Pointer to the memory
+   */
+  static void* operator new (size_t size);
+
+  /**
+   * \brief Release the memory of signal parameters to the signal parameters pool.
+   * \param p Pointer to the memory
+   * \param size Size of the object
+   */
+  static void operator delete (void* p, size_t size);
+
+  /**
+   * \brief Get the memory pool of the signal parameters, e.g. for the allocation counters.
+   * \return The pool
+   */
+  static SatObjectPool& GetPool ();
+
   /**
    * The packets being transmitted with this signal i.e.
    * this is transmit buffer including packet pointers.
@@ -89,6 +148,29 @@ public:
 
   PacketsInBurst_t m_packetsInBurst;
 
+  /**
+   * The addressing information of the packets in m_packetsInBurst. Filled
+   * once by the transmitter so that the channel and the receivers do not need
+   * to peek the packet tags. Shared by the copies of the signal parameters.
+   * NULL, if not filled.
+   */
+  Ptr<const PacketMetadataBlock> m_packetMetadata;
+
+  /**
+   * \brief Fill the metadata of the packets in burst from their MAC tags.
+   */
+  void FillPacketMetadata ();
+
+  /**
+   * \brief Get the source and destination addresses of a packet in burst.
+   * The metadata is used if filled, otherwise the MAC tag of the packet is peeked.
+   * \param index Index of the packet in burst
+   * \param source Source MAC address of the packet
+   * \param dest Destination MAC address of the packet
+   * \return true if the packet has a MAC tag, otherwise false
+   */
+  bool GetPacketAddresses (uint32_t index, Mac48Address &source, Mac48Address &dest) const;
+
   /**
    * The beam for the packet transmission
    */
@@ -168,6 +250,27 @@ public:
    */
   Callback<double, double> m_sinrCalculate;
 
+  /**
+   * Callback for calculating the RX power, set by the channel when the
+   * calculation is deferred until the receiver needs the RX power. Not copied
+   * by the copy constructor, since the calculation is receiver specific.
+   */
+  Callback<void, Ptr<SatSignalParameters> > m_rxPowerCalculate;
+
+  /**
+   * \brief Check whether the RX power calculation is deferred, i.e. m_rxPower_W is not set.
+   * \return true if the RX power is not calculated yet
+   */
+  inline bool IsRxPowerDeferred () const
+  {
+    return !m_rxPowerCalculate.IsNull ();
+  }
+
+  /**
+   * \brief Calculate the deferred RX power to m_rxPower_W.
+   */
+  void CalculateDeferredRxPower ();
+
   /**
    * \brief Set interference power based on packet fragment
    * \param ifPowerPerFragment
@@ -221,6 +324,24 @@ public:
   }
 
 private:
+  /**
+   * \brief Get the number of signal parameters allocated from the pool.
+   * \return Number of allocations
+   */
+  uint64_t GetNPoolAllocations () const;
+
+  /**
+   * \brief Get the number of pool allocations which needed new memory from the heap.
+   * \return Number of heap allocations
+   */
+  uint64_t GetNPoolHeapAllocations () const;
+
+  /**
+   * \brief Get the number of pooled signal parameters in use.
+   * \return Number of signal parameters in use
+   */
+  uint64_t GetNPoolInUse () const;
+
   /**
    * Interference power (I)
    */
@@ -0,0 +1,235 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/double.h>
+#include <ns3/singleton.h>
+#include "satellite-position-input-trace-container.h"
+#include "satellite-traced-mobility-model.h"
+#include "satellite-traced-mobility-engine.h"
+
+
+NS_LOG_COMPONENT_DEFINE ("SatTracedMobilityEngine");
+
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatTracedMobilityEngine);
+
+TypeId
+SatTracedMobilityEngine::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatTracedMobilityEngine")
+    .SetParent<Object> ()
+    .AddConstructor<SatTracedMobilityEngine> ()
+    .AddAttribute ("PositionTolerance",
+                   "Minimum change of the position in meters to notify the course change of an updated model",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&SatTracedMobilityEngine::m_positionTolerance),
+                   MakeDoubleChecker<double> (0.0))
+  ;
+
+  return tid;
+}
+
+TypeId
+SatTracedMobilityEngine::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+SatTracedMobilityEngine::SatTracedMobilityEngine ()
+  : m_groups (),
+  m_modelIndices (),
+  m_updating (false),
+  m_pendingRemovals (),
+  m_positionTolerance (0.0)
+{
+  NS_LOG_FUNCTION (this);
+
+  // Attributes are needed already in construction phase:
+  // - ConstructSelf call in constructor
+  // - GetInstanceTypeId needs to be implemented
+  ObjectBase::ConstructSelf (AttributeConstructionList ());
+}
+
+SatTracedMobilityEngine::~SatTracedMobilityEngine ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatTracedMobilityEngine::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  for (std::map<Time, group_s>::iterator it = m_groups.begin (); it != m_groups.end (); ++it)
+    {
+      it->second.updateEvent.Cancel ();
+    }
+
+  m_groups.clear ();
+  m_modelIndices.clear ();
+  m_pendingRemovals.clear ();
+
+  Object::DoDispose ();
+}
+
+void
+SatTracedMobilityEngine::Add (Ptr<SatTracedMobilityModel> model)
+{
+  NS_LOG_FUNCTION (this << model);
+
+  entry_s entry;
+  entry.model = model;
+  entry.trajectory = Singleton<SatPositionInputTraceContainer>::Get ()->GetTrajectory (model->GetTraceFilename ());
+  entry.removed = false;
+
+  Time interval = model->GetUpdateInterval ();
+  group_s& group = m_groups[interval];
+  m_modelIndices[model] = std::make_pair (interval, group.entries.size ());
+  group.entries.push_back (entry);
+
+  if (!group.updateEvent.IsRunning ())
+    {
+      group.updateEvent = Simulator::Schedule (interval, &SatTracedMobilityEngine::Update, this, interval);
+    }
+}
+
+void
+SatTracedMobilityEngine::Remove (Ptr<SatTracedMobilityModel> model)
+{
+  NS_LOG_FUNCTION (this << model);
+
+  std::map<Ptr<SatTracedMobilityModel>, std::pair<Time, uint32_t> >::iterator indexIt = m_modelIndices.find (model);
+
+  if (indexIt == m_modelIndices.end ())
+    {
+      return;
+    }
+
+  // Moving the entries would break the loop of Update
+  if (m_updating)
+    {
+      entry_s& entry = m_groups[indexIt->second.first].entries[indexIt->second.second];
+
+      if (!entry.removed)
+        {
+          entry.removed = true;
+          m_pendingRemovals.push_back (model);
+        }
+      return;
+    }
+
+  DoRemove (model);
+}
+
+void
+SatTracedMobilityEngine::DoRemove (Ptr<SatTracedMobilityModel> model)
+{
+  NS_LOG_FUNCTION (this << model);
+
+  std::map<Ptr<SatTracedMobilityModel>, std::pair<Time, uint32_t> >::iterator indexIt = m_modelIndices.find (model);
+  NS_ASSERT (indexIt != m_modelIndices.end ());
+
+  std::map<Time, group_s>::iterator it = m_groups.find (indexIt->second.first);
+  NS_ASSERT (it != m_groups.end ());
+
+  std::vector<entry_s>& entries = it->second.entries;
+  uint32_t index = indexIt->second.second;
+  m_modelIndices.erase (indexIt);
+
+  // Move the last model in place of the removed one
+  if (index != entries.size () - 1)
+    {
+      entries[index] = entries.back ();
+      m_modelIndices[entries[index].model].second = index;
+    }
+  entries.pop_back ();
+
+  if (entries.empty ())
+    {
+      it->second.updateEvent.Cancel ();
+      m_groups.erase (it);
+    }
+}
+
+uint32_t
+SatTracedMobilityEngine::GetNModels () const
+{
+  uint32_t nModels = 0;
+
+  for (std::map<Time, group_s>::const_iterator it = m_groups.begin (); it != m_groups.end (); ++it)
+    {
+      nModels += it->second.entries.size ();
+    }
+
+  return nModels - m_pendingRemovals.size ();
+}
+
+void
+SatTracedMobilityEngine::Update (Time interval)
+{
+  NS_LOG_FUNCTION (this << interval);
+
+  std::map<Time, group_s>::iterator it = m_groups.find (interval);
+  NS_ASSERT (it != m_groups.end ());
+
+  // The course change callbacks may add and remove models. Added models
+  // are appended after the models updated now and removed ones are taken
+  // out after the loop, so the entries are accessed by index.
+  std::vector<entry_s>& entries = it->second.entries;
+  uint32_t nEntries = entries.size ();
+  double now = Simulator::Now ().GetSeconds ();
+  uint32_t nNotified = 0;
+
+  m_updating = true;
+
+  for (uint32_t i = 0; i < nEntries; ++i)
+    {
+      if (entries[i].removed)
+        {
+          continue;
+        }
+
+      Ptr<SatTracedMobilityModel> model = entries[i].model;
+      GeoCoordinate position = entries[i].trajectory->GetPosition (now, model->GetReferenceEllipsoid ());
+
+      if (model->UpdateGeoPosition (position, m_positionTolerance))
+        {
+          ++nNotified;
+        }
+    }
+
+  m_updating = false;
+
+  NS_LOG_INFO ("Updated " << nEntries << " models, " << nNotified << " course changes notified");
+
+  it->second.updateEvent = Simulator::Schedule (interval, &SatTracedMobilityEngine::Update, this, interval);
+
+  // Removing the last model of a group cancels its update event
+  for (std::vector<Ptr<SatTracedMobilityModel> >::iterator modelIt = m_pendingRemovals.begin (); modelIt != m_pendingRemovals.end (); ++modelIt)
+    {
+      DoRemove (*modelIt);
+    }
+  m_pendingRemovals.clear ();
+}
+
+} // namespace ns3
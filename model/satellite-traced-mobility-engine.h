@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_TRACED_MOBILITY_ENGINE_H
+#define SATELLITE_TRACED_MOBILITY_ENGINE_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <ns3/object.h>
+#include <ns3/ptr.h>
+#include <ns3/nstime.h>
+#include <ns3/event-id.h>
+#include "geo-coordinate.h"
+#include "satellite-trajectory.h"
+
+namespace ns3 {
+
+class SatTracedMobilityModel;
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Central update engine for the traced mobility models. Instead of
+ * each SatTracedMobilityModel scheduling its own update event, the models
+ * enabling the engine are updated together by a single event per update
+ * interval.
+ *
+ * The trajectory files are read once into SatTrajectory objects, shared by
+ * the models using the same file through SatPositionInputTraceContainer.
+ * Each model refers directly to its trajectory, so an update interpolates
+ * the position without any lookups by file name. The course change of a
+ * model is notified only if its position changed more than the position
+ * tolerance.
+ *
+ * The engine is used as a singleton, i.e. Singleton<SatTracedMobilityEngine>.
+ */
+class SatTracedMobilityEngine : public Object
+{
+public:
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * \brief Get the type ID of instance
+   * \return the object TypeId
+   */
+  TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * Constructor
+   */
+  SatTracedMobilityEngine ();
+
+  /**
+   * Destructor
+   */
+  virtual ~SatTracedMobilityEngine ();
+
+  /**
+   * \brief Do needed dispose actions
+   */
+  virtual void DoDispose ();
+
+  /**
+   * \brief Add a model to be updated by the engine. The first update of the
+   * model is done at the next tick of its update interval.
+   * \param model mobility model to update
+   */
+  void Add (Ptr<SatTracedMobilityModel> model);
+
+  /**
+   * \brief Remove a model from the engine. The last model of its update
+   * interval takes the place of the removed one. A model removed while the
+   * engine is updating, e.g. disposed by a course change callback, is not
+   * updated anymore and is taken out of its group after the update.
+   * \param model mobility model to remove
+   */
+  void Remove (Ptr<SatTracedMobilityModel> model);
+
+  /**
+   * \brief Get the number of models updated by the engine
+   * \return number of models
+   */
+  uint32_t GetNModels () const;
+
+private:
+  /**
+   * \brief Model updated by the engine and its trajectory
+   */
+  typedef struct
+  {
+    Ptr<SatTracedMobilityModel> model;
+    Ptr<SatTrajectory> trajectory;
+    bool removed;
+  } entry_s;
+
+  /**
+   * \brief Models updated with the same update interval
+   */
+  typedef struct
+  {
+    std::vector<entry_s> entries;
+    EventId updateEvent;
+  } group_s;
+
+  /**
+   * \brief Update all the models of an update interval and schedule the next update
+   * \param interval update interval
+   */
+  void Update (Time interval);
+
+  /**
+   * \brief Take a model out of its group
+   * \param model mobility model to remove
+   */
+  void DoRemove (Ptr<SatTracedMobilityModel> model);
+
+  /**
+   * \brief Groups of the models by update interval
+   */
+  std::map<Time, group_s> m_groups;
+
+  /**
+   * \brief Update interval and index in its group of each model
+   */
+  std::map<Ptr<SatTracedMobilityModel>, std::pair<Time, uint32_t> > m_modelIndices;
+
+  /**
+   * \brief Flag telling that the models are being updated
+   */
+  bool m_updating;
+
+  /**
+   * \brief Models removed during the update, taken out of their groups after it
+   */
+  std::vector<Ptr<SatTracedMobilityModel> > m_pendingRemovals;
+
+  /**
+   * \brief Minimum position change in meters to notify the course change
+   */
+  double m_positionTolerance;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_TRACED_MOBILITY_ENGINE_H */
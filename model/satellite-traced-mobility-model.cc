@@ -21,9 +21,11 @@
 #include <ns3/simulator.h>
 #include <ns3/log.h>
 #include <ns3/enum.h>
+#include <ns3/boolean.h>
 #include <ns3/singleton.h>
 #include "satellite-traced-mobility-model.h"
 #include "satellite-position-input-trace-container.h"
+#include "satellite-traced-mobility-engine.h"
 
 
 NS_LOG_COMPONENT_DEFINE ("SatTracedMobilityModel");
@@ -51,6 +53,11 @@ SatTracedMobilityModel::GetTypeId (void)
                    TimeValue (MilliSeconds (1)),
                    MakeTimeAccessor (&SatTracedMobilityModel::m_updateInterval),
                    MakeTimeChecker (FemtoSeconds (1)))
+    .AddAttribute ("EnableUpdateEngine",
+                   "Update the position by the SatTracedMobilityEngine together with the other models instead of an own update event",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatTracedMobilityModel::m_enableUpdateEngine),
+                   MakeBooleanChecker ())
   ;
 
   return tid;
@@ -65,6 +72,10 @@ SatTracedMobilityModel::GetInstanceTypeId (void) const
 void
 SatTracedMobilityModel::DoDispose ()
 {
+  if (m_enableUpdateEngine)
+    {
+      Singleton<SatTracedMobilityEngine>::Get ()->Remove (this);
+    }
   m_antennaGainPatterns = NULL;
 
   Object::DoDispose ();
@@ -78,13 +89,21 @@ SatTracedMobilityModel::SatTracedMobilityModel ()
 SatTracedMobilityModel::SatTracedMobilityModel (const std::string& filename, Ptr<SatAntennaGainPatternContainer> agp)
   : m_traceFilename (filename),
   m_updateInterval (MilliSeconds (1)),
+  m_enableUpdateEngine (false),
   m_refEllipsoid (GeoCoordinate::SPHERE),
   m_geoPosition (0.0, 0.0, 0.0),
+  m_notifiedGeoPosition (0.0, 0.0, 0.0),
   m_velocity (0.0, 0.0, 0.0),
+  m_lastUpdateTime (Seconds (0)),
   m_antennaGainPatterns (agp)
 {
   NS_LOG_FUNCTION (this);
 
+  // Attributes are needed already in construction phase:
+  // - ConstructSelf call in constructor
+  // - GetInstanceTypeId needs to be implemented
+  ObjectBase::ConstructSelf (AttributeConstructionList ());
+
   UpdateGeoPositionFromFile ();
 }
 
@@ -113,6 +132,7 @@ SatTracedMobilityModel::DoSetGeoPosition (const GeoCoordinate &position)
   NS_LOG_INFO ("Changing position from " << m_geoPosition << " to " << position << ". Velocity is " << m_velocity << " (" << m_velocity.GetLength () << ")");
 
   m_geoPosition = position;
+  m_notifiedGeoPosition = position;
   NotifyGeoCourseChange ();
 }
 
@@ -129,12 +149,78 @@ SatTracedMobilityModel::UpdateGeoPositionFromFile (void)
 {
   NS_LOG_FUNCTION (this);
 
+  m_lastUpdateTime = Simulator::Now ();
+
+  // The engine reads the positions from the trajectory of the file, so the
+  // file is not read also into a time double container
+  if (m_enableUpdateEngine)
+    {
+      Ptr<SatTrajectory> trajectory = Singleton<SatPositionInputTraceContainer>::Get ()->GetTrajectory (m_traceFilename);
+      DoSetGeoPosition (trajectory->GetPosition (m_lastUpdateTime.GetSeconds (), m_refEllipsoid));
+      Singleton<SatTracedMobilityEngine>::Get ()->Add (this);
+      return;
+    }
+
   GeoCoordinate newPosition = Singleton<SatPositionInputTraceContainer>::Get ()->GetPosition (m_traceFilename, m_refEllipsoid);
   DoSetGeoPosition (newPosition);
 
   Simulator::Schedule (m_updateInterval, &SatTracedMobilityModel::UpdateGeoPositionFromFile, this);
 }
 
+std::string
+SatTracedMobilityModel::GetTraceFilename (void) const
+{
+  return m_traceFilename;
+}
+
+Time
+SatTracedMobilityModel::GetUpdateInterval (void) const
+{
+  return m_updateInterval;
+}
+
+GeoCoordinate::ReferenceEllipsoid_t
+SatTracedMobilityModel::GetReferenceEllipsoid (void) const
+{
+  return m_refEllipsoid;
+}
+
+bool
+SatTracedMobilityModel::UpdateGeoPosition (const GeoCoordinate &position, double tolerance)
+{
+  NS_LOG_FUNCTION (this << position << tolerance);
+
+  // A model added to the engine is updated in the phase of the other models
+  // of its update interval, so its first update by the engine may come
+  // earlier than the update interval after its own update
+  Time now = Simulator::Now ();
+  double time = (now - m_lastUpdateTime).GetSeconds ();
+  m_lastUpdateTime = now;
+
+  if (time <= 0.0)
+    {
+      time = m_updateInterval.GetSeconds ();
+    }
+
+  Vector distance = position.ToVector () - m_geoPosition.ToVector ();
+  m_velocity = Vector (distance.x / time, distance.y / time, distance.z / time);
+  m_geoPosition = position;
+
+  // The position is compared to the last notified one, so that a model
+  // moving less than the tolerance per update still notifies the course
+  // change once it has drifted further than the tolerance
+  Vector drift = position.ToVector () - m_notifiedGeoPosition.ToVector ();
+
+  if (drift.GetLength () > tolerance)
+    {
+      m_notifiedGeoPosition = position;
+      NotifyGeoCourseChange ();
+      return true;
+    }
+
+  return false;
+}
+
 uint32_t
 SatTracedMobilityModel::GetBestBeamId (void) const
 {
@@ -68,6 +68,34 @@ public:
    */
   uint32_t GetBestBeamId (void) const;
 
+  /**
+   * \brief Get the name of the file the positions are read from
+   * \return trace file name
+   */
+  std::string GetTraceFilename (void) const;
+
+  /**
+   * \brief Get the interval at which the position is updated
+   * \return update interval
+   */
+  Time GetUpdateInterval (void) const;
+
+  /**
+   * \brief Get the reference ellipsoid of the coordinates read from the file
+   * \return reference ellipsoid
+   */
+  GeoCoordinate::ReferenceEllipsoid_t GetReferenceEllipsoid (void) const;
+
+  /**
+   * \brief Update the position read from the trace by the update engine.
+   * The course change is notified only if the position changed more than
+   * the tolerance since the last notified position.
+   * \param position the new position
+   * \param tolerance minimum change of the position in meters to notify the course change
+   * \return true if the course change was notified
+   */
+  bool UpdateGeoPosition (const GeoCoordinate &position, double tolerance);
+
 private:
   /**
    * \return the current velocity.
@@ -88,9 +116,12 @@ private:
 
   std::string m_traceFilename;
   Time m_updateInterval;
+  bool m_enableUpdateEngine;
   GeoCoordinate::ReferenceEllipsoid_t m_refEllipsoid;
   GeoCoordinate m_geoPosition;
+  GeoCoordinate m_notifiedGeoPosition;
   Vector m_velocity;
+  Time m_lastUpdateTime;
   Ptr<SatAntennaGainPatternContainer> m_antennaGainPatterns;
 };
 
@@ -0,0 +1,353 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include "ns3/log.h"
+#include "satellite-base-trace-container.h"
+#include "satellite-trajectory.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatTrajectory");
+
+namespace ns3 {
+
+// The magic of the binary format, including the terminating null character
+static const char g_binaryFormatMagic[8] = "SNS3TRJ";
+
+SatTrajectory::SatTrajectory ()
+  : m_times (),
+  m_latitudes (),
+  m_longitudes (),
+  m_altitudes (),
+  m_timeIndex (),
+  m_timeIndexInterval (0.0)
+{
+}
+
+Ptr<SatTrajectory>
+SatTrajectory::Load (const std::string& filename)
+{
+  // No logging here, since the trajectories are read also in parallel threads
+  Ptr<SatTrajectory> trajectory = Create<SatTrajectory> ();
+
+  if (IsBinaryFile (filename))
+    {
+      trajectory->ReadBinary (filename);
+    }
+  else
+    {
+      trajectory->ReadText (filename);
+    }
+
+  trajectory->BuildTimeIndex (filename);
+
+  return trajectory;
+}
+
+void
+SatTrajectory::LoadFiles (const std::vector<std::string>& filenames,
+                          uint32_t threadCount,
+                          std::vector<Ptr<SatTrajectory> >& trajectories)
+{
+  NS_LOG_FUNCTION (filenames.size () << threadCount);
+
+  if (threadCount == 0)
+    {
+      threadCount = std::max (1u, std::thread::hardware_concurrency ());
+    }
+  threadCount = std::min<uint32_t> (threadCount, filenames.size ());
+
+  trajectories.clear ();
+  trajectories.resize (filenames.size ());
+
+  // Each trajectory is created and referenced only by the thread reading it
+  std::atomic<uint32_t> nextFile (0);
+  auto reader = [&] ()
+    {
+      for (uint32_t i = nextFile++; i < filenames.size (); i = nextFile++)
+        {
+          trajectories[i] = Load (filenames[i]);
+        }
+    };
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < threadCount; ++i)
+    {
+      threads.emplace_back (reader);
+    }
+  reader ();
+
+  for (std::thread& thread : threads)
+    {
+      thread.join ();
+    }
+
+  NS_LOG_INFO ("Read " << filenames.size () << " trajectories with " << threadCount << " threads");
+}
+
+bool
+SatTrajectory::IsBinaryFile (const std::string& filename)
+{
+  std::ifstream ifs (filename.c_str (), std::ios::in | std::ios::binary);
+  char magic[sizeof (g_binaryFormatMagic)];
+
+  return ifs.read (magic, sizeof (magic))
+         && std::memcmp (magic, g_binaryFormatMagic, sizeof (magic)) == 0;
+}
+
+void
+SatTrajectory::ConvertToBinary (const std::string& filename, const std::string& binaryFilename)
+{
+  NS_LOG_FUNCTION (filename << binaryFilename);
+
+  Load (filename)->WriteBinary (binaryFilename);
+}
+
+void
+SatTrajectory::WriteBinary (const std::string& filename) const
+{
+  NS_LOG_FUNCTION (this << filename);
+
+  std::ofstream ofs (filename.c_str (), std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if (!ofs.is_open ())
+    {
+      NS_FATAL_ERROR ("SatTrajectory::WriteBinary - Unable to open " << filename);
+    }
+
+  uint8_t header[BINARY_HEADER_SIZE] = { 0 };
+  uint32_t version = BINARY_FORMAT_VERSION;
+  uint32_t samples = m_times.size ();
+  std::memcpy (header, g_binaryFormatMagic, sizeof (g_binaryFormatMagic));
+  std::memcpy (header + 8, &version, sizeof (version));
+  std::memcpy (header + 12, &samples, sizeof (samples));
+
+  ofs.write (reinterpret_cast<const char*> (header), sizeof (header));
+  ofs.write (reinterpret_cast<const char*> (&m_times[0]), samples * sizeof (double));
+  ofs.write (reinterpret_cast<const char*> (&m_latitudes[0]), samples * sizeof (double));
+  ofs.write (reinterpret_cast<const char*> (&m_longitudes[0]), samples * sizeof (double));
+  ofs.write (reinterpret_cast<const char*> (&m_altitudes[0]), samples * sizeof (double));
+
+  if (!ofs)
+    {
+      NS_FATAL_ERROR ("SatTrajectory::WriteBinary - Writing " << filename << " failed");
+    }
+}
+
+uint32_t
+SatTrajectory::GetNSamples () const
+{
+  return m_times.size ();
+}
+
+uint32_t
+SatTrajectory::GetSampleIndex (double time) const
+{
+  uint32_t last = m_times.size () - 1;
+
+  if (!(time > m_times[0]))
+    {
+      return 0;
+    }
+
+  if (time >= m_times[last])
+    {
+      return last;
+    }
+
+  uint32_t gridIndex = std::min<uint32_t> ((time - m_times[0]) / m_timeIndexInterval, m_timeIndex.size () - 1);
+  uint32_t i = m_timeIndex[gridIndex];
+
+  // Correct the rounding of the grid time, and step over the samples
+  // between the grid time and the time with irregular sampling
+  while (i > 0 && m_times[i] > time)
+    {
+      --i;
+    }
+
+  while (i < last && m_times[i + 1] <= time)
+    {
+      ++i;
+    }
+
+  return i;
+}
+
+GeoCoordinate
+SatTrajectory::GetPosition (double time, GeoCoordinate::ReferenceEllipsoid_t refEllipsoid) const
+{
+  uint32_t i = GetSampleIndex (time);
+
+  if (i == m_times.size () - 1 || !(time > m_times[i]))
+    {
+      return GeoCoordinate (m_latitudes[i], m_longitudes[i], m_altitudes[i], refEllipsoid);
+    }
+
+  double linearCoefficient = (time - m_times[i]) / (m_times[i + 1] - m_times[i]);
+
+  return GeoCoordinate (
+    m_latitudes[i] + linearCoefficient * (m_latitudes[i + 1] - m_latitudes[i]),
+    m_longitudes[i] + linearCoefficient * (m_longitudes[i + 1] - m_longitudes[i]),
+    m_altitudes[i] + linearCoefficient * (m_altitudes[i + 1] - m_altitudes[i]),
+    refEllipsoid);
+}
+
+void
+SatTrajectory::ReadText (const std::string& filename)
+{
+  std::ifstream ifs (filename.c_str (), std::ios::in | std::ios::binary);
+
+  if (!ifs.is_open ())
+    {
+      NS_FATAL_ERROR ("SatTrajectory::ReadText - Unable to open " << filename);
+    }
+
+  // Read the whole file at once and parse the values from memory
+  ifs.seekg (0, std::ios::end);
+  std::string content (static_cast<size_t> (ifs.tellg ()), '\0');
+  ifs.seekg (0, std::ios::beg);
+  ifs.read (&content[0], content.size ());
+
+  const uint32_t columns = SatBaseTraceContainer::POSITION_TRACE_DEFAULT_NUMBER_OF_COLUMNS;
+  const char* position = content.c_str ();
+  double row[columns];
+
+  while (true)
+    {
+      uint32_t column;
+
+      for (column = 0; column < columns; ++column)
+        {
+          char* end;
+          row[column] = std::strtod (position, &end);
+
+          if (end == position)
+            {
+              break;
+            }
+          position = end;
+        }
+
+      if (column < columns)
+        {
+          break;
+        }
+
+      m_times.push_back (row[0]);
+      m_latitudes.push_back (row[SatBaseTraceContainer::POSITION_TRACE_DEFAULT_LATITUDE_INDEX]);
+      m_longitudes.push_back (row[SatBaseTraceContainer::POSITION_TRACE_DEFAULT_LONGITUDE_INDEX]);
+      m_altitudes.push_back (row[SatBaseTraceContainer::POSITION_TRACE_DEFAULT_ALTITUDE_INDEX]);
+    }
+}
+
+void
+SatTrajectory::ReadBinary (const std::string& filename)
+{
+  std::ifstream ifs (filename.c_str (), std::ios::in | std::ios::binary);
+
+  uint8_t header[BINARY_HEADER_SIZE];
+  uint32_t version = 0;
+  uint32_t samples = 0;
+
+  if (ifs.read (reinterpret_cast<char*> (header), sizeof (header)))
+    {
+      std::memcpy (&version, header + 8, sizeof (version));
+      std::memcpy (&samples, header + 12, sizeof (samples));
+    }
+
+  ifs.seekg (0, std::ios::end);
+  uint64_t fileSize = ifs.tellg ();
+  ifs.seekg (BINARY_HEADER_SIZE, std::ios::beg);
+
+  if (version != BINARY_FORMAT_VERSION
+      || fileSize != BINARY_HEADER_SIZE + 4 * sizeof (double) * (uint64_t) samples)
+    {
+      NS_FATAL_ERROR ("SatTrajectory::ReadBinary - Invalid binary trajectory file " << filename);
+    }
+
+  m_times.resize (samples);
+  m_latitudes.resize (samples);
+  m_longitudes.resize (samples);
+  m_altitudes.resize (samples);
+
+  if (samples > 0)
+    {
+      ifs.read (reinterpret_cast<char*> (&m_times[0]), samples * sizeof (double));
+      ifs.read (reinterpret_cast<char*> (&m_latitudes[0]), samples * sizeof (double));
+      ifs.read (reinterpret_cast<char*> (&m_longitudes[0]), samples * sizeof (double));
+      ifs.read (reinterpret_cast<char*> (&m_altitudes[0]), samples * sizeof (double));
+    }
+
+  if (!ifs)
+    {
+      NS_FATAL_ERROR ("SatTrajectory::ReadBinary - Reading " << filename << " failed");
+    }
+}
+
+void
+SatTrajectory::BuildTimeIndex (const std::string& filename)
+{
+  uint32_t samples = m_times.size ();
+
+  if (samples == 0)
+    {
+      NS_FATAL_ERROR ("SatTrajectory::BuildTimeIndex - Empty file " << filename);
+    }
+
+  for (uint32_t i = 1; i < samples; ++i)
+    {
+      if (m_times[i - 1] > m_times[i])
+        {
+          NS_FATAL_ERROR ("SatTrajectory::BuildTimeIndex - Invalid input file format (time sample error) in " << filename);
+        }
+    }
+
+  m_timeIndex.clear ();
+
+  if (samples < 2 || m_times[samples - 1] == m_times[0])
+    {
+      // Times at or after the last sample are handled without the index
+      m_timeIndex.push_back (0);
+      m_timeIndexInterval = 1.0;
+      return;
+    }
+
+  // One grid interval per sample interval, so that a regularly sampled
+  // trajectory has exactly one sample in each grid interval
+  m_timeIndexInterval = (m_times[samples - 1] - m_times[0]) / (samples - 1);
+  m_timeIndex.reserve (samples);
+
+  uint32_t i = 0;
+  for (uint32_t k = 0; k < samples; ++k)
+    {
+      double gridTime = m_times[0] + k * m_timeIndexInterval;
+
+      while (i < samples - 1 && m_times[i + 1] <= gridTime)
+        {
+          ++i;
+        }
+      m_timeIndex.push_back (i);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_TRAJECTORY_H
+#define SATELLITE_TRAJECTORY_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <ns3/ptr.h>
+#include <ns3/simple-ref-count.h>
+#include "geo-coordinate.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Trajectory of a mobile node read from a position trace file. The
+ * samples are stored as flat columns of time, latitude, longitude and
+ * altitude.
+ *
+ * The trajectory is read either from the text format of the position
+ * traces, rows of [time, latitude, longitude, altitude], or from the binary
+ * format written by WriteBinary, which is detected from the file header.
+ * The binary format is a 16 byte header, "SNS3TRJ", format version and
+ * number of samples, followed by the time, latitude, longitude and altitude
+ * columns as doubles in host byte order.
+ *
+ * A time index over a regular time grid maps a time to the samples around
+ * it, so that the position at any time is interpolated in constant time
+ * for regularly sampled trajectories.
+ */
+class SatTrajectory : public SimpleRefCount<SatTrajectory>
+{
+public:
+  /**
+   * \brief Constructor
+   */
+  SatTrajectory ();
+
+  /**
+   * \brief Read a trajectory from a text or binary position trace file
+   * \param filename name of the file
+   * \return the trajectory
+   */
+  static Ptr<SatTrajectory> Load (const std::string& filename);
+
+  /**
+   * \brief Read the trajectories of several files in parallel threads
+   * \param filenames names of the files
+   * \param threadCount number of threads, 0 to use one per hardware thread
+   * \param trajectories the trajectories in the order of the file names
+   */
+  static void LoadFiles (const std::vector<std::string>& filenames,
+                         uint32_t threadCount,
+                         std::vector<Ptr<SatTrajectory> >& trajectories);
+
+  /**
+   * \brief Check whether a file is in the binary trajectory format
+   * \param filename name of the file
+   * \return true if the file starts with the binary format header
+   */
+  static bool IsBinaryFile (const std::string& filename);
+
+  /**
+   * \brief Convert a position trace file to the binary trajectory format
+   * \param filename name of the text or binary file to read
+   * \param binaryFilename name of the binary file to write
+   */
+  static void ConvertToBinary (const std::string& filename, const std::string& binaryFilename);
+
+  /**
+   * \brief Write the trajectory to a file in the binary trajectory format
+   * \param filename name of the file
+   */
+  void WriteBinary (const std::string& filename) const;
+
+  /**
+   * \brief Get the number of samples
+   * \return number of samples
+   */
+  uint32_t GetNSamples () const;
+
+  /**
+   * \brief Get the index of the last sample at or before a time
+   * \param time time in seconds
+   * \return sample index, 0 for times before the first sample
+   */
+  uint32_t GetSampleIndex (double time) const;
+
+  /**
+   * \brief Get the position at a time, interpolated linearly between the
+   * samples enclosing the time. Before the first and after the last sample
+   * the position of that sample is used.
+   * \param time time in seconds
+   * \param refEllipsoid reference ellipsoid of the coordinates
+   * \return position
+   */
+  GeoCoordinate GetPosition (double time, GeoCoordinate::ReferenceEllipsoid_t refEllipsoid) const;
+
+  /**
+   * \brief Version of the binary trajectory format
+   */
+  static const uint32_t BINARY_FORMAT_VERSION = 1;
+
+  /**
+   * \brief Size of the binary trajectory header in bytes
+   */
+  static const uint32_t BINARY_HEADER_SIZE = 16;
+
+private:
+  /**
+   * \brief Read the samples from a text file
+   * \param filename name of the file
+   */
+  void ReadText (const std::string& filename);
+
+  /**
+   * \brief Read the samples from a binary file
+   * \param filename name of the file
+   */
+  void ReadBinary (const std::string& filename);
+
+  /**
+   * \brief Check the time samples and build the time index
+   * \param filename name of the file, for the error messages
+   */
+  void BuildTimeIndex (const std::string& filename);
+
+  std::vector<double> m_times;
+  std::vector<double> m_latitudes;
+  std::vector<double> m_longitudes;
+  std::vector<double> m_altitudes;
+
+  /**
+   * \brief Index of the last sample at or before the start of each interval of the time grid
+   */
+  std::vector<uint32_t> m_timeIndex;
+  double m_timeIndexInterval;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_TRAJECTORY_H */
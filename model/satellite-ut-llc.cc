@@ -105,22 +105,20 @@ SatUtLlc::Enque (Ptr<Packet> packet, Address dest, uint8_t flowId)
       destMacAddress = m_gwAddress;
     }
 
-  Ptr<EncapKey> key = Create<EncapKey> (m_nodeInfo->GetMacAddress (), destMacAddress, flowId);
+  Ptr<SatBaseEncapsulator> encap = m_encapIndex.Find (m_nodeInfo->GetMacAddress (), destMacAddress, flowId);
 
-  EncapContainer_t::iterator it = m_encaps.find (key);
-
-  if (it == m_encaps.end ())
+  if (encap == 0)
     {
       /**
        * Encapsulator not found, thus create a new one. This method is
        * implemented in the inherited classes, which knows which type
        * of encapsulator to create.
        */
-      CreateEncap (key);
-      it = m_encaps.find (key);
+      CreateEncap (Create<EncapKey> (m_nodeInfo->GetMacAddress (), destMacAddress, flowId));
+      encap = m_encapIndex.Find (m_nodeInfo->GetMacAddress (), destMacAddress, flowId);
     }
 
-  it->second->EnquePdu (packet, Mac48Address::ConvertFrom (dest));
+  encap->EnquePdu (packet, Mac48Address::ConvertFrom (dest));
 
   SatEnums::SatLinkDir_t ld =
     (m_nodeInfo->GetNodeType () == SatEnums::NT_UT) ? SatEnums::LD_RETURN : SatEnums::LD_FORWARD;
@@ -145,12 +143,11 @@ SatUtLlc::NotifyTxOpportunity (uint32_t bytes, Mac48Address utAddr, uint8_t rcIn
   NS_LOG_FUNCTION (this << utAddr << bytes << (uint32_t) rcIndex);
 
   Ptr<Packet> packet;
-  Ptr<EncapKey> key = Create<EncapKey> (utAddr, m_gwAddress, rcIndex);
-  EncapContainer_t::iterator it = m_encaps.find (key);
+  Ptr<SatBaseEncapsulator> encap = m_encapIndex.Find (utAddr, m_gwAddress, rcIndex);
 
-  if (it != m_encaps.end ())
+  if (encap != 0)
     {
-      packet = it->second->NotifyTxOpportunity (bytes, bytesLeft, nextMinTxO);
+      packet = encap->NotifyTxOpportunity (bytes, bytesLeft, nextMinTxO);
 
       if (packet)
         {
@@ -273,8 +270,7 @@ SatUtLlc::CreateEncap (Ptr<EncapKey> key, Ptr<SatQueue> providedQueue)
   NS_LOG_INFO ("Create encapsulator with key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ")");
 
   // Store the encapsulator
-  std::pair<EncapContainer_t::iterator, bool> result = m_encaps.insert (std::make_pair (key, utEncap));
-  if (result.second == false)
+  if (!InsertEncap (key, utEncap))
     {
       NS_FATAL_ERROR ("Insert to map with key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ") failed!");
     }
@@ -302,8 +298,7 @@ SatUtLlc::CreateDecap (Ptr<EncapKey> key)
   NS_LOG_INFO ("Create decapsulator with key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ")");
 
   // Store the decapsulator
-  std::pair<EncapContainer_t::iterator, bool> result = m_decaps.insert (std::make_pair (key, utDecap));
-  if (result.second == false)
+  if (!InsertDecap (key, utDecap))
     {
       NS_FATAL_ERROR ("Insert to map with key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ") failed!");
     }
@@ -315,17 +310,15 @@ SatUtLlc::GetNBytesInQueue (Mac48Address utAddress) const
   NS_LOG_FUNCTION (this << utAddress);
 
   uint32_t sum = 0;
+  const SatEncapIndex::EncapList_t & encaps = m_encapIndex.GetBySource (utAddress);
 
-  for (EncapContainer_t::const_iterator it = m_encaps.begin ();
-       it != m_encaps.end (); ++it)
+  for (SatEncapIndex::EncapList_t::const_iterator it = encaps.begin ();
+       it != encaps.end (); ++it)
     {
-      if (it->first->m_source == utAddress)
-        {
-          NS_ASSERT (it->second != 0);
-          Ptr<SatQueue> queue = it->second->GetQueue ();
-          NS_ASSERT (queue != 0);
-          sum += queue->GetNBytes ();
-        }
+      NS_ASSERT ((*it) != 0);
+      Ptr<SatQueue> queue = (*it)->GetQueue ();
+      NS_ASSERT (queue != 0);
+      sum += queue->GetNBytes ();
     }
 
   return sum;
@@ -337,17 +330,15 @@ SatUtLlc::GetNPacketsInQueue (Mac48Address utAddress) const
   NS_LOG_FUNCTION (this << utAddress);
 
   uint32_t sum = 0;
+  const SatEncapIndex::EncapList_t & encaps = m_encapIndex.GetBySource (utAddress);
 
-  for (EncapContainer_t::const_iterator it = m_encaps.begin ();
-       it != m_encaps.end (); ++it)
+  for (SatEncapIndex::EncapList_t::const_iterator it = encaps.begin ();
+       it != encaps.end (); ++it)
     {
-      if (it->first->m_source == utAddress)
-        {
-          NS_ASSERT (it->second != 0);
-          Ptr<SatQueue> queue = it->second->GetQueue ();
-          NS_ASSERT (queue != 0);
-          sum += queue->GetNPackets ();
-        }
+      NS_ASSERT ((*it) != 0);
+      Ptr<SatQueue> queue = (*it)->GetQueue ();
+      NS_ASSERT (queue != 0);
+      sum += queue->GetNPackets ();
     }
 
   return sum;
@@ -382,14 +373,14 @@ SatUtLlc::SetGwAddress (Mac48Address address)
       // Move queue from the old gateway to the new one
       for (uint8_t rcIndex = 0;; ++rcIndex)
         {
-          Ptr<EncapKey> peek = Create<EncapKey> (m_nodeInfo->GetMacAddress (), m_gwAddress, rcIndex);
-          EncapContainer_t::iterator it = m_encaps.find (peek);
+          Ptr<EncapKey> peek = m_encapIndex.FindKey (m_nodeInfo->GetMacAddress (), m_gwAddress, rcIndex);
 
-          if (it != m_encaps.end ())
+          if (peek != 0)
             {
+              EncapContainer_t::iterator it = m_encaps.find (peek);
               Ptr<EncapKey> key = Create<EncapKey> (m_nodeInfo->GetMacAddress (), address, rcIndex);
               CreateEncap (key, it->second->GetQueue ());
-              m_encaps.erase (it);
+              EraseEncap (it);
               NS_LOG_INFO ("Queue from key " << peek->m_source << ", "
                                              << peek->m_destination << ", "
                                              << (uint32_t)(peek->m_flowId)
@@ -83,6 +83,11 @@ SatUtMac::GetTypeId (void)
                    TimeValue (Seconds (1)),
                    MakeTimeAccessor (&SatUtMac::m_maxWaitingTimeLogonResponse),
                    MakeTimeChecker ())
+    .AddAttribute ("EnableSuperframeTxPlan",
+                   "Walk the dedicated access time slots of the TBTPs with a single event per UT instead of one event per time slot.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatUtMac::m_enableSuperframeTxPlan),
+                   MakeBooleanChecker ())
     .AddTraceSource ("DaResourcesTrace",
                      "Assigned dedicated access resources in return link to this UT.",
                      MakeTraceSourceAccessor (&SatUtMac::m_tbtpResourcesTrace),
@@ -118,6 +123,10 @@ SatUtMac::SatUtMac ()
   m_crdsaOnlyForControl (false),
   m_nextPacketTime (Now ()),
   m_isRandomAccessScheduled (false),
+  m_enableSuperframeTxPlan (false),
+  m_txPlan (Create<SatUtTxPlan> (MakeCallback (&SatUtMac::DoTransmit, this))),
+  m_burstConfs (),
+  m_daCarrierIds (),
   m_timuInfo (0),
   m_handoverState (NO_HANDOVER),
   m_handoverMessagesCount (0),
@@ -158,6 +167,10 @@ SatUtMac::SatUtMac (Ptr<SatSuperframeSeq> seq, uint32_t beamId, bool crdsaOnlyFo
   m_crdsaOnlyForControl (crdsaOnlyForControl),
   m_nextPacketTime (Now ()),
   m_isRandomAccessScheduled (false),
+  m_enableSuperframeTxPlan (false),
+  m_txPlan (Create<SatUtTxPlan> (MakeCallback (&SatUtMac::DoTransmit, this))),
+  m_burstConfs (),
+  m_daCarrierIds (),
   m_timuInfo (0),
   m_handoverState (NO_HANDOVER),
   m_handoverMessagesCount (0),
@@ -205,6 +218,10 @@ SatUtMac::DoDispose (void)
   m_sendLogonCallback.Nullify ();
   m_updateGwAddressCallback.Nullify ();
   m_beamScheculerCallback.Nullify ();
+  m_txPlan->Clear ();
+  m_txPlan = NULL;
+  m_burstConfs.clear ();
+  m_daCarrierIds.clear ();
   m_tbtpContainer->DoDispose ();
   m_utScheduler->DoDispose ();
   m_utScheduler = NULL;
@@ -440,7 +457,8 @@ SatUtMac::ScheduleTimeSlots (Ptr<SatTbtpMessage> tbtp)
 
   /// If using asynchronous access (no timeslots), return
   /// TODO find better way of doing this
-  if (m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE)->GetConfigType () == SatSuperframeConf::CONFIG_TYPE_4)
+  Ptr<SatSuperframeConf> superframeConf = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE);
+  if (superframeConf->GetConfigType () == SatSuperframeConf::CONFIG_TYPE_4)
     {
       return;
     }
@@ -478,8 +496,6 @@ SatUtMac::ScheduleTimeSlots (Ptr<SatTbtpMessage> tbtp)
       // schedule time slots
       for ( SatTbtpMessage::DaTimeSlotConfContainer_t::iterator it = info.second.begin (); it != info.second.end (); it++ )
         {
-          Ptr<SatSuperframeConf> superframeConf = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE);
-          Ptr<SatFrameConf> frameConf = superframeConf->GetFrameConf (frameId);
           Ptr<SatTimeSlotConf> timeSlotConf = *it;
 
           // Start time
@@ -487,18 +503,31 @@ SatUtMac::ScheduleTimeSlots (Ptr<SatTbtpMessage> tbtp)
           NS_LOG_INFO ("Slot start delay: " << slotDelay.GetSeconds ());
 
           // Duration
-          Ptr<SatWaveform> wf = m_superframeSeq->GetWaveformConf ()->GetWaveform (timeSlotConf->GetWaveFormId ());
-          Time duration = wf->GetBurstDuration (frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
+          Ptr<SatWaveform> wf;
+          Time duration;
+          GetBurstConf (frameId, timeSlotConf->GetWaveFormId (), wf, duration);
 
           // Carrier
-          uint32_t carrierId = m_superframeSeq->GetCarrierId (0, frameId, timeSlotConf->GetCarrierId () );
+          uint32_t carrierId = GetDaCarrierId (frameId, timeSlotConf->GetCarrierId ());
 
           // Schedule individual time slot
-          ScheduleDaTxOpportunity (slotDelay, duration, wf, timeSlotConf, carrierId);
+          if (m_enableSuperframeTxPlan)
+            {
+              m_txPlan->Add (txTime + timeSlotConf->GetStartTime (), duration, wf, timeSlotConf, carrierId);
+            }
+          else
+            {
+              ScheduleDaTxOpportunity (slotDelay, duration, wf, timeSlotConf, carrierId);
+            }
 
           payloadSumInSuperFrame += wf->GetPayloadInBytes ();
           payloadSumPerRcIndex [timeSlotConf->GetRcIndex ()] += wf->GetPayloadInBytes ();
         }
+
+      if (m_enableSuperframeTxPlan)
+        {
+          m_txPlan->Schedule ();
+        }
     }
 
   // Assigned TBTP resources
@@ -524,6 +553,46 @@ SatUtMac::ScheduleDaTxOpportunity (Time transmitDelay, Time duration, Ptr<SatWav
   Simulator::Schedule (transmitDelay, &SatUtMac::DoTransmit, this, duration, carrierId, wf, tsConf, SatUtScheduler::LOOSE);
 }
 
+void
+SatUtMac::GetBurstConf (uint8_t frameId, uint32_t waveformId, Ptr<SatWaveform>& wf, Time& duration)
+{
+  NS_LOG_FUNCTION (this << (uint32_t) frameId << waveformId);
+
+  std::pair<uint8_t, uint32_t> key = std::make_pair (frameId, waveformId);
+  std::map<std::pair<uint8_t, uint32_t>, burstConf_s>::const_iterator it = m_burstConfs.find (key);
+
+  if (it == m_burstConfs.end ())
+    {
+      Ptr<SatFrameConf> frameConf = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE)->GetFrameConf (frameId);
+
+      burstConf_s burstConf;
+      burstConf.waveform = m_superframeSeq->GetWaveformConf ()->GetWaveform (waveformId);
+      burstConf.duration = burstConf.waveform->GetBurstDuration (frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
+
+      it = m_burstConfs.insert (std::make_pair (key, burstConf)).first;
+    }
+
+  wf = it->second.waveform;
+  duration = it->second.duration;
+}
+
+uint32_t
+SatUtMac::GetDaCarrierId (uint8_t frameId, uint16_t frameCarrierId)
+{
+  NS_LOG_FUNCTION (this << (uint32_t) frameId << frameCarrierId);
+
+  std::pair<uint8_t, uint16_t> key = std::make_pair (frameId, frameCarrierId);
+  std::map<std::pair<uint8_t, uint16_t>, uint32_t>::const_iterator it = m_daCarrierIds.find (key);
+
+  if (it == m_daCarrierIds.end ())
+    {
+      uint32_t carrierId = m_superframeSeq->GetCarrierId (0, frameId, frameCarrierId);
+      it = m_daCarrierIds.insert (std::make_pair (key, carrierId)).first;
+    }
+
+  return it->second;
+}
+
 
 void
 SatUtMac::DoTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, SatUtScheduler::SatCompliancePolicy_t policy)
@@ -36,7 +36,10 @@
 #include <ns3/satellite-random-access-container.h>
 #include <ns3/satellite-enums.h>
 #include <ns3/satellite-beam-scheduler.h>
+#include <ns3/satellite-ut-tx-plan.h>
 #include <utility>
+#include <vector>
+#include <map>
 
 namespace ns3 {
 
@@ -467,6 +470,25 @@ private:
    */
   void ScheduleDaTxOpportunity (Time transmitDelay, Time duration, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, uint32_t carrierId);
 
+  /**
+   * Get the waveform and the burst duration of a waveform within a frame.
+   * The values are calculated once and cached.
+   * \param frameId Frame id
+   * \param waveformId Waveform id
+   * \param wf Waveform
+   * \param duration Burst duration
+   */
+  void GetBurstConf (uint8_t frameId, uint32_t waveformId, Ptr<SatWaveform>& wf, Time& duration);
+
+  /**
+   * Get the carrier id of a carrier within a frame. The value is calculated
+   * once and cached.
+   * \param frameId Frame id
+   * \param frameCarrierId Carrier id within the frame
+   * \return Carrier id used for the transmission
+   */
+  uint32_t GetDaCarrierId (uint8_t frameId, uint16_t frameCarrierId);
+
   /**
    * Notify the upper layer about the Tx opportunity. If upper layer
    * returns a PDU, send it to lower layer.
@@ -670,6 +692,36 @@ private:
    */
   bool m_isRandomAccessScheduled;
 
+  /**
+   * Flag to use a superframe transmission plan walked by a single event
+   * instead of scheduling one event per time slot of a TBTP.
+   */
+  bool m_enableSuperframeTxPlan;
+
+  /**
+   * Superframe transmission plan.
+   */
+  Ptr<SatUtTxPlan> m_txPlan;
+
+  /**
+   * Waveform and burst duration of a waveform within a frame.
+   */
+  typedef struct
+  {
+    Ptr<SatWaveform> waveform;
+    Time duration;
+  } burstConf_s;
+
+  /**
+   * Waveforms and burst durations by frame id and waveform id.
+   */
+  std::map<std::pair<uint8_t, uint32_t>, burstConf_s> m_burstConfs;
+
+  /**
+   * Carrier ids by frame id and carrier id within the frame.
+   */
+  std::map<std::pair<uint8_t, uint16_t>, uint32_t> m_daCarrierIds;
+
   class SatTimuInfo : public SimpleRefCount<SatTimuInfo>
   {
   public:
@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <algorithm>
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "satellite-ut-tx-plan.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatUtTxPlan");
+
+namespace ns3 {
+
+SatUtTxPlan::SatUtTxPlan (TxCallback txCallback)
+  : m_txCallback (txCallback),
+  m_opportunities (),
+  m_nextIndex (0),
+  m_txEvent ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SatUtTxPlan::~SatUtTxPlan ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatUtTxPlan::Add (Time txTime, Time duration, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, uint32_t carrierId)
+{
+  NS_LOG_FUNCTION (this << txTime.GetSeconds () << duration.GetSeconds () << carrierId);
+
+  txOpportunity_s opportunity;
+  opportunity.txTime = txTime;
+  opportunity.duration = duration;
+  opportunity.carrierId = carrierId;
+  opportunity.waveform = wf;
+  opportunity.tsConf = tsConf;
+
+  m_opportunities.push_back (opportunity);
+}
+
+void
+SatUtTxPlan::Schedule ()
+{
+  NS_LOG_FUNCTION (this);
+
+  // Drop the transmitted opportunities once per scheduling, not per event
+  m_opportunities.erase (m_opportunities.begin (), m_opportunities.begin () + m_nextIndex);
+  m_nextIndex = 0;
+
+  // The time slots of a new TBTP normally follow the planned ones, so the
+  // plan is nearly sorted. Stable sorting keeps the time slots starting at
+  // the same time in the order they were added.
+  std::stable_sort (m_opportunities.begin (), m_opportunities.end (),
+                    [] (const txOpportunity_s& a, const txOpportunity_s& b)
+    {
+      return a.txTime < b.txTime;
+    });
+
+  if (m_opportunities.empty ())
+    {
+      return;
+    }
+
+  Time nextTxTime = m_opportunities.front ().txTime;
+
+  if (m_txEvent.IsRunning ())
+    {
+      if (Simulator::GetDelayLeft (m_txEvent) + Simulator::Now () <= nextTxTime)
+        {
+          return;
+        }
+      m_txEvent.Cancel ();
+    }
+
+  m_txEvent = Simulator::Schedule (nextTxTime - Simulator::Now (), &SatUtTxPlan::DoTx, this);
+}
+
+void
+SatUtTxPlan::Clear ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_txEvent.Cancel ();
+  m_opportunities.clear ();
+  m_nextIndex = 0;
+}
+
+uint32_t
+SatUtTxPlan::GetSize () const
+{
+  return m_opportunities.size () - m_nextIndex;
+}
+
+void
+SatUtTxPlan::DoTx ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Time now = Simulator::Now ();
+
+  while (m_nextIndex < m_opportunities.size () && m_opportunities[m_nextIndex].txTime <= now)
+    {
+      txOpportunity_s opportunity = m_opportunities[m_nextIndex++];
+      m_txCallback (opportunity.duration, opportunity.carrierId, opportunity.waveform, opportunity.tsConf, SatUtScheduler::LOOSE);
+    }
+
+  if (m_nextIndex < m_opportunities.size ())
+    {
+      m_txEvent = Simulator::Schedule (m_opportunities[m_nextIndex].txTime - now, &SatUtTxPlan::DoTx, this);
+    }
+  else
+    {
+      m_opportunities.clear ();
+      m_nextIndex = 0;
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_UT_TX_PLAN_H_
+#define SATELLITE_UT_TX_PLAN_H_
+
+#include <vector>
+#include "ns3/simple-ref-count.h"
+#include "ns3/nstime.h"
+#include "ns3/callback.h"
+#include "ns3/event-id.h"
+#include "satellite-wave-form-conf.h"
+#include "satellite-frame-conf.h"
+#include "satellite-ut-scheduler.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ * \brief Superframe transmission plan of an UT. The dedicated access Tx
+ * opportunities, i.e. time slots, of the received TBTPs are kept sorted by
+ * the transmission time, and a single event transmits all the opportunities
+ * due at its time. Opportunities starting at the same time are transmitted
+ * in the order they were added, i.e. in the TBTP order, as with one
+ * simulator event per time slot.
+ */
+class SatUtTxPlan : public SimpleRefCount<SatUtTxPlan>
+{
+public:
+  /**
+   * Callback to transmit a Tx opportunity, i.e. SatUtMac::DoTransmit.
+   * \param Time duration of the burst
+   * \param uint32_t carrier id
+   * \param Ptr<SatWaveform> waveform
+   * \param Ptr<SatTimeSlotConf> time slot conf
+   * \param SatUtScheduler::SatCompliancePolicy_t compliance policy
+   */
+  typedef Callback<void, Time, uint32_t, Ptr<SatWaveform>, Ptr<SatTimeSlotConf>, SatUtScheduler::SatCompliancePolicy_t> TxCallback;
+
+  /**
+   * Constructor
+   * \param txCallback Callback to transmit a Tx opportunity
+   */
+  SatUtTxPlan (TxCallback txCallback);
+
+  /**
+   * Destructor
+   */
+  ~SatUtTxPlan ();
+
+  /**
+   * Add one Tx opportunity to the plan. The plan is sorted and scheduled
+   * by Schedule once all the time slots of a TBTP are added.
+   * \param txTime time when transmit possibility starts
+   * \param duration duration of the burst
+   * \param wf waveform
+   * \param tsConf Time slot conf
+   * \param carrierId Carrier id used for the transmission
+   */
+  void Add (Time txTime, Time duration, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, uint32_t carrierId);
+
+  /**
+   * Sort the plan and schedule the event at the time of the next Tx
+   * opportunity. A running event is rescheduled, if an earlier Tx
+   * opportunity has been added.
+   */
+  void Schedule ();
+
+  /**
+   * Cancel the event and forget the planned Tx opportunities.
+   */
+  void Clear ();
+
+  /**
+   * Get the number of the planned Tx opportunities.
+   * \return number of the planned Tx opportunities
+   */
+  uint32_t GetSize () const;
+
+private:
+  /**
+   * Dedicated access Tx opportunity of the plan.
+   */
+  typedef struct
+  {
+    Time txTime;
+    Time duration;
+    uint32_t carrierId;
+    Ptr<SatWaveform> waveform;
+    Ptr<SatTimeSlotConf> tsConf;
+  } txOpportunity_s;
+
+  /**
+   * Transmit all the Tx opportunities starting now, and schedule the event
+   * for the next ones. The transmitted opportunities are only skipped by
+   * the index of the next one, and dropped by Schedule, so that walking
+   * through a superframe does not shift the plan at every event.
+   */
+  void DoTx ();
+
+  /**
+   * Callback to transmit a Tx opportunity.
+   */
+  TxCallback m_txCallback;
+
+  /**
+   * Tx opportunities sorted by the transmission time.
+   */
+  std::vector<txOpportunity_s> m_opportunities;
+
+  /**
+   * Index of the next Tx opportunity to transmit in m_opportunities.
+   */
+  uint32_t m_nextIndex;
+
+  /**
+   * Event for the next Tx opportunity.
+   */
+  EventId m_txEvent;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_UT_TX_PLAN_H_ */
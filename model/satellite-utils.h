@@ -1236,6 +1236,25 @@ public:
     return scalarProduct;
   }
 
+  /**
+   * \brief Calculate the FNV-1a 64-bit checksum of a memory region
+   * \param data Start of the region
+   * \param length Length of the region in bytes
+   * \param hash Checksum of the preceding regions, if the checksum is
+   *        calculated over several regions
+   * \return The checksum
+   */
+  static inline uint64_t CalculateChecksum (const uint8_t* data, uint64_t length,
+                                            uint64_t hash = 14695981039346656037ULL)
+  {
+    for (uint64_t i = 0; i < length; ++i)
+      {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+      }
+    return hash;
+  }
+
 private:
   /**
    * Destructor
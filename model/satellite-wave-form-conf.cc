@@ -175,6 +175,7 @@ NS_OBJECT_ENSURE_REGISTERED (SatWaveformConf);
 
 SatWaveformConf::SatWaveformConf ()
   : m_waveforms (),
+  m_waveformTables (),
   m_targetBLER (0.00001),
   m_acmEnabled (false),
   m_defaultWfId (3),
@@ -189,6 +190,7 @@ SatWaveformConf::SatWaveformConf ()
 
 SatWaveformConf::SatWaveformConf (std::string filePathName)
   : m_waveforms (),
+  m_waveformTables (),
   m_targetBLER (0.00001),
   m_acmEnabled (false),
   m_defaultWfId (3),
@@ -369,6 +371,9 @@ void SatWaveformConf::InitializeEbNoRequirements ( Ptr<SatLinkResultsDvbRcs2> li
       double ebnoRequirementDb = linkResults->GetEbNoDb (it->first, m_targetBLER);
       it->second->SetEbNoRequirement (SatUtils::DbToLinear (ebnoRequirementDb));
     }
+
+  // The C/No thresholds have changed
+  m_waveformTables.clear ();
 }
 
 Ptr<SatWaveform>
@@ -413,27 +418,46 @@ SatWaveformConf::GetBestWaveformId (double cno, double symbolRateInBaud, uint32_
     }
 
   // Return the waveform with best spectral efficiency
-  for ( std::map< uint32_t, Ptr<SatWaveform> >::const_reverse_iterator rit = m_waveforms.rbegin ();
-        rit != m_waveforms.rend ();
-        ++rit )
+  const SatAcmThresholdTable & table = GetWaveformTable (symbolRateInBaud, burstLength);
+  uint32_t index = table.Find (cno);
+
+  if (index < table.GetSize ())
     {
-      if (rit->second->GetBurstLengthInSymbols () == burstLength)
+      wfId = table.GetId (index);
+      cnoThreshold = table.GetThreshold (index);
+      success = true;
+    }
+
+  NS_LOG_INFO ("Get best waveform in RTN link (ACM)! CNo: " << SatUtils::LinearToDb (cno) << ", Symbol rate: " << symbolRateInBaud << ", burst length: " << burstLength << ", WF: " << wfId << ", CNo threshold: " << SatUtils::LinearToDb (cnoThreshold));
+
+  return success;
+}
+
+const SatAcmThresholdTable &
+SatWaveformConf::GetWaveformTable (double symbolRateInBaud, uint32_t burstLength) const
+{
+  NS_LOG_FUNCTION (this << symbolRateInBaud << burstLength);
+
+  std::pair<double, uint32_t> key = std::make_pair (symbolRateInBaud, burstLength);
+  std::map< std::pair<double, uint32_t>, SatAcmThresholdTable >::iterator it = m_waveformTables.find (key);
+
+  if (it == m_waveformTables.end ())
+    {
+      it = m_waveformTables.insert (std::make_pair (key, SatAcmThresholdTable ())).first;
+
+      // Add the waveforms in the order of the best spectral efficiency
+      for ( std::map< uint32_t, Ptr<SatWaveform> >::const_reverse_iterator rit = m_waveforms.rbegin ();
+            rit != m_waveforms.rend ();
+            ++rit )
         {
-          double cnoThr = rit->second->GetCNoThreshold (symbolRateInBaud);
-          // The first waveform over the threshold
-          if (cnoThr <= cno)
+          if (rit->second->GetBurstLengthInSymbols () == burstLength)
             {
-              wfId = rit->first;
-              cnoThreshold = cnoThr;
-              success = true;
-              break;
+              it->second.Add (rit->second->GetCNoThreshold (symbolRateInBaud), rit->first);
             }
         }
     }
 
-  NS_LOG_INFO ("Get best waveform in RTN link (ACM)! CNo: " << SatUtils::LinearToDb (cno) << ", Symbol rate: " << symbolRateInBaud << ", burst length: " << burstLength << ", WF: " << wfId << ", CNo threshold: " << SatUtils::LinearToDb (cnoThreshold));
-
-  return success;
+  return it->second;
 }
 
 bool
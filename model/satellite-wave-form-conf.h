@@ -22,11 +22,13 @@
 #define SATELLITE_WAVE_FORM_CONF_H
 
 #include <vector>
+#include <map>
 #include <ns3/nstime.h>
 #include <ns3/ptr.h>
 #include <ns3/simple-ref-count.h>
 #include <ns3/object.h>
 #include <ns3/satellite-enums.h>
+#include <ns3/satellite-acm-threshold-table.h>
 
 namespace ns3 {
 
@@ -356,11 +358,25 @@ private:
    */
   SatEnums::SatModcod_t ConvertToModCod (uint32_t modulatedBits, uint32_t codingRateNumerator, uint32_t codingRateDenominator) const;
 
+  /**
+   * \brief Get the waveform selection table of a symbol rate and burst length.
+   * The table is built on first use.
+   * \param symbolRateInBaud Frame's symbol rate used for waveform C/No requirement calculation
+   * \param burstLength Burst length in symbols
+   * \return Waveform selection table
+   */
+  const SatAcmThresholdTable & GetWaveformTable (double symbolRateInBaud, uint32_t burstLength) const;
+
   /**
    * Container of the waveforms
    */
   std::map< uint32_t, Ptr<SatWaveform> > m_waveforms;
 
+  /**
+   * Waveform selection tables per symbol rate and burst length
+   */
+  mutable std::map< std::pair<double, uint32_t>, SatAcmThresholdTable > m_waveformTables;
+
   /**
    * Block error rate target for the waveforms. Default value
    * set as an attribute to 10^(-5).
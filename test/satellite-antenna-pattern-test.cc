@@ -18,9 +18,15 @@
  * Author: Jani Puttonen <jani.puttonen@magister.fi>
  */
 
+#include <cstdio>
+#include <cmath>
+#include <fstream>
 #include "ns3/log.h"
 #include "ns3/test.h"
 #include "ns3/simulator.h"
+#include "ns3/config.h"
+#include "ns3/boolean.h"
+#include "ns3/string.h"
 #include "../model/satellite-antenna-gain-pattern.h"
 #include "../model/satellite-antenna-gain-pattern-container.h"
 #include "ns3/singleton.h"
@@ -63,6 +69,11 @@ SatAntennaPatternTestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->DoInitialize ();
   Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-antenna-gain-pattern", "", true);
 
+  // The best beam map written by the test is removed afterwards
+  std::string mapFileName = "SatAntennaGain72Beams_bestbeam_test.bin";
+  std::string mapPathName = Singleton<SatEnvVariables>::Get ()->LocateDataDirectory () + "/antennapatterns/" + mapFileName;
+  Config::SetDefault ("ns3::SatAntennaGainPatternContainer::BestBeamMapFileName", StringValue (mapFileName));
+
   // Create antenna gain container
   SatAntennaGainPatternContainer gpContainer;
 
@@ -117,6 +128,159 @@ SatAntennaPatternTestCase::DoRun (void)
       NS_TEST_ASSERT_MSG_EQ ( bestBeamId, expectedBeamIds[i], "Not expected best spot-beam id");
     }
 
+  std::remove (mapPathName.c_str ());
+  Config::SetDefault ("ns3::SatAntennaGainPatternContainer::BestBeamMapFileName", StringValue ("SatAntennaGain72Beams_bestbeam.bin"));
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case comparing the best beam ids given by the best beam map
+ * with the best beam ids given by interpolating all the antenna patterns.
+ */
+class SatBestBeamMapTestCase : public TestCase
+{
+public:
+  SatBestBeamMapTestCase ();
+  virtual ~SatBestBeamMapTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatBestBeamMapTestCase::SatBestBeamMapTestCase ()
+  : TestCase ("Test satellite best beam map.")
+{
+}
+
+SatBestBeamMapTestCase::~SatBestBeamMapTestCase ()
+{
+}
+
+void
+SatBestBeamMapTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-antenna-gain-pattern", "best-beam-map", true);
+
+  // The best beam map written by the test is removed afterwards
+  std::string mapFileName = "SatAntennaGain72Beams_bestbeam_test.bin";
+  std::string mapPathName = Singleton<SatEnvVariables>::Get ()->LocateDataDirectory () + "/antennapatterns/" + mapFileName;
+  std::remove (mapPathName.c_str ());
+  Config::SetDefault ("ns3::SatAntennaGainPatternContainer::BestBeamMapFileName", StringValue (mapFileName));
+
+  Config::SetDefault ("ns3::SatAntennaGainPatternContainer::EnableBestBeamMap", BooleanValue (true));
+  SatAntennaGainPatternContainer mapContainer;
+
+  Config::SetDefault ("ns3::SatAntennaGainPatternContainer::EnableBestBeamMap", BooleanValue (false));
+  SatAntennaGainPatternContainer patternContainer;
+
+  Config::SetDefault ("ns3::SatAntennaGainPatternContainer::EnableBestBeamMap", BooleanValue (true));
+
+  // Random valid positions of every beam, including the beam borders
+  for (uint32_t beamId = 1; beamId <= patternContainer.GetNAntennaGainPatterns (); ++beamId)
+    {
+      Ptr<SatAntennaGainPattern> gainPattern = patternContainer.GetAntennaGainPattern (beamId);
+
+      for (uint32_t i = 0; i < 50; ++i)
+        {
+          GeoCoordinate position = gainPattern->GetValidRandomPosition ();
+          NS_TEST_ASSERT_MSG_EQ (mapContainer.GetBestBeamId (position), patternContainer.GetBestBeamId (position),
+                                 "Best beam map and antenna patterns give different best beams");
+        }
+    }
+
+  std::remove (mapPathName.c_str ());
+  Config::SetDefault ("ns3::SatAntennaGainPatternContainer::BestBeamMapFileName", StringValue ("SatAntennaGain72Beams_bestbeam.bin"));
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case comparing the antenna patterns read from the antenna
+ * pattern cache with the antenna patterns read from the antenna pattern files.
+ */
+class SatAntennaPatternCacheTestCase : public TestCase
+{
+public:
+  SatAntennaPatternCacheTestCase ();
+  virtual ~SatAntennaPatternCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatAntennaPatternCacheTestCase::SatAntennaPatternCacheTestCase ()
+  : TestCase ("Test satellite antenna pattern cache.")
+{
+}
+
+SatAntennaPatternCacheTestCase::~SatAntennaPatternCacheTestCase ()
+{
+}
+
+void
+SatAntennaPatternCacheTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-antenna-gain-pattern", "cache", true);
+
+  std::string cacheFileName = "SatAntennaGain72Beams_test.cache";
+  std::string dataPath = Singleton<SatEnvVariables>::Get ()->LocateDataDirectory ();
+  std::string cachePathName = dataPath + "/antennapatterns/" + cacheFileName;
+  std::remove (cachePathName.c_str ());
+
+  Config::SetDefault ("ns3::SatAntennaGainPatternContainer::EnablePatternCache", BooleanValue (false));
+  SatAntennaGainPatternContainer fileContainer;
+  NS_TEST_ASSERT_MSG_EQ (fileContainer.IsReadFromPatternCache (), false, "Patterns read from a disabled cache");
+
+  // The first container writes the cache, the second one reads it
+  Config::SetDefault ("ns3::SatAntennaGainPatternContainer::EnablePatternCache", BooleanValue (true));
+  Config::SetDefault ("ns3::SatAntennaGainPatternContainer::PatternCacheFileName", StringValue (cacheFileName));
+  SatAntennaGainPatternContainer writingContainer;
+  NS_TEST_ASSERT_MSG_EQ (writingContainer.IsReadFromPatternCache (), false, "Patterns read from a removed cache");
+  NS_TEST_ASSERT_MSG_EQ (std::ifstream (cachePathName.c_str ()).good (), true, "Cache not written");
+
+  SatAntennaGainPatternContainer cacheContainer;
+  NS_TEST_ASSERT_MSG_EQ (cacheContainer.IsReadFromPatternCache (), true, "Patterns not read from the cache");
+
+  Config::SetDefault ("ns3::SatAntennaGainPatternContainer::PatternCacheFileName", StringValue ("SatAntennaGain72Beams.cache"));
+
+  for (uint32_t beamId = 1; beamId <= fileContainer.GetNAntennaGainPatterns (); ++beamId)
+    {
+      SatAntennaGainPattern::PatternData_t fromFile;
+      SatAntennaGainPattern::PatternData_t fromCache;
+      fileContainer.GetAntennaGainPattern (beamId)->GetPatternData (fromFile);
+      cacheContainer.GetAntennaGainPattern (beamId)->GetPatternData (fromCache);
+
+      NS_TEST_ASSERT_MSG_EQ ((fromFile.latitudes == fromCache.latitudes), true, "Latitudes differ");
+      NS_TEST_ASSERT_MSG_EQ ((fromFile.longitudes == fromCache.longitudes), true, "Longitudes differ");
+      NS_TEST_ASSERT_MSG_EQ ((fromFile.validPositions == fromCache.validPositions), true, "Valid positions differ");
+      NS_TEST_ASSERT_MSG_EQ (fromFile.gains.size (), fromCache.gains.size (), "Gain count differs");
+
+      for (uint32_t i = 0; i < fromFile.gains.size () && i < fromCache.gains.size (); ++i)
+        {
+          // Undefined gains are NaN in both patterns
+          if (!(std::isnan (fromFile.gains[i]) && std::isnan (fromCache.gains[i])))
+            {
+              NS_TEST_ASSERT_MSG_EQ (fromFile.gains[i], fromCache.gains[i], "Gain differs");
+            }
+        }
+
+      NS_TEST_ASSERT_MSG_EQ (fromFile.minLat, fromCache.minLat, "Minimum latitude differs");
+      NS_TEST_ASSERT_MSG_EQ (fromFile.maxLat, fromCache.maxLat, "Maximum latitude differs");
+      NS_TEST_ASSERT_MSG_EQ (fromFile.minLon, fromCache.minLon, "Minimum longitude differs");
+      NS_TEST_ASSERT_MSG_EQ (fromFile.maxLon, fromCache.maxLon, "Maximum longitude differs");
+      NS_TEST_ASSERT_MSG_EQ (fromFile.latInterval, fromCache.latInterval, "Latitude interval differs");
+      NS_TEST_ASSERT_MSG_EQ (fromFile.lonInterval, fromCache.lonInterval, "Longitude interval differs");
+    }
+
+  std::remove (cachePathName.c_str ());
+
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
@@ -134,6 +298,8 @@ SatAntennaPatternTestSuite::SatAntennaPatternTestSuite ()
   : TestSuite ("sat-antenna-gain-pattern-test", UNIT)
 {
   AddTestCase (new SatAntennaPatternTestCase, TestCase::QUICK);
+  AddTestCase (new SatBestBeamMapTestCase, TestCase::QUICK);
+  AddTestCase (new SatAntennaPatternCacheTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
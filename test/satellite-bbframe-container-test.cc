@@ -0,0 +1,416 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup satellite
+ * \file satellite-bbframe-container-test.cc
+ * \brief BB frame container test suite
+ */
+
+#include <algorithm>
+#include <map>
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/ptr.h"
+#include "ns3/packet.h"
+#include "ns3/enum.h"
+#include "../model/satellite-bbframe.h"
+#include "../model/satellite-bbframe-conf.h"
+#include "../model/satellite-bbframe-container.h"
+#include "../model/satellite-enums.h"
+#include "ns3/singleton.h"
+#include "ns3/satellite-env-variables.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Base of the BB frame container test cases, with the helpers to
+ * fill and drain the MODCOD queues of a container.
+ */
+class SatBbFrameContainerTestCaseBase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param name name of the test case
+   */
+  SatBbFrameContainerTestCaseBase (std::string name);
+  virtual ~SatBbFrameContainerTestCaseBase ();
+
+protected:
+  /**
+   * \brief Create the BB frame configuration and pick three MODCODs of it
+   * \param usageMode BB frame usage mode
+   */
+  void CreateConf (SatEnums::BbFrameUsageMode_t usageMode);
+
+  /**
+   * \brief Create a container with a queue selection policy
+   * \param policy queue selection policy
+   * \return the container
+   */
+  Ptr<SatBbFrameContainer> CreateContainer (SatBbFrameContainer::QueueSelectionPolicy_t policy);
+
+  /**
+   * \brief Add full frames to a MODCOD queue
+   * \param container the container
+   * \param modcod MODCOD of the queue
+   * \param frames number of frames
+   */
+  void AddFullFrames (Ptr<SatBbFrameContainer> container, SatEnums::SatModcod_t modcod, uint32_t frames);
+
+  /**
+   * \brief Get all the frames of a container and check that the cached
+   * queue durations equal the durations of the frames got from the queues
+   * \param container the container
+   * \return the MODCODs of the frames in the order they were got
+   */
+  std::vector<SatEnums::SatModcod_t> DrainAndCheckDurations (Ptr<SatBbFrameContainer> container);
+
+  Ptr<SatBbFrameConf> m_conf;
+  std::vector<SatEnums::SatModcod_t> m_modcodsUsed;
+
+  /**
+   * \brief Three MODCODs in use in ascending order
+   */
+  std::vector<SatEnums::SatModcod_t> m_modcods;
+};
+
+SatBbFrameContainerTestCaseBase::SatBbFrameContainerTestCaseBase (std::string name)
+  : TestCase (name)
+{
+}
+
+SatBbFrameContainerTestCaseBase::~SatBbFrameContainerTestCaseBase ()
+{
+}
+
+void
+SatBbFrameContainerTestCaseBase::CreateConf (SatEnums::BbFrameUsageMode_t usageMode)
+{
+  m_conf = CreateObject<SatBbFrameConf> (93750000, SatEnums::DVB_S2);
+  m_conf->SetAttribute ("BBFrameUsageMode", EnumValue (usageMode));
+  m_modcodsUsed = m_conf->GetModCodsUsed ();
+
+  std::vector<SatEnums::SatModcod_t> sorted = m_modcodsUsed;
+  std::sort (sorted.begin (), sorted.end ());
+
+  m_modcods.clear ();
+  m_modcods.push_back (sorted.front ());
+  m_modcods.push_back (sorted[sorted.size () / 2]);
+  m_modcods.push_back (sorted.back ());
+}
+
+Ptr<SatBbFrameContainer>
+SatBbFrameContainerTestCaseBase::CreateContainer (SatBbFrameContainer::QueueSelectionPolicy_t policy)
+{
+  Ptr<SatBbFrameContainer> container = CreateObject<SatBbFrameContainer> (m_modcodsUsed, m_conf);
+  container->SetAttribute ("QueueSelectionPolicy", EnumValue (policy));
+  return container;
+}
+
+void
+SatBbFrameContainerTestCaseBase::AddFullFrames (Ptr<SatBbFrameContainer> container, SatEnums::SatModcod_t modcod, uint32_t frames)
+{
+  uint32_t packetSize = container->GetMaxFramePayloadInBytes (1, modcod) - m_conf->GetBbFrameHeaderSizeInBytes ();
+
+  for (uint32_t i = 0; i < frames; ++i)
+    {
+      container->AddData (1, modcod, Create<Packet> (packetSize));
+    }
+}
+
+std::vector<SatEnums::SatModcod_t>
+SatBbFrameContainerTestCaseBase::DrainAndCheckDurations (Ptr<SatBbFrameContainer> container)
+{
+  std::map<SatEnums::SatModcod_t, Time> cachedDurations;
+  Time cachedTotal = Seconds (0);
+
+  for (std::vector<SatEnums::SatModcod_t>::const_iterator it = m_modcodsUsed.begin (); it != m_modcodsUsed.end (); ++it)
+    {
+      cachedDurations[*it] = container->GetQueueDuration (*it);
+      cachedTotal += cachedDurations[*it];
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (cachedTotal, container->GetTotalDuration (), "Queue durations do not sum up to the total duration");
+
+  std::vector<SatEnums::SatModcod_t> order;
+  std::map<SatEnums::SatModcod_t, Time> frameDurations;
+
+  for (Ptr<SatBbFrame> frame = container->GetNextFrame (); frame != 0; frame = container->GetNextFrame ())
+    {
+      order.push_back (frame->GetModcod ());
+      frameDurations[frame->GetModcod ()] += frame->GetDuration ();
+    }
+
+  for (std::vector<SatEnums::SatModcod_t>::const_iterator it = m_modcodsUsed.begin (); it != m_modcodsUsed.end (); ++it)
+    {
+      NS_TEST_EXPECT_MSG_EQ (cachedDurations[*it], frameDurations[*it], "Cached duration differs from the frames of MODCOD " << *it);
+      NS_TEST_EXPECT_MSG_EQ (container->GetQueueDuration (*it), Seconds (0), "Duration left in the empty queue of MODCOD " << *it);
+    }
+
+  return order;
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the round robin policy serves the non-empty
+ * MODCOD queues in ascending MODCOD order, wrapping around.
+ */
+class SatBbFrameContainerRoundRobinTestCase : public SatBbFrameContainerTestCaseBase
+{
+public:
+  SatBbFrameContainerRoundRobinTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatBbFrameContainerRoundRobinTestCase::SatBbFrameContainerRoundRobinTestCase ()
+  : SatBbFrameContainerTestCaseBase ("Test round robin MODCOD queue selection.")
+{
+}
+
+void
+SatBbFrameContainerRoundRobinTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-bbframe-container", "round-robin", true);
+
+  CreateConf (SatEnums::NORMAL_FRAMES);
+  Ptr<SatBbFrameContainer> container = CreateContainer (SatBbFrameContainer::ROUND_ROBIN_QUEUE);
+
+  AddFullFrames (container, m_modcods[0], 3);
+  AddFullFrames (container, m_modcods[1], 1);
+  AddFullFrames (container, m_modcods[2], 2);
+
+  // The second frame empties the queue of the middle MODCOD. A frame added
+  // to it afterwards is served only after the other MODCODs.
+  Ptr<SatBbFrame> frame = container->GetNextFrame ();
+  NS_TEST_ASSERT_MSG_EQ (frame->GetModcod (), m_modcods[0], "Wrong first MODCOD");
+
+  SatEnums::SatModcod_t expected[] = { m_modcods[1], m_modcods[2], m_modcods[0], m_modcods[1], m_modcods[2], m_modcods[0] };
+
+  frame = container->GetNextFrame ();
+  NS_TEST_ASSERT_MSG_EQ (frame->GetModcod (), expected[0], "Wrong second MODCOD");
+  AddFullFrames (container, m_modcods[1], 1);
+
+  std::vector<SatEnums::SatModcod_t> order = DrainAndCheckDurations (container);
+
+  NS_TEST_ASSERT_MSG_EQ (order.size (), 5, "Wrong number of frames");
+  for (uint32_t i = 0; i < order.size (); ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (order[i], expected[i + 1], "Wrong MODCOD of frame " << i + 2);
+    }
+
+  container->Dispose ();
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the random policy serves every frame, keeps
+ * the frame order within a MODCOD queue and is reproducible with the same
+ * random stream.
+ */
+class SatBbFrameContainerRandomTestCase : public SatBbFrameContainerTestCaseBase
+{
+public:
+  SatBbFrameContainerRandomTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatBbFrameContainerRandomTestCase::SatBbFrameContainerRandomTestCase ()
+  : SatBbFrameContainerTestCaseBase ("Test random MODCOD queue selection.")
+{
+}
+
+void
+SatBbFrameContainerRandomTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-bbframe-container", "random", true);
+
+  CreateConf (SatEnums::NORMAL_FRAMES);
+
+  std::vector<SatEnums::SatModcod_t> orders[2];
+
+  for (uint32_t run = 0; run < 2; ++run)
+    {
+      Ptr<SatBbFrameContainer> container = CreateContainer (SatBbFrameContainer::RANDOM_QUEUE);
+      NS_TEST_ASSERT_MSG_EQ (container->AssignStreams (100), 1, "Wrong number of streams assigned");
+
+      AddFullFrames (container, m_modcods[0], 10);
+      AddFullFrames (container, m_modcods[1], 10);
+      AddFullFrames (container, m_modcods[2], 10);
+
+      orders[run] = DrainAndCheckDurations (container);
+      container->Dispose ();
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (orders[0].size (), 30, "Wrong number of frames");
+  NS_TEST_ASSERT_MSG_EQ ((orders[0] == orders[1]), true, "Selection not reproducible with the same stream");
+
+  for (uint32_t i = 0; i < m_modcods.size (); ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (std::count (orders[0].begin (), orders[0].end (), m_modcods[i]), 10, "Wrong number of frames of MODCOD " << m_modcods[i]);
+    }
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the duration weighted policy selects a queue
+ * with a probability proportional to its queued duration.
+ */
+class SatBbFrameContainerDurationWeightedTestCase : public SatBbFrameContainerTestCaseBase
+{
+public:
+  SatBbFrameContainerDurationWeightedTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatBbFrameContainerDurationWeightedTestCase::SatBbFrameContainerDurationWeightedTestCase ()
+  : SatBbFrameContainerTestCaseBase ("Test duration weighted MODCOD queue selection.")
+{
+}
+
+void
+SatBbFrameContainerDurationWeightedTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-bbframe-container", "duration-weighted", true);
+
+  CreateConf (SatEnums::NORMAL_FRAMES);
+
+  const uint32_t trials = 1000;
+  uint32_t firstFromLongQueue = 0;
+  double expectedProbability = 0.0;
+
+  for (uint32_t trial = 0; trial < trials; ++trial)
+    {
+      Ptr<SatBbFrameContainer> container = CreateContainer (SatBbFrameContainer::DURATION_WEIGHTED_QUEUE);
+      container->AssignStreams (trial);
+
+      AddFullFrames (container, m_modcods[0], 3);
+      AddFullFrames (container, m_modcods[2], 1);
+
+      Time longDuration = container->GetQueueDuration (m_modcods[0]);
+      expectedProbability = longDuration.GetSeconds () / container->GetTotalDuration ().GetSeconds ();
+
+      if (container->GetNextFrame ()->GetModcod () == m_modcods[0])
+        {
+          ++firstFromLongQueue;
+        }
+
+      std::vector<SatEnums::SatModcod_t> order = DrainAndCheckDurations (container);
+      NS_TEST_ASSERT_MSG_EQ (order.size (), 3, "Wrong number of frames");
+      container->Dispose ();
+    }
+
+  NS_TEST_ASSERT_MSG_EQ_TOL ((double) firstFromLongQueue / trials, expectedProbability, 0.05,
+                             "Queue not selected in proportion to its duration");
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the cached queue durations follow the
+ * merging, shrinking and extending of the frames.
+ */
+class SatBbFrameContainerMergeTestCase : public SatBbFrameContainerTestCaseBase
+{
+public:
+  SatBbFrameContainerMergeTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatBbFrameContainerMergeTestCase::SatBbFrameContainerMergeTestCase ()
+  : SatBbFrameContainerTestCaseBase ("Test MODCOD queue durations with merged and shrunk frames.")
+{
+}
+
+void
+SatBbFrameContainerMergeTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-bbframe-container", "merge", true);
+
+  CreateConf (SatEnums::SHORT_AND_NORMAL_FRAMES);
+
+  Ptr<SatBbFrameContainer> container = CreateContainer (SatBbFrameContainer::ROUND_ROBIN_QUEUE);
+
+  // Full frames followed by nearly empty tail frames, which are merged or shrunk
+  for (uint32_t i = 0; i < m_modcods.size (); ++i)
+    {
+      AddFullFrames (container, m_modcods[i], 2);
+      container->AddData (1, m_modcods[i], Create<Packet> (100));
+    }
+
+  Time durationBefore = container->GetTotalDuration ();
+  container->MergeBbFrames (93750000);
+  NS_TEST_ASSERT_MSG_LT (container->GetTotalDuration (), durationBefore, "Tail frames not merged or shrunk");
+
+  // Data added to the shrunk short tail frames extends them
+  for (uint32_t i = 0; i < m_modcods.size (); ++i)
+    {
+      if (!container->IsEmpty (1, m_modcods[i]))
+        {
+          container->AddData (1, m_modcods[i], Create<Packet> (100));
+        }
+    }
+
+  DrainAndCheckDurations (container);
+  NS_TEST_ASSERT_MSG_EQ (container->GetTotalDuration (), Seconds (0), "Duration left in the empty container");
+
+  container->Dispose ();
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the BB frame container.
+ */
+class SatBbFrameContainerTestSuite : public TestSuite
+{
+public:
+  SatBbFrameContainerTestSuite ();
+};
+
+SatBbFrameContainerTestSuite::SatBbFrameContainerTestSuite ()
+  : TestSuite ("sat-bbframe-container-test", UNIT)
+{
+  AddTestCase (new SatBbFrameContainerRoundRobinTestCase, TestCase::QUICK);
+  AddTestCase (new SatBbFrameContainerRandomTestCase, TestCase::QUICK);
+  AddTestCase (new SatBbFrameContainerDurationWeightedTestCase, TestCase::QUICK);
+  AddTestCase (new SatBbFrameContainerMergeTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatBbFrameContainerTestSuite satBbFrameContainerTestSuite;
@@ -0,0 +1,585 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup satellite
+ * \file satellite-channel-test.cc
+ * \brief Test suite for the optional SatChannel optimizations
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/config.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/nstime.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/singleton.h"
+#include "ns3/channel-list.h"
+#include "ns3/applications-module.h"
+#include "ns3/satellite-module.h"
+#include "ns3/traffic-module.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Base of the SatChannel test cases, which run the same scenario with
+ * an optimization of the channel disabled and enabled and compare the link
+ * budgets of the received bursts.
+ *
+ *  The scenario has the co-channel beams 1 and 5, with two UTs in beam 1 and
+ *  one UT in beam 5. Every UT user receives forward link traffic from a GW
+ *  user and sends return link traffic to it with constant assignments.
+ *  Fading, channel estimation error and ACM are disabled, and the error
+ *  models always receive the bursts, so the timing of the bursts does not
+ *  depend on their SINR.
+ */
+class SatChannelTestCaseBase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param name name of the test case
+   */
+  SatChannelTestCaseBase (std::string name);
+  virtual ~SatChannelTestCaseBase ();
+
+protected:
+  /**
+   * \brief Link budget of a received burst
+   */
+  typedef struct
+  {
+    Time time;
+    std::string context;
+    Mac48Address receiver;
+    SatEnums::ChannelType_t channelType;
+    double ifPower;
+    double cSinr;
+  } LinkBudget_t;
+
+  /**
+   * \brief Run the scenario
+   * \param linkBudgets Link budgets of the received bursts
+   * \param rxBytes Bytes received by the UT users and the GW user
+   */
+  void RunScenario (std::vector<LinkBudget_t> &linkBudgets, std::vector<uint64_t> &rxBytes);
+
+  /**
+   * \brief Called after the scenario has been created and before it is run
+   * \param helper the satellite helper of the scenario
+   */
+  virtual void ScenarioCreated (Ptr<SatHelper> helper);
+
+  /**
+   * \brief Called after the scenario has been run and before the simulator
+   * is destroyed
+   */
+  virtual void ScenarioFinished (void);
+
+  /**
+   * \brief Check that two runs received the same bursts at the same times
+   * with the same link budgets and the same bytes
+   * \param expected link budgets of the reference run
+   * \param actual link budgets of the compared run
+   * \param expectedRxBytes received bytes of the reference run
+   * \param actualRxBytes received bytes of the compared run
+   */
+  void CheckEqualRuns (const std::vector<LinkBudget_t> &expected, const std::vector<LinkBudget_t> &actual,
+                       const std::vector<uint64_t> &expectedRxBytes, const std::vector<uint64_t> &actualRxBytes);
+
+private:
+  /**
+   * \brief Store the link budget of a received burst
+   */
+  void LinkBudgetTraceCb (std::string context, Ptr<SatSignalParameters> params,
+                          Mac48Address ownAdd, Mac48Address destAdd,
+                          double ifPower, double cSinr);
+
+  std::vector<LinkBudget_t> *m_linkBudgets;
+};
+
+SatChannelTestCaseBase::SatChannelTestCaseBase (std::string name)
+  : TestCase (name),
+  m_linkBudgets (NULL)
+{
+}
+
+SatChannelTestCaseBase::~SatChannelTestCaseBase ()
+{
+}
+
+void
+SatChannelTestCaseBase::LinkBudgetTraceCb (std::string context, Ptr<SatSignalParameters> params,
+                                           Mac48Address ownAdd, Mac48Address destAdd,
+                                           double ifPower, double cSinr)
+{
+  LinkBudget_t linkBudget = { Simulator::Now (), context, ownAdd, params->m_channelType, ifPower, cSinr };
+  m_linkBudgets->push_back (linkBudget);
+}
+
+void
+SatChannelTestCaseBase::ScenarioCreated (Ptr<SatHelper> helper)
+{
+}
+
+void
+SatChannelTestCaseBase::ScenarioFinished (void)
+{
+}
+
+void
+SatChannelTestCaseBase::RunScenario (std::vector<LinkBudget_t> &linkBudgets, std::vector<uint64_t> &rxBytes)
+{
+  Singleton<SatIdMapper>::Get ()->Reset ();
+
+  Config::SetDefault ("ns3::SatBeamHelper::FadingModel", EnumValue (SatEnums::FADING_OFF));
+  Config::SetDefault ("ns3::SatUtHelper::EnableChannelEstimationError", BooleanValue (false));
+  Config::SetDefault ("ns3::SatGwHelper::EnableChannelEstimationError", BooleanValue (false));
+  Config::SetDefault ("ns3::SatBbFrameConf::AcmEnabled", BooleanValue (false));
+  Config::SetDefault ("ns3::SatWaveformConf::AcmEnabled", BooleanValue (false));
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (SatPhyRxCarrierConf::EM_NONE));
+  Config::SetDefault ("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue (SatPhyRxCarrierConf::EM_NONE));
+  Config::SetDefault ("ns3::SatUtHelper::DaFwdLinkInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_PER_PACKET));
+  Config::SetDefault ("ns3::SatGeoHelper::DaFwdLinkInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_PER_PACKET));
+  Config::SetDefault ("ns3::SatGwHelper::DaRtnLinkInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_PER_PACKET));
+  Config::SetDefault ("ns3::SatGeoHelper::DaRtnLinkInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_PER_PACKET));
+  Config::SetDefault ("ns3::SatFwdLinkScheduler::DummyFrameSendingEnabled", BooleanValue (false));
+  Config::SetDefault ("ns3::SatConf::SuperFrameConfForSeq0", EnumValue (SatSuperframeConf::SUPER_FRAME_CONFIG_0));
+  Config::SetDefault ("ns3::SatSuperframeConf0::FrameCount", UintegerValue (1));
+  Config::SetDefault ("ns3::SatSuperframeConf0::FrameConfigType", EnumValue (SatSuperframeConf::CONFIG_TYPE_0));
+  Config::SetDefault ("ns3::SatSuperframeConf0::Frame0_AllocatedBandwidthHz", DoubleValue (1.25e6));
+  Config::SetDefault ("ns3::SatSuperframeConf0::Frame0_CarrierAllocatedBandwidthHz", DoubleValue (1.25e6));
+  Config::SetDefault ("ns3::SatWaveformConf::DefaultWfId", UintegerValue (13));
+
+  // Return link traffic with constant assignments only
+  Config::SetDefault ("ns3::SatBeamHelper::RandomAccessModel", EnumValue (SatEnums::RA_MODEL_OFF));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::DaService3_ConstantAssignmentProvided", BooleanValue (true));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::DaService3_RbdcAllowed", BooleanValue (false));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::DaService3_VolumeAllowed", BooleanValue (false));
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> ();
+
+  // beams 1 and 5 are co-channel beams
+  std::map<uint32_t, SatBeamUserInfo > beamMap;
+  beamMap[1] = SatBeamUserInfo (2, 1);
+  beamMap[5] = SatBeamUserInfo (1, 1);
+
+  helper->CreateUserDefinedScenario (beamMap);
+
+  m_linkBudgets = &linkBudgets;
+
+  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+                   MakeCallback (&SatChannelTestCaseBase::LinkBudgetTraceCb, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+                   MakeCallback (&SatChannelTestCaseBase::LinkBudgetTraceCb, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+                   MakeCallback (&SatChannelTestCaseBase::LinkBudgetTraceCb, this));
+
+  NodeContainer utUsers = helper->GetUtUsers ();
+  NodeContainer gwUsers = helper->GetGwUsers ();
+  uint16_t port = 9;
+
+  PacketSinkHelper sinkHelper ("ns3::UdpSocketFactory", Address ());
+  ApplicationContainer sinks;
+  for (uint32_t i = 0; i < utUsers.GetN (); i++)
+    {
+      sinkHelper.SetAttribute ("Local", AddressValue (Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (i)), port))));
+      sinks.Add (sinkHelper.Install (utUsers.Get (i)));
+    }
+  sinkHelper.SetAttribute ("Local", AddressValue (Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port))));
+  sinks.Add (sinkHelper.Install (gwUsers.Get (0)));
+  sinks.Start (Seconds (0.1));
+  sinks.Stop (Seconds (1.0));
+
+  CbrHelper cbrHelper ("ns3::UdpSocketFactory", Address ());
+  cbrHelper.SetAttribute ("PacketSize", UintegerValue (512));
+
+  ApplicationContainer cbrs;
+  for (uint32_t i = 0; i < utUsers.GetN (); i++)
+    {
+      cbrHelper.SetAttribute ("Remote", AddressValue (Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (i)), port))));
+      cbrHelper.SetAttribute ("Interval", StringValue ("0.002s"));
+      cbrs.Add (cbrHelper.Install (gwUsers.Get (0)));
+
+      cbrHelper.SetAttribute ("Remote", AddressValue (Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port))));
+      cbrHelper.SetAttribute ("Interval", StringValue ("0.02s"));
+      cbrs.Add (cbrHelper.Install (utUsers.Get (i)));
+    }
+  cbrs.Start (Seconds (0.2));
+  cbrs.Stop (Seconds (0.6));
+
+  ScenarioCreated (helper);
+
+  Simulator::Stop (Seconds (1.0));
+  Simulator::Run ();
+
+  ScenarioFinished ();
+
+  rxBytes.clear ();
+  for (uint32_t i = 0; i < sinks.GetN (); i++)
+    {
+      rxBytes.push_back (DynamicCast<PacketSink> (sinks.Get (i))->GetTotalRx ());
+    }
+
+  Simulator::Destroy ();
+  m_linkBudgets = NULL;
+}
+
+void
+SatChannelTestCaseBase::CheckEqualRuns (const std::vector<LinkBudget_t> &expected, const std::vector<LinkBudget_t> &actual,
+                                        const std::vector<uint64_t> &expectedRxBytes, const std::vector<uint64_t> &actualRxBytes)
+{
+  NS_TEST_ASSERT_MSG_EQ (actualRxBytes.size (), expectedRxBytes.size (), "Different number of users");
+  for (uint32_t i = 0; i < expectedRxBytes.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_GT (expectedRxBytes[i], 0, "Nothing received by user " << i);
+      NS_TEST_ASSERT_MSG_EQ (actualRxBytes[i], expectedRxBytes[i], "Different bytes received by user " << i);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (actual.size (), expected.size (), "Different number of received bursts");
+
+  std::map<SatEnums::ChannelType_t, bool> interfered;
+
+  for (uint32_t i = 0; i < expected.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (actual[i].time, expected[i].time, "Different reception time of burst " << i);
+      NS_TEST_ASSERT_MSG_EQ (actual[i].context, expected[i].context, "Different receiving carrier of burst " << i);
+      NS_TEST_ASSERT_MSG_EQ (actual[i].receiver, expected[i].receiver, "Different receiver of burst " << i);
+      NS_TEST_ASSERT_MSG_EQ (actual[i].channelType, expected[i].channelType, "Different channel of burst " << i);
+
+      // Allow the rounding errors of summing the interference powers
+      NS_TEST_ASSERT_MSG_EQ_TOL (actual[i].ifPower, expected[i].ifPower, 1e-9 * expected[i].ifPower,
+                                 "Different interference power of burst " << i);
+      NS_TEST_ASSERT_MSG_EQ_TOL (actual[i].cSinr, expected[i].cSinr, 1e-9 * expected[i].cSinr,
+                                 "Different composite SINR of burst " << i);
+
+      interfered[expected[i].channelType] = interfered[expected[i].channelType] || expected[i].ifPower > 0.0;
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (interfered[SatEnums::FORWARD_USER_CH], true, "No interference in forward user link");
+  NS_TEST_ASSERT_MSG_EQ (interfered[SatEnums::RETURN_USER_CH], true, "No interference in return user link");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that delivering a burst to the receivers of a
+ * node with one event does not change the results.
+ *
+ *  This case runs the scenario with the batched reception disabled and
+ *  enabled. In the return user and forward feeder links the satellite PHYs
+ *  of both beams receive every burst and are batched.
+ *
+ *  Expected result:
+ *    The link budgets of all the received bursts, and the bytes received by
+ *    the users, are the same in both runs.
+ */
+class SatChannelBatchedRxTestCase : public SatChannelTestCaseBase
+{
+public:
+  SatChannelBatchedRxTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatChannelBatchedRxTestCase::SatChannelBatchedRxTestCase ()
+  : SatChannelTestCaseBase ("Test that the batched reception gives the same link budgets as one event per receiver")
+{
+}
+
+void
+SatChannelBatchedRxTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-channel", "batched-rx", true);
+
+  std::vector<LinkBudget_t> separateLinkBudgets;
+  std::vector<uint64_t> separateRxBytes;
+  Config::SetDefault ("ns3::SatChannel::EnableBatchedRx", BooleanValue (false));
+  RunScenario (separateLinkBudgets, separateRxBytes);
+
+  std::vector<LinkBudget_t> batchedLinkBudgets;
+  std::vector<uint64_t> batchedRxBytes;
+  Config::SetDefault ("ns3::SatChannel::EnableBatchedRx", BooleanValue (true));
+  RunScenario (batchedLinkBudgets, batchedRxBytes);
+
+  CheckEqualRuns (separateLinkBudgets, batchedLinkBudgets, separateRxBytes, batchedRxBytes);
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the cached link gains equal the calculated
+ * ones, also after a terminal has moved.
+ *
+ *  This case runs the scenario with the link gain cache disabled and
+ *  enabled. The UTs and GWs are static, so the gains of all their links are
+ *  cached. In the middle of the traffic UT 1 is moved within its beam, which
+ *  changes the antenna gains and the free space loss of its links.
+ *
+ *  Expected result:
+ *    The link budgets of all the received bursts, and the bytes received by
+ *    the users, are the same in both runs, i.e. the cached gains are the
+ *    calculated ones and the move invalidates the cached gains of the links
+ *    of UT 1.
+ */
+class SatChannelLinkGainCacheTestCase : public SatChannelTestCaseBase
+{
+public:
+  SatChannelLinkGainCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+  virtual void ScenarioCreated (Ptr<SatHelper> helper);
+
+  /**
+   * \brief Move a terminal
+   * \param mobility mobility model of the terminal
+   * \param position new position
+   */
+  static void MoveTerminal (Ptr<SatMobilityModel> mobility, GeoCoordinate position);
+};
+
+SatChannelLinkGainCacheTestCase::SatChannelLinkGainCacheTestCase ()
+  : SatChannelTestCaseBase ("Test that the cached link gains equal the calculated ones, also after a course change")
+{
+}
+
+void
+SatChannelLinkGainCacheTestCase::MoveTerminal (Ptr<SatMobilityModel> mobility, GeoCoordinate position)
+{
+  mobility->SetGeoPosition (position);
+}
+
+void
+SatChannelLinkGainCacheTestCase::ScenarioCreated (Ptr<SatHelper> helper)
+{
+  Ptr<SatMobilityModel> mobility = helper->UtNodes ().Get (0)->GetObject<SatMobilityModel> ();
+  NS_ASSERT (mobility != NULL);
+
+  GeoCoordinate position = mobility->GetGeoPosition ();
+  position.SetLatitude (position.GetLatitude () + 0.1);
+
+  Simulator::Schedule (Seconds (0.4), &SatChannelLinkGainCacheTestCase::MoveTerminal, mobility, position);
+}
+
+void
+SatChannelLinkGainCacheTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-channel", "link-gain-cache", true);
+
+  std::vector<LinkBudget_t> calculatedLinkBudgets;
+  std::vector<uint64_t> calculatedRxBytes;
+  Config::SetDefault ("ns3::SatChannel::EnableLinkGainCache", BooleanValue (false));
+  RunScenario (calculatedLinkBudgets, calculatedRxBytes);
+
+  std::vector<LinkBudget_t> cachedLinkBudgets;
+  std::vector<uint64_t> cachedRxBytes;
+  Config::SetDefault ("ns3::SatChannel::EnableLinkGainCache", BooleanValue (true));
+  RunScenario (cachedLinkBudgets, cachedRxBytes);
+
+  CheckEqualRuns (calculatedLinkBudgets, cachedLinkBudgets, calculatedRxBytes, cachedRxBytes);
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the packet metadata filled by the
+ * transmitters does not change the results.
+ *
+ *  This case runs the scenario with the packet metadata disabled and
+ *  enabled. Without the metadata, the channel and the receivers peek the
+ *  addresses from the MAC tags of the packets.
+ *
+ *  Expected result:
+ *    The link budgets of all the received bursts, and the bytes received by
+ *    the users, are the same in both runs.
+ */
+class SatChannelPacketMetadataTestCase : public SatChannelTestCaseBase
+{
+public:
+  SatChannelPacketMetadataTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatChannelPacketMetadataTestCase::SatChannelPacketMetadataTestCase ()
+  : SatChannelTestCaseBase ("Test that the packet metadata gives the same link budgets as the MAC tags")
+{
+}
+
+void
+SatChannelPacketMetadataTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-channel", "packet-metadata", true);
+
+  std::vector<LinkBudget_t> tagLinkBudgets;
+  std::vector<uint64_t> tagRxBytes;
+  Config::SetDefault ("ns3::SatPhy::EnablePacketMetadata", BooleanValue (false));
+  RunScenario (tagLinkBudgets, tagRxBytes);
+
+  std::vector<LinkBudget_t> metadataLinkBudgets;
+  std::vector<uint64_t> metadataRxBytes;
+  Config::SetDefault ("ns3::SatPhy::EnablePacketMetadata", BooleanValue (true));
+  RunScenario (metadataLinkBudgets, metadataRxBytes);
+
+  CheckEqualRuns (tagLinkBudgets, metadataLinkBudgets, tagRxBytes, metadataRxBytes);
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check the receptions pruned by the interference
+ * cutoff.
+ *
+ *  This case runs the scenario without the interference cutoff, with a
+ *  cutoff below the gains of all the links and with a cutoff above the
+ *  gains of all the links.
+ *
+ *  Expected result:
+ *    With the low cutoff nothing is pruned, and the link budgets of all the
+ *    received bursts, and the bytes received by the users, are the same as
+ *    without the cutoff. With the high cutoff the cross-beam receptions are
+ *    pruned, while the same bursts are received at the same times by the
+ *    same receivers, with at most the interference without the cutoff.
+ */
+class SatChannelInterferenceCutoffTestCase : public SatChannelTestCaseBase
+{
+public:
+  SatChannelInterferenceCutoffTestCase ();
+
+private:
+  virtual void DoRun (void);
+  virtual void ScenarioFinished (void);
+
+  /**
+   * Receptions pruned by the SatChannels of the last run
+   */
+  uint64_t m_prunedRx;
+};
+
+SatChannelInterferenceCutoffTestCase::SatChannelInterferenceCutoffTestCase ()
+  : SatChannelTestCaseBase ("Test that the interference cutoff prunes only the receptions below the cutoff"),
+  m_prunedRx (0)
+{
+}
+
+void
+SatChannelInterferenceCutoffTestCase::ScenarioFinished (void)
+{
+  m_prunedRx = 0;
+
+  for (uint32_t i = 0; i < ChannelList::GetNChannels (); i++)
+    {
+      Ptr<SatChannel> channel = DynamicCast<SatChannel> (ChannelList::GetChannel (i));
+
+      if (channel != NULL)
+        {
+          UintegerValue prunedRx;
+          channel->GetAttribute ("PrunedRxCount", prunedRx);
+          m_prunedRx += prunedRx.Get ();
+        }
+    }
+}
+
+void
+SatChannelInterferenceCutoffTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-channel", "interference-cutoff", true);
+
+  std::vector<LinkBudget_t> fullLinkBudgets;
+  std::vector<uint64_t> fullRxBytes;
+  Config::SetDefault ("ns3::SatChannel::EnableInterferenceCutoff", BooleanValue (false));
+  RunScenario (fullLinkBudgets, fullRxBytes);
+
+  NS_TEST_ASSERT_MSG_EQ (m_prunedRx, 0, "Receptions pruned without the cutoff");
+
+  std::vector<LinkBudget_t> lowCutoffLinkBudgets;
+  std::vector<uint64_t> lowCutoffRxBytes;
+  Config::SetDefault ("ns3::SatChannel::EnableInterferenceCutoff", BooleanValue (true));
+  Config::SetDefault ("ns3::SatChannel::InterferenceCutoffDb", DoubleValue (-300.0));
+  RunScenario (lowCutoffLinkBudgets, lowCutoffRxBytes);
+
+  NS_TEST_ASSERT_MSG_EQ (m_prunedRx, 0, "Receptions pruned with the low cutoff");
+  CheckEqualRuns (fullLinkBudgets, lowCutoffLinkBudgets, fullRxBytes, lowCutoffRxBytes);
+
+  std::vector<LinkBudget_t> highCutoffLinkBudgets;
+  std::vector<uint64_t> highCutoffRxBytes;
+  Config::SetDefault ("ns3::SatChannel::InterferenceCutoffDb", DoubleValue (300.0));
+  RunScenario (highCutoffLinkBudgets, highCutoffRxBytes);
+
+  NS_TEST_ASSERT_MSG_GT (m_prunedRx, 0, "No receptions pruned with the high cutoff");
+  NS_TEST_ASSERT_MSG_EQ (highCutoffRxBytes.size (), fullRxBytes.size (), "Different number of users");
+  for (uint32_t i = 0; i < fullRxBytes.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (highCutoffRxBytes[i], fullRxBytes[i], "Different bytes received by user " << i);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (highCutoffLinkBudgets.size (), fullLinkBudgets.size (), "Different number of received bursts");
+  for (uint32_t i = 0; i < fullLinkBudgets.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (highCutoffLinkBudgets[i].time, fullLinkBudgets[i].time, "Different reception time of burst " << i);
+      NS_TEST_ASSERT_MSG_EQ (highCutoffLinkBudgets[i].context, fullLinkBudgets[i].context, "Different receiving carrier of burst " << i);
+      NS_TEST_ASSERT_MSG_EQ (highCutoffLinkBudgets[i].receiver, fullLinkBudgets[i].receiver, "Different receiver of burst " << i);
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (highCutoffLinkBudgets[i].ifPower, fullLinkBudgets[i].ifPower * (1 + 1e-9),
+                                   "More interference with the cutoff in burst " << i);
+    }
+
+  Config::SetDefault ("ns3::SatChannel::EnableInterferenceCutoff", BooleanValue (false));
+  Config::SetDefault ("ns3::SatChannel::InterferenceCutoffDb", DoubleValue (0.0));
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the optional SatChannel optimizations
+ */
+class SatChannelTestSuite : public TestSuite
+{
+public:
+  SatChannelTestSuite ();
+};
+
+SatChannelTestSuite::SatChannelTestSuite ()
+  : TestSuite ("sat-channel-test", SYSTEM)
+{
+  AddTestCase (new SatChannelBatchedRxTestCase, TestCase::QUICK);
+  AddTestCase (new SatChannelInterferenceCutoffTestCase, TestCase::QUICK);
+  AddTestCase (new SatChannelLinkGainCacheTestCase, TestCase::QUICK);
+  AddTestCase (new SatChannelPacketMetadataTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatChannelTestSuite satChannelTestSuite;
@@ -60,6 +60,9 @@ public:
   // create C/N0 estimator.
   void CreateEstimator (SatCnoEstimator::EstimationMode_t mode, Time window);
 
+  // create C/N0 estimator with EWMA weight and percentile.
+  void CreateEstimatorWithParameters (SatCnoEstimator::EstimationMode_t mode, Time window, double ewmaWeight, double percentile);
+
 protected:
   virtual void DoRun (void) = 0;
   Ptr<SatCnoEstimator> m_estimator;
@@ -84,6 +87,15 @@ SatEstimatorBaseTestCase::CreateEstimator (SatCnoEstimator::EstimationMode_t mod
   m_estimator = Create<SatBasicCnoEstimator> (mode, window);
 }
 
+void
+SatEstimatorBaseTestCase::CreateEstimatorWithParameters (SatCnoEstimator::EstimationMode_t mode, Time window, double ewmaWeight, double percentile)
+{
+  Ptr<SatBasicCnoEstimator> estimator = Create<SatBasicCnoEstimator> (mode, window);
+  estimator->SetEwmaWeight (ewmaWeight);
+  estimator->SetPercentile (percentile);
+  m_estimator = estimator;
+}
+
 /**
  * \ingroup satellite
  * \brief Test case to unit test satellite C/N0 estimator with mode LAST.
@@ -323,6 +335,155 @@ SatBasicEstimatorAverageTestCase::DoRun (void)
 }
 
 
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test satellite C/N0 estimator with mode EWMA.
+ *
+ * This case tests that SatBasicCnoEstimator can be created in mode EWMA and
+ * C/N0 is estimated correctly in set window.
+ *  1.  Create SatBasicCnoEstimator object with EWMA mode.
+ *  2.  Set samples to estimator at different points of time (method AddSample).
+ *  3.  Get C/N0 estimation from estimator at some points of time (method GetCnoEstimation).
+ *
+ *  Expected result:
+ *   Returned C/N0 estimation must be the exponentially weighted moving average of the samples,
+ *   NAN samples are ignored.
+ *
+ *   C/N0 estimation must be NAN, if no samples are got during time window, and the
+ *   average must start again from the next sample.
+ *
+ *
+ */
+class SatBasicEstimatorEwmaTestCase : public SatEstimatorBaseTestCase
+{
+public:
+  SatBasicEstimatorEwmaTestCase () : SatEstimatorBaseTestCase ("Test satellite C per N0 basic estimator with mode EWMA.")
+  {
+  }
+  virtual ~SatBasicEstimatorEwmaTestCase ()
+  {
+  }
+
+protected:
+  virtual void DoRun (void);
+};
+
+void
+SatBasicEstimatorEwmaTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-cno-estimator-unit", "ewma", true);
+
+  // create estimator with window 200 ms and weight 0.25
+  Simulator::Schedule (Seconds (0.05), &SatBasicEstimatorEwmaTestCase::CreateEstimatorWithParameters, this, SatCnoEstimator::EWMA, Seconds (0.20), 0.25, 10.0 );
+
+  // simulate sample additions
+  Simulator::Schedule (Seconds (0.17), &SatBasicEstimatorEwmaTestCase::AddSample, this, -4.0 );
+  Simulator::Schedule (Seconds (0.22), &SatBasicEstimatorEwmaTestCase::AddSample, this, 8.0 );
+  Simulator::Schedule (Seconds (0.26), &SatBasicEstimatorEwmaTestCase::AddSample, this, NAN );
+  Simulator::Schedule (Seconds (0.50), &SatBasicEstimatorEwmaTestCase::AddSample, this, 2.4 );
+
+  // simulate C/N0 estimations with window 200 ms
+  Simulator::Schedule (Seconds (0.09), &SatBasicEstimatorEwmaTestCase::GetCnoEstimation, this ); // NAN expected
+  Simulator::Schedule (Seconds (0.19), &SatBasicEstimatorEwmaTestCase::GetCnoEstimation, this ); // -4.0 expected
+  Simulator::Schedule (Seconds (0.30), &SatBasicEstimatorEwmaTestCase::GetCnoEstimation, this ); // 0.25 * 8.0 - 0.75 * 4.0 expected
+  Simulator::Schedule (Seconds (0.45), &SatBasicEstimatorEwmaTestCase::GetCnoEstimation, this ); // NAN expected
+  Simulator::Schedule (Seconds (0.55), &SatBasicEstimatorEwmaTestCase::GetCnoEstimation, this ); // 2.4 expected
+
+  Simulator::Run ();
+
+  // After simulation check that estimations are as expected
+  NS_TEST_ASSERT_MSG_EQ ( std::isnan (m_cnoEstimations[0]), true, "first estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ_TOL ( m_cnoEstimations[1], -4.0, 0.0001, "second estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ_TOL ( m_cnoEstimations[2], 0.25 * 8.0 - 0.75 * 4.0, 0.0001, "third estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ ( std::isnan (m_cnoEstimations[3]), true, "fourth estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ_TOL ( m_cnoEstimations[4], 2.4, 0.0001, "fifth estimation incorrect");
+
+  Simulator::Destroy ();
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test satellite C/N0 estimator with mode PERCENTILE.
+ *
+ * This case tests that SatBasicCnoEstimator can be created in mode PERCENTILE and
+ * C/N0 is estimated correctly in set window.
+ *  1.  Create SatBasicCnoEstimator objects with PERCENTILE mode using different percentiles.
+ *  2.  Set samples to estimator at different points of time (method AddSample).
+ *  3.  Get C/N0 estimation from estimator at some points of time (method GetCnoEstimation).
+ *
+ *  Expected result:
+ *   Returned C/N0 estimation must be the nearest rank percentile of samples in window,
+ *   NAN samples are ignored.
+ *
+ *   C/N0 estimation must be NAN, if no samples are got during time window.
+ *
+ *
+ */
+class SatBasicEstimatorPercentileTestCase : public SatEstimatorBaseTestCase
+{
+public:
+  SatBasicEstimatorPercentileTestCase () : SatEstimatorBaseTestCase ("Test satellite C per N0 basic estimator with mode PERCENTILE.")
+  {
+  }
+  virtual ~SatBasicEstimatorPercentileTestCase ()
+  {
+  }
+
+protected:
+  virtual void DoRun (void);
+};
+
+void
+SatBasicEstimatorPercentileTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-cno-estimator-unit", "percentile", true);
+
+  double samples[] = { 5.0, -3.0, 7.0, 1.0, NAN, 9.0 };
+
+  // create estimator for 10th percentile with window 200 ms
+  Simulator::Schedule (Seconds (0.05), &SatBasicEstimatorPercentileTestCase::CreateEstimatorWithParameters, this, SatCnoEstimator::PERCENTILE, Seconds (0.20), 0.1, 10.0 );
+
+  for (uint32_t i = 0; i < 6; i++)
+    {
+      Simulator::Schedule (Seconds (0.11 + i * 0.01), &SatBasicEstimatorPercentileTestCase::AddSample, this, samples[i] );
+    }
+
+  // simulate C/N0 estimations with window 200 ms
+  Simulator::Schedule (Seconds (0.09), &SatBasicEstimatorPercentileTestCase::GetCnoEstimation, this ); // NAN expected
+  Simulator::Schedule (Seconds (0.17), &SatBasicEstimatorPercentileTestCase::GetCnoEstimation, this ); // -3.0 expected
+  Simulator::Schedule (Seconds (0.335), &SatBasicEstimatorPercentileTestCase::GetCnoEstimation, this ); // 1.0 expected
+  Simulator::Schedule (Seconds (0.5), &SatBasicEstimatorPercentileTestCase::GetCnoEstimation, this ); // NAN expected
+
+  // create estimator for 50th percentile with window 200 ms
+  Simulator::Schedule (Seconds (1.05), &SatBasicEstimatorPercentileTestCase::CreateEstimatorWithParameters, this, SatCnoEstimator::PERCENTILE, Seconds (0.20), 0.1, 50.0 );
+
+  for (uint32_t i = 0; i < 6; i++)
+    {
+      Simulator::Schedule (Seconds (1.11 + i * 0.01), &SatBasicEstimatorPercentileTestCase::AddSample, this, samples[i] );
+    }
+
+  Simulator::Schedule (Seconds (1.17), &SatBasicEstimatorPercentileTestCase::GetCnoEstimation, this ); // 5.0 expected
+
+  Simulator::Run ();
+
+  // After simulation check that estimations are as expected
+  NS_TEST_ASSERT_MSG_EQ ( std::isnan (m_cnoEstimations[0]), true, "first estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ ( m_cnoEstimations[1], -3.0, "second estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ ( m_cnoEstimations[2], 1.0, "third estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ ( std::isnan (m_cnoEstimations[3]), true, "fourth estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ ( m_cnoEstimations[4], 5.0, "fifth estimation incorrect");
+
+  Simulator::Destroy ();
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
 /**
  * \ingroup satellite
  * \brief Test suite for Satellite C/N0 estimator unit test cases.
@@ -339,6 +500,8 @@ SatBasicCnoEstimatorTestSuite::SatBasicCnoEstimatorTestSuite ()
   AddTestCase (new SatBasicEstimatorLastTestCase, TestCase::QUICK);
   AddTestCase (new SatBasicEstimatorMinTestCase, TestCase::QUICK);
   AddTestCase (new SatBasicEstimatorAverageTestCase, TestCase::QUICK);
+  AddTestCase (new SatBasicEstimatorEwmaTestCase, TestCase::QUICK);
+  AddTestCase (new SatBasicEstimatorPercentileTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
@@ -0,0 +1,163 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup satellite
+ * \file satellite-encap-index-test.cc
+ * \brief Encapsulator index test suite
+ */
+
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/ptr.h"
+#include "ns3/object.h"
+#include "ns3/mac48-address.h"
+#include "../model/satellite-encap-index.h"
+#include "../model/satellite-base-encapsulator.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the encapsulator index finds the same
+ * encapsulators as the ordered EncapContainer map, also after removals
+ * and growing of the hash table.
+ */
+class SatEncapIndexTestCase : public TestCase
+{
+public:
+  SatEncapIndexTestCase ();
+  virtual ~SatEncapIndexTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatEncapIndexTestCase::SatEncapIndexTestCase ()
+  : TestCase ("Test encapsulator hash index against the encapsulator map.")
+{
+}
+
+SatEncapIndexTestCase::~SatEncapIndexTestCase ()
+{
+}
+
+void
+SatEncapIndexTestCase::DoRun (void)
+{
+  typedef std::map<Ptr<EncapKey>, Ptr<SatBaseEncapsulator>, EncapKeyCompare > EncapContainer_t;
+
+  SatEncapIndex index;
+  EncapContainer_t encaps;
+
+  Mac48Address gw = Mac48Address::Allocate ();
+  std::vector<Mac48Address> uts;
+
+  for (uint32_t i = 0; i < 100; ++i)
+    {
+      uts.push_back (Mac48Address::Allocate ());
+    }
+
+  // Forward link: GW -> UT, flow ids 0..3 and 255
+  for (uint32_t i = 0; i < uts.size (); ++i)
+    {
+      uint8_t flowIds[5] = { 0, 1, 2, 3, 255 };
+      for (uint32_t f = 0; f < 5; ++f)
+        {
+          Ptr<EncapKey> key = Create<EncapKey> (gw, uts[i], flowIds[f]);
+          Ptr<SatBaseEncapsulator> encap = CreateObject<SatBaseEncapsulator> (gw, uts[i], flowIds[f]);
+          encaps.insert (std::make_pair (key, encap));
+          NS_TEST_ASSERT_MSG_EQ (index.Insert (key, encap), true, "Insert failed");
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (index.GetSize (), encaps.size (), "Wrong index size");
+  NS_TEST_ASSERT_MSG_EQ (index.Insert (Create<EncapKey> (gw, uts[0], 1), 0), false, "Duplicate key accepted");
+
+  // Remove every third encapsulator
+  uint32_t n = 0;
+  EncapContainer_t::iterator it = encaps.begin ();
+  while (it != encaps.end ())
+    {
+      if (n++ % 3 == 0)
+        {
+          NS_TEST_ASSERT_MSG_EQ (index.Erase (it->first->m_source, it->first->m_destination, it->first->m_flowId),
+                                 true, "Erase failed");
+          encaps.erase (it++);
+        }
+      else
+        {
+          ++it;
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (index.GetSize (), encaps.size (), "Wrong index size after erase");
+
+  for (uint32_t i = 0; i < uts.size (); ++i)
+    {
+      uint32_t found = 0;
+      for (uint32_t flowId = 0; flowId < 256; ++flowId)
+        {
+          Ptr<EncapKey> key = Create<EncapKey> (gw, uts[i], flowId);
+          EncapContainer_t::iterator mit = encaps.find (key);
+          Ptr<SatBaseEncapsulator> encap = index.Find (gw, uts[i], flowId);
+
+          if (mit == encaps.end ())
+            {
+              NS_TEST_ASSERT_MSG_EQ ((encap == 0), true, "Index found a removed encapsulator");
+            }
+          else
+            {
+              NS_TEST_ASSERT_MSG_EQ ((encap == mit->second), true, "Index found a wrong encapsulator");
+              NS_TEST_ASSERT_MSG_EQ ((index.FindKey (gw, uts[i], flowId) == mit->first), true, "Index found a wrong key");
+              found++;
+            }
+        }
+
+      NS_TEST_ASSERT_MSG_EQ (index.GetByDestination (uts[i]).size (), found, "Wrong per destination list");
+      NS_TEST_ASSERT_MSG_EQ (index.GetBySource (uts[i]).size (), 0, "Wrong per source list");
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (index.GetBySource (gw).size (), encaps.size (), "Wrong per source list");
+
+  for (it = encaps.begin (); it != encaps.end (); ++it)
+    {
+      it->second->Dispose ();
+    }
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the encapsulator index.
+ */
+class SatEncapIndexTestSuite : public TestSuite
+{
+public:
+  SatEncapIndexTestSuite ();
+};
+
+SatEncapIndexTestSuite::SatEncapIndexTestSuite ()
+  : TestSuite ("sat-encap-index-test", UNIT)
+{
+  AddTestCase (new SatEncapIndexTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatEncapIndexTestSuite satEncapIndexTestSuite;
@@ -0,0 +1,185 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup satellite
+ * \file satellite-fading-oscillator-test.cc
+ * \brief Fading oscillator bank test suite
+ */
+
+#include <cmath>
+#include <complex>
+#include <string>
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
+#include "../model/satellite-fading-oscillator.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the oscillator bank gives the same sums as
+ * the corresponding SatFadingOscillator objects summed in the order they
+ * were added, as done by SatLooModel before the bank.
+ *
+ *  Test steps:
+ *    1.  Draw the amplitudes, initial phases and rotation speeds of the
+ *        direct signal and multipath oscillators like SatLooModel.
+ *    2.  Add them both to the banks and to vectors of SatFadingOscillator.
+ *    3.  Evaluate the sums at several times, one time and many times per call.
+ *
+ *  Expected result:
+ *    The sums of the banks equal the sums of the oscillators. The tolerance
+ *    allows only the rounding of multiply-adds contracted by the compiler.
+ */
+class SatFadingOscillatorBankTestCase : public TestCase
+{
+public:
+  SatFadingOscillatorBankTestCase ();
+  virtual ~SatFadingOscillatorBankTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Check that two complex values are equal within the tolerance
+   * relative to the magnitude of the sum of the absolute values of the terms
+   * \param actual actual value
+   * \param expected expected value
+   * \param scale sum of the absolute values of the terms
+   * \param msg message to show on failure
+   */
+  void CheckEqual (std::complex<double> actual, std::complex<double> expected, double scale, std::string msg);
+};
+
+SatFadingOscillatorBankTestCase::SatFadingOscillatorBankTestCase ()
+  : TestCase ("Test that the fading oscillator bank sums equal the oscillator sums")
+{
+}
+
+SatFadingOscillatorBankTestCase::~SatFadingOscillatorBankTestCase ()
+{
+}
+
+void
+SatFadingOscillatorBankTestCase::CheckEqual (std::complex<double> actual, std::complex<double> expected, double scale, std::string msg)
+{
+  double tolerance = 1e-12 * scale;
+
+  NS_TEST_EXPECT_MSG_EQ_TOL (actual.real (), expected.real (), tolerance, msg << ", real part");
+  NS_TEST_EXPECT_MSG_EQ_TOL (actual.imag (), expected.imag (), tolerance, msg << ", imaginary part");
+}
+
+void
+SatFadingOscillatorBankTestCase::DoRun (void)
+{
+  const uint32_t oscillatorCount = 40;
+  const double maxDopplerFrequency = 10.0;
+
+  Ptr<UniformRandomVariable> uniform = CreateObject<UniformRandomVariable> ();
+  uniform->SetStream (1);
+
+  SatFadingOscillatorBank directBank;
+  SatFadingOscillatorBank multipathBank;
+  std::vector<Ptr<SatFadingOscillator> > directOscillators;
+  std::vector<Ptr<SatFadingOscillator> > multipathOscillators;
+
+  double directScale = 0.0;
+  double multipathScale = 0.0;
+
+  for (uint32_t i = 0; i < oscillatorCount; i++)
+    {
+      double phi = 2.0 * M_PI * uniform->GetValue ();
+      double omega = 2.0 * M_PI * maxDopplerFrequency * std::cos (2.0 * M_PI * uniform->GetValue ());
+
+      double amplitude = uniform->GetValue (0.1, 2.0);
+      directBank.AddOscillator (amplitude, phi, omega);
+      directOscillators.push_back (CreateObject<SatFadingOscillator> (amplitude, phi, omega));
+
+      // exp of a unit complex number has magnitude of at most e
+      directScale += amplitude * M_E;
+
+      double psi = 2.0 * M_PI * uniform->GetValue ();
+      std::complex<double> complexAmplitude = std::complex<double> (std::cos (psi), std::sin (psi)) * 2.0 / std::sqrt (oscillatorCount);
+      multipathBank.AddOscillator (complexAmplitude, phi, omega);
+      multipathOscillators.push_back (CreateObject<SatFadingOscillator> (complexAmplitude, phi, omega));
+
+      multipathScale += std::abs (complexAmplitude);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (directBank.GetSize (), oscillatorCount, "Wrong number of direct signal oscillators");
+  NS_TEST_ASSERT_MSG_EQ (multipathBank.GetSize (), oscillatorCount, "Wrong number of multipath oscillators");
+
+  std::vector<double> times;
+  for (uint32_t i = 0; i < 100; i++)
+    {
+      times.push_back (i * 0.0137);
+    }
+  times.push_back (12345.678);
+
+  std::vector<std::complex<double> > directSums (times.size ());
+  std::vector<std::complex<double> > multipathSums (times.size ());
+  directBank.GetCosineWaveSumsAt (times.data (), times.size (), directSums.data ());
+  multipathBank.GetComplexSumsAt (times.data (), times.size (), multipathSums.data ());
+
+  for (uint32_t t = 0; t < times.size (); t++)
+    {
+      std::complex<double> expectedDirect (0, 0);
+      std::complex<double> expectedMultipath (0, 0);
+
+      for (uint32_t i = 0; i < oscillatorCount; i++)
+        {
+          expectedDirect += directOscillators[i]->GetCosineWaveValueAt (times[t]);
+          expectedMultipath += multipathOscillators[i]->GetComplexValueAt (times[t]);
+        }
+
+      CheckEqual (directBank.GetCosineWaveSumAt (times[t]), expectedDirect, directScale, "Wrong direct signal sum at time index " + std::to_string (t));
+      CheckEqual (multipathBank.GetComplexSumAt (times[t]), expectedMultipath, multipathScale, "Wrong multipath sum at time index " + std::to_string (t));
+
+      // several times per call give the same values as one time per call
+      NS_TEST_EXPECT_MSG_EQ (directSums[t], directBank.GetCosineWaveSumAt (times[t]), "Different direct signal sums at time index " << t);
+      NS_TEST_EXPECT_MSG_EQ (multipathSums[t], multipathBank.GetComplexSumAt (times[t]), "Different multipath sums at time index " << t);
+    }
+
+  directBank.Clear ();
+  NS_TEST_ASSERT_MSG_EQ (directBank.GetSize (), 0, "Oscillators left in cleared bank");
+  NS_TEST_ASSERT_MSG_EQ (directBank.GetCosineWaveSumAt (1.0), std::complex<double> (0, 0), "Non-zero sum of empty bank");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the fading oscillator bank
+ */
+class SatFadingOscillatorTestSuite : public TestSuite
+{
+public:
+  SatFadingOscillatorTestSuite ();
+};
+
+SatFadingOscillatorTestSuite::SatFadingOscillatorTestSuite ()
+  : TestSuite ("sat-fading-oscillator-test", UNIT)
+{
+  AddTestCase (new SatFadingOscillatorBankTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatFadingOscillatorTestSuite satFadingOscillatorTestSuite;
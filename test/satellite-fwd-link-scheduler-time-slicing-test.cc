@@ -0,0 +1,249 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup satellite
+ * \file satellite-fwd-link-scheduler-time-slicing-test.cc
+ * \brief Time slicing forward link scheduler test suite
+ */
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/ptr.h"
+#include "ns3/packet.h"
+#include "ns3/config.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/mac48-address.h"
+#include "../model/satellite-bbframe.h"
+#include "../model/satellite-bbframe-conf.h"
+#include "../model/satellite-bbframe-container.h"
+#include "../model/satellite-fwd-link-scheduler-time-slicing.h"
+#include "ns3/singleton.h"
+#include "ns3/satellite-env-variables.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Time slicing scheduler giving the test access to the slice
+ * operations and to the cached durations.
+ */
+class SatFwdLinkSchedulerTimeSlicingTestScheduler : public SatFwdLinkSchedulerTimeSlicing
+{
+public:
+  /**
+   * Constructor
+   * \param conf BB Frame configuration
+   * \param address MAC address
+   * \param carrierBandwidthInHz Carrier bandwidth [Hz]
+   */
+  SatFwdLinkSchedulerTimeSlicingTestScheduler (Ptr<SatBbFrameConf> conf, Mac48Address address, double carrierBandwidthInHz)
+    : SatFwdLinkSchedulerTimeSlicing (conf, address, carrierBandwidthInHz)
+  {
+  }
+
+  using SatFwdLinkSchedulerTimeSlicing::AddData;
+  using SatFwdLinkSchedulerTimeSlicing::DequeueFrame;
+  using SatFwdLinkSchedulerTimeSlicing::MergeBbFrames;
+  using SatFwdLinkSchedulerTimeSlicing::GetTotalDuration;
+
+  /**
+   * \return the number of slices, including the control slice 0
+   */
+  uint32_t GetNSlices () const
+  {
+    return m_bbFrameContainers.size ();
+  }
+
+  /**
+   * \param sliceId The slice
+   * \return the BB frame container of the slice
+   */
+  Ptr<SatBbFrameContainer> GetContainer (uint8_t sliceId) const
+  {
+    return m_bbFrameContainers.at (sliceId);
+  }
+
+  /**
+   * \return the cached durations of the slices other than the control slice
+   */
+  std::multiset<Time> GetSliceDurations () const
+  {
+    return m_sliceDurations;
+  }
+};
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the duration counters of the time slicing
+ * scheduler follow the frames of the slices.
+ *
+ *  Test steps:
+ *    1.  Create a time slicing scheduler with four slices.
+ *    2.  Add full and partial frames of several MODCODs to the slices and
+ *        control data to the control slice.
+ *    3.  Merge the frames of every slice.
+ *    4.  Dequeue the frames of every slice until the slices are empty.
+ *
+ *  Expected result:
+ *    After every step, the cached total duration equals the sum of the total
+ *    durations of the slices, and the cached slice durations equal the total
+ *    durations of the slices other than the control slice.
+ */
+class SatFwdLinkSchedulerTimeSlicingDurationTestCase : public TestCase
+{
+public:
+  SatFwdLinkSchedulerTimeSlicingDurationTestCase ();
+  virtual ~SatFwdLinkSchedulerTimeSlicingDurationTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Check the cached durations against the durations of the slices
+   * \param scheduler the scheduler
+   * \param step name of the step checked
+   */
+  void CheckDurations (Ptr<SatFwdLinkSchedulerTimeSlicingTestScheduler> scheduler, std::string step);
+};
+
+SatFwdLinkSchedulerTimeSlicingDurationTestCase::SatFwdLinkSchedulerTimeSlicingDurationTestCase ()
+  : TestCase ("Test that the time slicing scheduler durations equal the durations of the slices")
+{
+}
+
+SatFwdLinkSchedulerTimeSlicingDurationTestCase::~SatFwdLinkSchedulerTimeSlicingDurationTestCase ()
+{
+}
+
+void
+SatFwdLinkSchedulerTimeSlicingDurationTestCase::CheckDurations (Ptr<SatFwdLinkSchedulerTimeSlicingTestScheduler> scheduler, std::string step)
+{
+  Time total = Seconds (0);
+  std::multiset<Time> sliceDurations;
+
+  for (uint32_t sliceId = 0; sliceId < scheduler->GetNSlices (); ++sliceId)
+    {
+      Time duration = scheduler->GetContainer (sliceId)->GetTotalDuration ();
+      total += duration;
+
+      if (sliceId > 0)
+        {
+          sliceDurations.insert (duration);
+        }
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (scheduler->GetTotalDuration (), total, "Wrong total duration after " << step);
+  NS_TEST_EXPECT_MSG_EQ ((scheduler->GetSliceDurations () == sliceDurations), true, "Wrong slice durations after " << step);
+}
+
+void
+SatFwdLinkSchedulerTimeSlicingDurationTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-fwd-link-scheduler-time-slicing", "duration", true);
+
+  const uint8_t nSlices = 4;
+  const double carrierBandwidthInHz = 93750000;
+
+  Config::SetDefault ("ns3::SatFwdLinkSchedulerTimeSlicing::NumberOfSlices", UintegerValue (nSlices));
+
+  Ptr<SatBbFrameConf> conf = CreateObject<SatBbFrameConf> (carrierBandwidthInHz, SatEnums::DVB_S2);
+  Ptr<SatFwdLinkSchedulerTimeSlicingTestScheduler> scheduler =
+    CreateObject<SatFwdLinkSchedulerTimeSlicingTestScheduler> (conf, Mac48Address::Allocate (), carrierBandwidthInHz);
+
+  NS_TEST_ASSERT_MSG_EQ (scheduler->GetNSlices (), nSlices + 1u, "Wrong number of slices");
+  CheckDurations (scheduler, "creation");
+
+  std::vector<SatEnums::SatModcod_t> modcods = conf->GetModCodsUsed ();
+  std::sort (modcods.begin (), modcods.end ());
+
+  // Different amounts of data on every slice, with partially filled frames
+  // to merge, and control data on the control slice
+  for (uint8_t sliceId = 1; sliceId <= nSlices; ++sliceId)
+    {
+      for (uint32_t m = 0; m < 3; ++m)
+        {
+          SatEnums::SatModcod_t modcod = modcods[(m * (modcods.size () - 1)) / 2];
+          uint32_t payload = scheduler->GetContainer (sliceId)->GetMaxFramePayloadInBytes (1, modcod) - conf->GetBbFrameHeaderSizeInBytes ();
+          uint32_t packets = sliceId + m;
+
+          for (uint32_t i = 0; i < packets; ++i)
+            {
+              scheduler->AddData (sliceId, 1, modcod, Create<Packet> (payload / (m + 2)));
+              CheckDurations (scheduler, "adding data to slice " + std::to_string (sliceId));
+            }
+        }
+    }
+
+  scheduler->AddData (0, 0, conf->GetDefaultModCod (), Create<Packet> (100));
+  CheckDurations (scheduler, "adding control data");
+
+  NS_TEST_ASSERT_MSG_GT (scheduler->GetTotalDuration (), Seconds (0), "No frames added");
+
+  for (uint8_t sliceId = 0; sliceId <= nSlices; ++sliceId)
+    {
+      scheduler->MergeBbFrames (sliceId);
+      CheckDurations (scheduler, "merging slice " + std::to_string (sliceId));
+    }
+
+  uint32_t frames = 0;
+
+  for (uint8_t sliceId = 0; sliceId <= nSlices; ++sliceId)
+    {
+      for (Ptr<SatBbFrame> frame = scheduler->DequeueFrame (sliceId); frame != 0; frame = scheduler->DequeueFrame (sliceId))
+        {
+          ++frames;
+          CheckDurations (scheduler, "dequeuing a frame of slice " + std::to_string (sliceId));
+        }
+    }
+
+  NS_TEST_EXPECT_MSG_GT (frames, nSlices + 1u, "Too few frames dequeued");
+  NS_TEST_EXPECT_MSG_EQ (scheduler->GetTotalDuration (), Seconds (0), "Duration left in the empty slices");
+
+  scheduler->Dispose ();
+  Simulator::Destroy ();
+
+  Config::SetDefault ("ns3::SatFwdLinkSchedulerTimeSlicing::NumberOfSlices", UintegerValue (1));
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the time slicing forward link scheduler
+ */
+class SatFwdLinkSchedulerTimeSlicingTestSuite : public TestSuite
+{
+public:
+  SatFwdLinkSchedulerTimeSlicingTestSuite ();
+};
+
+SatFwdLinkSchedulerTimeSlicingTestSuite::SatFwdLinkSchedulerTimeSlicingTestSuite ()
+  : TestSuite ("sat-fwd-link-scheduler-time-slicing-test", UNIT)
+{
+  AddTestCase (new SatFwdLinkSchedulerTimeSlicingDurationTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatFwdLinkSchedulerTimeSlicingTestSuite satFwdLinkSchedulerTimeSlicingTestSuite;
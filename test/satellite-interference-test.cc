@@ -38,6 +38,9 @@
 #include "../model/satellite-constant-interference.h"
 #include "../model/satellite-traced-interference.h"
 #include "../model/satellite-per-packet-interference.h"
+#include "../model/satellite-per-fragment-interference.h"
+#include "../model/satellite-flat-interference.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/singleton.h"
 #include "../utils/satellite-env-variables.h"
 
@@ -249,6 +252,127 @@ SatPerPacketInterferenceTestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test satellite flat interference models.
+ *
+ * This case tests that SatFlatPerPacketInterference and SatFlatPerFragmentInterference
+ * give the same results as SatPerPacketInterference and SatPerFragmentInterference.
+ *  1.  Create a reference model and a flat model.
+ *  2.  Add the same random bursts to both models, part of them being received.
+ *  3.  Calculate interference of the received bursts with both models.
+ *
+ *  Expected result:
+ *   Fragments and interference values are identical with both models.
+ *
+ */
+class SatFlatInterferenceTestCase : public TestCase
+{
+public:
+  SatFlatInterferenceTestCase (bool perFragment);
+  virtual ~SatFlatInterferenceTestCase ();
+
+  // adds burst to both model objects and schedules receiving if needed
+  void AddBurst (Time duration, double power, bool receive);
+
+  // receives burst i.e. calculates and compares interference and stops receiving.
+  void Receive (Ptr<SatInterference::InterferenceChangeEvent> refEvent, Ptr<SatInterference::InterferenceChangeEvent> flatEvent);
+
+private:
+  virtual void DoRun (void);
+  bool m_perFragment;
+  Ptr<SatInterference> m_refInterference;
+  Ptr<SatInterference> m_flatInterference;
+  uint32_t m_receivedCount;
+};
+
+SatFlatInterferenceTestCase::SatFlatInterferenceTestCase (bool perFragment)
+  : TestCase ("Test satellite flat interference model against the reference model."),
+  m_perFragment (perFragment),
+  m_receivedCount (0)
+{
+}
+
+SatFlatInterferenceTestCase::~SatFlatInterferenceTestCase ()
+{
+}
+
+void
+SatFlatInterferenceTestCase::AddBurst (Time duration, double power, bool receive)
+{
+  Address address = Mac48Address::ConvertFrom (Mac48Address::Allocate ());
+  Ptr<SatInterference::InterferenceChangeEvent> refEvent = m_refInterference->Add (duration, power, address);
+  Ptr<SatInterference::InterferenceChangeEvent> flatEvent = m_flatInterference->Add (duration, power, address);
+
+  if (receive)
+    {
+      m_refInterference->NotifyRxStart (refEvent);
+      m_flatInterference->NotifyRxStart (flatEvent);
+      Simulator::Schedule (duration, &SatFlatInterferenceTestCase::Receive, this, refEvent, flatEvent);
+    }
+}
+
+void
+SatFlatInterferenceTestCase::Receive (Ptr<SatInterference::InterferenceChangeEvent> refEvent, Ptr<SatInterference::InterferenceChangeEvent> flatEvent)
+{
+  std::vector< std::pair<double, double> > refPower = m_refInterference->Calculate (refEvent);
+  std::vector< std::pair<double, double> > flatPower = m_flatInterference->Calculate (flatEvent);
+
+  NS_TEST_ASSERT_MSG_EQ (refPower.size (), flatPower.size (), "Fragment count differs");
+
+  for (uint32_t i = 0; i < refPower.size () && i < flatPower.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (refPower[i].first, flatPower[i].first, "Fragment duration differs");
+      NS_TEST_ASSERT_MSG_EQ (refPower[i].second, flatPower[i].second, "Interference power differs");
+    }
+
+  m_refInterference->NotifyRxEnd (refEvent);
+  m_flatInterference->NotifyRxEnd (flatEvent);
+  m_receivedCount++;
+}
+
+void
+SatFlatInterferenceTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-if-unit", "flat", true);
+
+  if (m_perFragment)
+    {
+      m_refInterference = CreateObject<SatPerFragmentInterference> ();
+      m_flatInterference = CreateObject<SatFlatPerFragmentInterference> ();
+    }
+  else
+    {
+      m_refInterference = CreateObject<SatPerPacketInterference> ();
+      m_flatInterference = CreateObject<SatFlatPerPacketInterference> ();
+    }
+
+  Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable> ();
+  rng->SetStream (1);
+
+  // bursts start on a coarse grid so that simultaneous changes are tested too
+  uint32_t receivedCount = 0;
+  for (uint32_t i = 0; i < 500; i++)
+    {
+      Time start = MilliSeconds (rng->GetInteger (0, 1000));
+      Time duration = MilliSeconds (rng->GetInteger (0, 50));
+      double power = rng->GetValue (1e-13, 1e-10);
+      bool receive = (rng->GetValue () < 0.3) && (duration > Time (0));
+
+      receivedCount += receive ? 1 : 0;
+      Simulator::Schedule (start, &SatFlatInterferenceTestCase::AddBurst, this, duration, power, receive);
+    }
+
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_receivedCount, receivedCount, "All bursts were not received");
+
+  Simulator::Destroy ();
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
 /**
  * \ingroup satellite
  * \brief Test suite for Satellite interference unit test cases.
@@ -264,6 +388,8 @@ SatInterferenceTestSuite::SatInterferenceTestSuite ()
 {
   AddTestCase (new SatConstantInterferenceTestCase, TestCase::QUICK);
   AddTestCase (new SatPerPacketInterferenceTestCase, TestCase::QUICK);
+  AddTestCase (new SatFlatInterferenceTestCase (false), TestCase::QUICK);
+  AddTestCase (new SatFlatInterferenceTestCase (true), TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
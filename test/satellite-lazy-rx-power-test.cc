@@ -0,0 +1,345 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup satellite
+ * \file satellite-lazy-rx-power-test.cc
+ * \brief Test suite for the lazy forward user link Rx power calculation
+ */
+
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/config.h"
+#include "ns3/boolean.h"
+#include "ns3/enum.h"
+#include "ns3/nstime.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/singleton.h"
+#include "ns3/applications-module.h"
+#include "ns3/satellite-module.h"
+#include "ns3/traffic-module.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that deferring the forward user link Rx power
+ * calculation does not change the results, when the fading does not vary
+ * in time.
+ *
+ *  Pre-conditions:
+ *    Fading is off and channel estimation error is disabled, thus the Rx
+ *    power of a burst is the same whenever it is calculated.
+ *    Guard time of the forward link is zero, thus the consecutive BB frames
+ *    of a beam are back to back.
+ *
+ *  This case runs the same forward link scenario with the lazy Rx power
+ *  calculation disabled and enabled:
+ *    1.  Beam 5 is loaded continuously, thus its co-channel bursts are ongoing
+ *        and deferred at the UTs of beam 1 when they start receiving.
+ *    2.  Beam 1 has two UTs. UT 2 is loaded continuously and UT 1 receives
+ *        a packet every 10 ms, thus a BB frame for UT 1 often follows a frame
+ *        carrying only packets for UT 2. The deferred burst of the latter ends
+ *        at UT 1 exactly when the reception of the former starts.
+ *
+ *  Expected result:
+ *    The interference power and composite SINR of every burst received in
+ *    forward user link, and the bytes received by the UT users, are the same
+ *    in both runs. The scenario contains the above mentioned boundary case.
+ */
+class SatLazyRxPowerTestCase : public TestCase
+{
+public:
+  SatLazyRxPowerTestCase ();
+  virtual ~SatLazyRxPowerTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Link budget of a burst received in forward user link
+   */
+  typedef struct
+  {
+    Time time;
+    Mac48Address receiver;
+    double ifPower;
+    double cSinr;
+  } LinkBudget_t;
+
+  /**
+   * \brief Run the scenario
+   * \param lazy Enable the lazy Rx power calculation
+   * \param linkBudgets Link budgets of the bursts received in forward user link
+   * \param rxBytes Bytes received by the UT users
+   */
+  void RunScenario (bool lazy, std::vector<LinkBudget_t> &linkBudgets, std::vector<uint64_t> &rxBytes);
+
+  /**
+   * \brief Store the link budget of a burst received in forward user link
+   */
+  void LinkBudgetTraceCb (std::string context, Ptr<SatSignalParameters> params,
+                          Mac48Address ownAdd, Mac48Address destAdd,
+                          double ifPower, double cSinr);
+
+  /**
+   * \brief Count the BB frames for UT 1 sent right after a frame not for it
+   */
+  void BbFrameTxTraceCb (std::string context, Ptr<SatBbFrame> bbFrame);
+
+  /**
+   * \brief Check whether a BB frame is received by UT 1
+   * \param bbFrame BB frame
+   * \return true if the frame has a packet for UT 1, or a broadcast or multicast packet
+   */
+  bool IsReceivedByUt1 (Ptr<SatBbFrame> bbFrame) const;
+
+  std::vector<LinkBudget_t> *m_linkBudgets;
+  Mac48Address m_ut1Address;
+  std::map<std::string, std::pair<Time, bool> > m_lastBbFrameEnds;
+  uint32_t m_boundaryCount;
+};
+
+SatLazyRxPowerTestCase::SatLazyRxPowerTestCase ()
+  : TestCase ("Test that the lazy Rx power calculation gives the same link budgets as the eager calculation"),
+  m_linkBudgets (NULL),
+  m_ut1Address (),
+  m_lastBbFrameEnds (),
+  m_boundaryCount (0)
+{
+}
+
+SatLazyRxPowerTestCase::~SatLazyRxPowerTestCase ()
+{
+}
+
+void
+SatLazyRxPowerTestCase::LinkBudgetTraceCb (std::string context, Ptr<SatSignalParameters> params,
+                                           Mac48Address ownAdd, Mac48Address destAdd,
+                                           double ifPower, double cSinr)
+{
+  if (params->m_channelType == SatEnums::FORWARD_USER_CH)
+    {
+      LinkBudget_t linkBudget = { Simulator::Now (), ownAdd, ifPower, cSinr };
+      m_linkBudgets->push_back (linkBudget);
+    }
+}
+
+bool
+SatLazyRxPowerTestCase::IsReceivedByUt1 (Ptr<SatBbFrame> bbFrame) const
+{
+  const SatBbFrame::SatBbFramePayload_t &payload = bbFrame->GetPayload ();
+
+  for (SatBbFrame::SatBbFramePayload_t::const_iterator it = payload.begin (); it != payload.end (); ++it)
+    {
+      SatMacTag macTag;
+      if ((*it)->PeekPacketTag (macTag))
+        {
+          Mac48Address dest = macTag.GetDestAddress ();
+          if (dest == m_ut1Address || dest.IsBroadcast () || dest.IsGroup ())
+            {
+              return true;
+            }
+        }
+    }
+  return false;
+}
+
+void
+SatLazyRxPowerTestCase::BbFrameTxTraceCb (std::string context, Ptr<SatBbFrame> bbFrame)
+{
+  if (bbFrame == NULL)
+    {
+      return;
+    }
+
+  Time now = Simulator::Now ();
+  bool receivedByUt1 = IsReceivedByUt1 (bbFrame);
+
+  // The frames of a GW go through the same path to UT 1, thus the ends and
+  // starts of the back to back frames coincide also at UT 1
+  std::map<std::string, std::pair<Time, bool> >::iterator last = m_lastBbFrameEnds.find (context);
+  if (last != m_lastBbFrameEnds.end () && last->second.first == now && !last->second.second && receivedByUt1)
+    {
+      m_boundaryCount++;
+    }
+
+  m_lastBbFrameEnds[context] = std::make_pair (now + bbFrame->GetDuration (), receivedByUt1);
+}
+
+void
+SatLazyRxPowerTestCase::RunScenario (bool lazy, std::vector<LinkBudget_t> &linkBudgets, std::vector<uint64_t> &rxBytes)
+{
+  Singleton<SatIdMapper>::Get ()->Reset ();
+
+  Config::SetDefault ("ns3::SatChannel::EnableLazyRxPowerCalculation", BooleanValue (lazy));
+  Config::SetDefault ("ns3::SatBeamHelper::FadingModel", EnumValue (SatEnums::FADING_OFF));
+  Config::SetDefault ("ns3::SatUtHelper::EnableChannelEstimationError", BooleanValue (false));
+  Config::SetDefault ("ns3::SatGwHelper::EnableChannelEstimationError", BooleanValue (false));
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (SatPhyRxCarrierConf::EM_NONE));
+  Config::SetDefault ("ns3::SatUtHelper::DaFwdLinkInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_PER_PACKET));
+  Config::SetDefault ("ns3::SatGeoHelper::DaFwdLinkInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_PER_PACKET));
+  Config::SetDefault ("ns3::SatFwdLinkScheduler::DummyFrameSendingEnabled", BooleanValue (false));
+  Config::SetDefault ("ns3::SatGwMac::GuardTime", TimeValue (Seconds (0)));
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> ();
+
+  // beams 1 and 5 are co-channel beams in the user link
+  std::map<uint32_t, SatBeamUserInfo > beamMap;
+  beamMap[1] = SatBeamUserInfo (2, 1);
+  beamMap[5] = SatBeamUserInfo (1, 1);
+
+  helper->CreateUserDefinedScenario (beamMap);
+
+  Ptr<Node> ut1 = helper->UtNodes ().Get (0);
+  for (uint32_t i = 0; i < ut1->GetNDevices (); i++)
+    {
+      Ptr<SatNetDevice> device = DynamicCast<SatNetDevice> (ut1->GetDevice (i));
+      if (device != NULL)
+        {
+          m_ut1Address = Mac48Address::ConvertFrom (device->GetAddress ());
+        }
+    }
+
+  m_linkBudgets = &linkBudgets;
+  m_lastBbFrameEnds.clear ();
+  m_boundaryCount = 0;
+
+  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+                   MakeCallback (&SatLazyRxPowerTestCase::LinkBudgetTraceCb, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/SatMac/BBFrameTxTrace",
+                   MakeCallback (&SatLazyRxPowerTestCase::BbFrameTxTraceCb, this));
+
+  NodeContainer utUsers = helper->GetUtUsers ();
+  NodeContainer gwUsers = helper->GetGwUsers ();
+  uint16_t port = 9;
+
+  PacketSinkHelper sinkHelper ("ns3::UdpSocketFactory", Address ());
+  ApplicationContainer utSinks;
+  for (uint32_t i = 0; i < utUsers.GetN (); i++)
+    {
+      sinkHelper.SetAttribute ("Local", AddressValue (Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (i)), port))));
+      utSinks.Add (sinkHelper.Install (utUsers.Get (i)));
+    }
+  utSinks.Start (Seconds (0.1));
+  utSinks.Stop (Seconds (1.0));
+
+  // sparse traffic to UT 1 and continuous traffic to UT 2 in beam 1 and to the UT in beam 5
+  std::string intervals[] = { "0.01s", "0.0002s", "0.0002s" };
+
+  CbrHelper cbrHelper ("ns3::UdpSocketFactory", Address ());
+  cbrHelper.SetAttribute ("PacketSize", UintegerValue (512));
+
+  ApplicationContainer gwCbrs;
+  for (uint32_t i = 0; i < utUsers.GetN (); i++)
+    {
+      cbrHelper.SetAttribute ("Remote", AddressValue (Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (i)), port))));
+      cbrHelper.SetAttribute ("Interval", StringValue (intervals[i]));
+      gwCbrs.Add (cbrHelper.Install (gwUsers.Get (0)));
+    }
+  gwCbrs.Start (Seconds (0.2));
+  gwCbrs.Stop (Seconds (0.8));
+
+  Simulator::Stop (Seconds (1.0));
+  Simulator::Run ();
+
+  rxBytes.clear ();
+  for (uint32_t i = 0; i < utSinks.GetN (); i++)
+    {
+      rxBytes.push_back (DynamicCast<PacketSink> (utSinks.Get (i))->GetTotalRx ());
+    }
+
+  Simulator::Destroy ();
+  m_linkBudgets = NULL;
+}
+
+void
+SatLazyRxPowerTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-lazy-rx-power", "", true);
+
+  std::vector<LinkBudget_t> eagerLinkBudgets;
+  std::vector<uint64_t> eagerRxBytes;
+  RunScenario (false, eagerLinkBudgets, eagerRxBytes);
+
+  std::vector<LinkBudget_t> lazyLinkBudgets;
+  std::vector<uint64_t> lazyRxBytes;
+  RunScenario (true, lazyLinkBudgets, lazyRxBytes);
+
+  NS_TEST_ASSERT_MSG_GT (m_boundaryCount, 0, "No deferred burst ending at the start of a reception in scenario");
+
+  NS_TEST_ASSERT_MSG_EQ (lazyRxBytes.size (), eagerRxBytes.size (), "Different number of UT users");
+  for (uint32_t i = 0; i < eagerRxBytes.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_GT (eagerRxBytes[i], 0, "Nothing received by UT user " << i);
+      NS_TEST_ASSERT_MSG_EQ (lazyRxBytes[i], eagerRxBytes[i], "Different bytes received by UT user " << i);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (lazyLinkBudgets.size (), eagerLinkBudgets.size (), "Different number of received bursts");
+
+  bool interfered = false;
+
+  for (uint32_t i = 0; i < eagerLinkBudgets.size (); i++)
+    {
+      const LinkBudget_t &eager = eagerLinkBudgets[i];
+      const LinkBudget_t &lazy = lazyLinkBudgets[i];
+
+      NS_TEST_ASSERT_MSG_EQ (lazy.time, eager.time, "Different reception time of burst " << i);
+      NS_TEST_ASSERT_MSG_EQ (lazy.receiver, eager.receiver, "Different receiver of burst " << i);
+
+      // The interference powers are summed in different order in the modes,
+      // thus allow the rounding errors of the summation
+      NS_TEST_ASSERT_MSG_EQ_TOL (lazy.ifPower, eager.ifPower, 1e-9 * eager.ifPower,
+                                 "Different interference power of burst " << i);
+      NS_TEST_ASSERT_MSG_EQ_TOL (lazy.cSinr, eager.cSinr, 1e-9 * eager.cSinr,
+                                 "Different composite SINR of burst " << i);
+
+      interfered = interfered || eager.ifPower > 0.0;
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (interfered, true, "No interference in forward user link");
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the lazy forward user link Rx power calculation
+ */
+class SatLazyRxPowerTestSuite : public TestSuite
+{
+public:
+  SatLazyRxPowerTestSuite ();
+};
+
+SatLazyRxPowerTestSuite::SatLazyRxPowerTestSuite ()
+  : TestSuite ("sat-lazy-rx-power-test", SYSTEM)
+{
+  AddTestCase (new SatLazyRxPowerTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatLazyRxPowerTestSuite satLazyRxPowerTestSuite;
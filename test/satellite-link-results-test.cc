@@ -28,6 +28,11 @@
 #include <ns3/test.h>
 #include <ns3/satellite-link-results.h>
 #include <ns3/satellite-look-up-table.h>
+#include <ns3/satellite-link-results-bundle.h>
+#include <ns3/system-path.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <ns3/log.h>
 #include <ns3/ptr.h>
 
@@ -158,6 +163,114 @@ SatLinkResultsDvbS2TestCase::DoRun ()
 
 
 
+/*
+ * LINK RESULTS BUNDLE TEST CASE
+ */
+
+/**
+ * \brief Test case for comparing a look up table read from a link results
+ *        bundle with the same look up table read from a text file.
+ *
+ * The test writes a small text table and the corresponding bundle into a
+ * temporary directory, and removes the text table before loading the bundle
+ * so that the table can only come from the bundle. The test fails if the
+ * tables give different BLER or Es/No values, or if the same table is
+ * loaded twice.
+ */
+class SatLinkResultsBundleTestCase : public TestCase
+{
+public:
+  SatLinkResultsBundleTestCase ();
+private:
+  virtual void DoRun ();
+};
+
+
+SatLinkResultsBundleTestCase::SatLinkResultsBundleTestCase ()
+  : TestCase ("Comparing link results read from a bundle with link results read from a text file")
+{
+}
+
+
+void
+SatLinkResultsBundleTestCase::DoRun ()
+{
+  const uint32_t rows = 4;
+  const double esNoDb[rows] = { -1.0, 0.5, 1.25, 3.0 };
+  const double bler[rows] = { 1.0, 0.6, 0.05, 0.0 };
+
+  std::string directory = SystemPath::MakeTemporaryDirectoryName () + "/";
+  SystemPath::MakeDirectories (directory);
+
+  std::ofstream text ((directory + "table.txt").c_str ());
+  text.precision (17);
+  for (uint32_t i = 0; i < rows; ++i)
+    {
+      text << esNoDb[i] << " " << bler[i] << std::endl;
+    }
+  text.close ();
+
+  // directory entry and data of the single table
+  char entry[72];
+  std::memset (entry, 0, sizeof (entry));
+  std::strcpy (entry, "table.txt");
+  uint64_t offset = 24 + sizeof (entry);
+  std::memcpy (entry + 56, &rows, sizeof (uint32_t));
+  std::memcpy (entry + 64, &offset, sizeof (uint64_t));
+
+  std::string body (entry, sizeof (entry));
+  body.append (reinterpret_cast<const char*> (esNoDb), sizeof (esNoDb));
+  body.append (reinterpret_cast<const char*> (bler), sizeof (bler));
+
+  uint64_t checksum = 14695981039346656037ULL;
+  for (std::string::const_iterator it = body.begin (); it != body.end (); ++it)
+    {
+      checksum ^= static_cast<uint8_t> (*it);
+      checksum *= 1099511628211ULL;
+    }
+
+  uint32_t version = SatLinkResultsBundle::BUNDLE_VERSION;
+  uint32_t tableCount = 1;
+  std::ofstream bundle ((directory + "linkresults.bundle").c_str (), std::ios::binary);
+  bundle.write ("SNS3LRB", 8);
+  bundle.write (reinterpret_cast<const char*> (&version), sizeof (version));
+  bundle.write (reinterpret_cast<const char*> (&tableCount), sizeof (tableCount));
+  bundle.write (reinterpret_cast<const char*> (&checksum), sizeof (checksum));
+  bundle.write (body.data (), body.size ());
+  bundle.close ();
+
+  Ptr<SatLookUpTable> fromText = CreateObject<SatLookUpTable> (directory + "table.txt");
+
+  // Without the text table a rejected bundle cannot fall back to it
+  NS_TEST_ASSERT_MSG_EQ (std::remove ((directory + "table.txt").c_str ()), 0,
+                         "The text table could not be removed");
+
+  Ptr<SatLinkResultsBundle> bundled = CreateObject<SatLinkResultsBundle> ();
+  Ptr<SatLookUpTable> fromBundle = bundled->GetLookUpTable (directory + "table.txt");
+
+  NS_TEST_ASSERT_MSG_EQ (bundled->GetLookUpTable (directory + "table.txt"), fromBundle,
+                         "The same table was loaded twice");
+
+  for (double value = -2.0; value <= 4.0; value += 0.25)
+    {
+      NS_TEST_ASSERT_MSG_EQ (fromBundle->GetBler (value), fromText->GetBler (value),
+                             "Different BLER from bundle at Es/No " << value);
+    }
+
+  for (double target = 0.0; target <= 1.0; target += 0.1)
+    {
+      NS_TEST_ASSERT_MSG_EQ (fromBundle->GetEsNoDb (target), fromText->GetEsNoDb (target),
+                             "Different Es/No from bundle at BLER " << target);
+    }
+
+  bundled->Dispose ();
+
+  std::remove ((directory + "linkresults.bundle").c_str ());
+  std::remove (directory.c_str ());
+}
+
+
+
 /*
  * TEST SUITE
  */
@@ -198,6 +311,8 @@ public:
     //LogComponentEnable ("TestLinkResult", LOG_DEBUG);
     //LogComponentEnable ("TestLinkResult", LOG_FUNCTION);
 
+    AddTestCase (new SatLinkResultsBundleTestCase (), TestCase::QUICK);
+
     /*
      * The following lines of test cases are automatically generated by a
      * supplementary Octave script. Run it from the command line as below:
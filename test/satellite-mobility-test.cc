@@ -26,15 +26,22 @@
 
 // Include a header file from your module to test.
 #include <iostream>
+#include <fstream>
+#include <vector>
 #include "ns3/log.h"
 #include "ns3/test.h"
 #include "ns3/simulator.h"
 #include "ns3/config.h"
 #include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "ns3/string.h"
+#include "ns3/nstime.h"
 #include "ns3/mobility-helper.h"
 #include "../model/satellite-mobility-model.h"
 #include "../model/satellite-position-allocator.h"
+#include "../model/satellite-traced-mobility-model.h"
+#include "../model/satellite-traced-mobility-engine.h"
+#include "../model/satellite-trajectory.h"
 #include "ns3/singleton.h"
 #include "../utils/satellite-env-variables.h"
 
@@ -311,6 +318,521 @@ SatMobilityList2TestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the update engine of the traced mobility models.
+ *
+ *  This case tests that the traced mobility models updated by SatTracedMobilityEngine
+ *  follow the trace file and notify the course change only when the position changes.
+ *
+ *  Test steps:
+ *    1.  Write a trace file moving one degree of latitude in one second and then staying still.
+ *    2.  Create two traced mobility models reading the file and enable the update engine.
+ *    3.  Run the simulation for three seconds and count the course changes.
+ *
+ *  Expected result:
+ *    Both models are updated by the engine and end at the last position of the trace.
+ *    Course changes are notified only while moving and the models are removed
+ *    from the engine when disposed.
+ */
+class SatMobilityTracedEngineTestCase : public TestCase
+{
+public:
+  SatMobilityTracedEngineTestCase ();
+  virtual ~SatMobilityTracedEngineTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void CourseChange (Ptr<const SatMobilityModel> model);
+
+  uint32_t m_nCourseChanges;
+};
+
+SatMobilityTracedEngineTestCase::SatMobilityTracedEngineTestCase ()
+  : TestCase ("Test satellite mobility (traced model) with update engine."),
+  m_nCourseChanges (0)
+{
+}
+
+SatMobilityTracedEngineTestCase::~SatMobilityTracedEngineTestCase ()
+{
+}
+
+void
+SatMobilityTracedEngineTestCase::CourseChange (Ptr<const SatMobilityModel> model)
+{
+  m_nCourseChanges++;
+}
+
+void
+SatMobilityTracedEngineTestCase::DoRun (void)
+{
+  std::string filename = CreateTempDirFilename ("sat-traced-mobility-engine.txt");
+  std::ofstream traceFile (filename.c_str ());
+  traceFile << "0 10 20 0" << std::endl
+            << "1 11 20 0" << std::endl
+            << "2 11 20 0" << std::endl;
+  traceFile.close ();
+
+  NodeContainer c;
+  c.Create (2);
+
+  for (uint32_t i = 0; i < c.GetN (); ++i)
+    {
+      Ptr<SatTracedMobilityModel> model = CreateObject<SatTracedMobilityModel> (filename, Ptr<SatAntennaGainPatternContainer> ());
+      model->SetAttribute ("UpdateInterval", TimeValue (MilliSeconds (100)));
+      model->SetAttribute ("EnableUpdateEngine", BooleanValue (true));
+      model->TraceConnectWithoutContext ("SatCourseChange", MakeCallback (&SatMobilityTracedEngineTestCase::CourseChange, this));
+      c.Get (i)->AggregateObject (model);
+    }
+
+  Simulator::Stop (Seconds (3));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatTracedMobilityEngine>::Get ()->GetNModels (), 2, "Models not updated by the engine");
+
+  // The first update at 1 ms is done by the models, the engine updates them
+  // every 100 ms from there on. The position does not change after one second.
+  NS_TEST_ASSERT_MSG_EQ (m_nCourseChanges, 2 * 11, "Wrong number of course changes");
+
+  for (uint32_t i = 0; i < c.GetN (); ++i)
+    {
+      GeoCoordinate pos = c.Get (i)->GetObject<SatMobilityModel> ()->GetGeoPosition ();
+      NS_TEST_ASSERT_MSG_EQ_TOL (pos.GetLatitude (), 11, 0.000001, "Wrong latitude");
+      NS_TEST_ASSERT_MSG_EQ_TOL (pos.GetLongitude (), 20, 0.000001, "Wrong longitude");
+    }
+
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatTracedMobilityEngine>::Get ()->GetNModels (), 0, "Models not removed from the engine");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test traced mobility models joining and leaving the update engine.
+ *
+ *  This case tests that a model joining the engine in the middle of the update interval
+ *  of the other models gets its velocity from the time since its own update, and that
+ *  the other models are still updated after a model is removed.
+ *
+ *  Test steps:
+ *    1.  Write a trace file moving one degree of latitude in one second and then staying still.
+ *    2.  Enable the update engine with 100 ms update interval by default attribute values.
+ *    3.  Create three traced mobility models at 0 ms, and one more at 50 ms.
+ *    4.  Check the velocities at 150 ms, after the first update by the engine.
+ *    5.  Dispose the first model at 250 ms and run the simulation for three seconds.
+ *
+ *  Expected result:
+ *    All the models have the same velocity at 150 ms. After the first model is disposed,
+ *    the engine updates the other models, which end at the last position of the trace.
+ */
+class SatMobilityTracedEngineJoinTestCase : public TestCase
+{
+public:
+  SatMobilityTracedEngineJoinTestCase ();
+  virtual ~SatMobilityTracedEngineJoinTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void CreateModel (void);
+  void CheckVelocities (void);
+  void DisposeFirstModel (void);
+
+  std::string m_filename;
+  std::vector<Ptr<SatTracedMobilityModel> > m_models;
+};
+
+SatMobilityTracedEngineJoinTestCase::SatMobilityTracedEngineJoinTestCase ()
+  : TestCase ("Test satellite mobility (traced model) joining and leaving update engine."),
+  m_filename (),
+  m_models ()
+{
+}
+
+SatMobilityTracedEngineJoinTestCase::~SatMobilityTracedEngineJoinTestCase ()
+{
+}
+
+void
+SatMobilityTracedEngineJoinTestCase::CreateModel (void)
+{
+  m_models.push_back (CreateObject<SatTracedMobilityModel> (m_filename, Ptr<SatAntennaGainPatternContainer> ()));
+}
+
+void
+SatMobilityTracedEngineJoinTestCase::CheckVelocities (void)
+{
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatTracedMobilityEngine>::Get ()->GetNModels (), 4, "Models not updated by the engine");
+
+  double speed = m_models[0]->GetVelocity ().GetLength ();
+  NS_TEST_ASSERT_MSG_GT (speed, 0.0, "Model not moving");
+
+  for (uint32_t i = 1; i < m_models.size (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ_TOL (m_models[i]->GetVelocity ().GetLength (), speed, speed * 0.001, "Wrong speed of model " << i);
+    }
+}
+
+void
+SatMobilityTracedEngineJoinTestCase::DisposeFirstModel (void)
+{
+  m_models[0]->Dispose ();
+
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatTracedMobilityEngine>::Get ()->GetNModels (), 3, "Model not removed from the engine");
+}
+
+void
+SatMobilityTracedEngineJoinTestCase::DoRun (void)
+{
+  m_filename = CreateTempDirFilename ("sat-traced-mobility-engine-join.txt");
+  std::ofstream traceFile (m_filename.c_str ());
+  traceFile << "0 10 20 0" << std::endl
+            << "1 11 20 0" << std::endl
+            << "2 11 20 0" << std::endl;
+  traceFile.close ();
+
+  Config::SetDefault ("ns3::SatTracedMobilityModel::UpdateInterval", TimeValue (MilliSeconds (100)));
+  Config::SetDefault ("ns3::SatTracedMobilityModel::EnableUpdateEngine", BooleanValue (true));
+
+  for (uint32_t i = 0; i < 3; ++i)
+    {
+      CreateModel ();
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatTracedMobilityEngine>::Get ()->GetNModels (), 3, "Models not added to the engine at construction");
+
+  Simulator::Schedule (MilliSeconds (50), &SatMobilityTracedEngineJoinTestCase::CreateModel, this);
+  Simulator::Schedule (MilliSeconds (150), &SatMobilityTracedEngineJoinTestCase::CheckVelocities, this);
+  Simulator::Schedule (MilliSeconds (250), &SatMobilityTracedEngineJoinTestCase::DisposeFirstModel, this);
+
+  Simulator::Stop (Seconds (3));
+  Simulator::Run ();
+
+  for (uint32_t i = 1; i < m_models.size (); ++i)
+    {
+      GeoCoordinate pos = m_models[i]->GetGeoPosition ();
+      NS_TEST_ASSERT_MSG_EQ_TOL (pos.GetLatitude (), 11, 0.000001, "Wrong latitude of model " << i);
+      NS_TEST_ASSERT_MSG_EQ_TOL (pos.GetLongitude (), 20, 0.000001, "Wrong longitude of model " << i);
+      m_models[i]->Dispose ();
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatTracedMobilityEngine>::Get ()->GetNModels (), 0, "Models not removed from the engine");
+
+  m_models.clear ();
+  Simulator::Destroy ();
+
+  Config::SetDefault ("ns3::SatTracedMobilityModel::UpdateInterval", TimeValue (MilliSeconds (1)));
+  Config::SetDefault ("ns3::SatTracedMobilityModel::EnableUpdateEngine", BooleanValue (false));
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the position tolerance of the update engine.
+ *
+ *  This case tests that a traced mobility model moving less than the position
+ *  tolerance per update still notifies the course change once it has drifted
+ *  further than the tolerance from the last notified position.
+ *
+ *  Test steps:
+ *    1.  Write a trace file moving 0.01 degrees of latitude, about 1.1 km, in 100 seconds.
+ *    2.  Set the position tolerance of the engine to 50 m, about 45 updates of 100 ms.
+ *    3.  Create a traced mobility model reading the file with the update engine.
+ *    4.  Run the simulation for 20 seconds and record the notified positions.
+ *
+ *  Expected result:
+ *    The course change is notified several times. Each notified position is further
+ *    than the tolerance from the previous one, but by less than one update more, and
+ *    the final position is within the tolerance from the last notified one.
+ */
+class SatMobilityTracedEngineToleranceTestCase : public TestCase
+{
+public:
+  SatMobilityTracedEngineToleranceTestCase ();
+  virtual ~SatMobilityTracedEngineToleranceTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void CourseChange (Ptr<const SatMobilityModel> model);
+
+  std::vector<GeoCoordinate> m_notifiedPositions;
+};
+
+SatMobilityTracedEngineToleranceTestCase::SatMobilityTracedEngineToleranceTestCase ()
+  : TestCase ("Test satellite mobility (traced model) with update engine position tolerance."),
+  m_notifiedPositions ()
+{
+}
+
+SatMobilityTracedEngineToleranceTestCase::~SatMobilityTracedEngineToleranceTestCase ()
+{
+}
+
+void
+SatMobilityTracedEngineToleranceTestCase::CourseChange (Ptr<const SatMobilityModel> model)
+{
+  m_notifiedPositions.push_back (model->GetGeoPosition ());
+}
+
+void
+SatMobilityTracedEngineToleranceTestCase::DoRun (void)
+{
+  const double tolerance = 50.0;
+
+  std::string filename = CreateTempDirFilename ("sat-traced-mobility-engine-tolerance.txt");
+  std::ofstream traceFile (filename.c_str ());
+  traceFile << "0 10 20 0" << std::endl
+            << "100 10.01 20 0" << std::endl;
+  traceFile.close ();
+
+  // The engine is a singleton, so its attribute is set directly
+  Singleton<SatTracedMobilityEngine>::Get ()->SetAttribute ("PositionTolerance", DoubleValue (tolerance));
+
+  Config::SetDefault ("ns3::SatTracedMobilityModel::UpdateInterval", TimeValue (MilliSeconds (100)));
+  Config::SetDefault ("ns3::SatTracedMobilityModel::EnableUpdateEngine", BooleanValue (true));
+
+  Ptr<SatTracedMobilityModel> model = CreateObject<SatTracedMobilityModel> (filename, Ptr<SatAntennaGainPatternContainer> ());
+  model->TraceConnectWithoutContext ("SatCourseChange", MakeCallback (&SatMobilityTracedEngineToleranceTestCase::CourseChange, this));
+
+  // The position at the construction is notified without the tolerance
+  m_notifiedPositions.push_back (model->GetGeoPosition ());
+
+  Simulator::Stop (Seconds (20));
+  Simulator::Run ();
+
+  double step = model->GetVelocity ().GetLength () * 0.1;
+  NS_TEST_ASSERT_MSG_GT (step, 0.0, "Model not moving");
+  NS_TEST_ASSERT_MSG_LT (step, tolerance, "Model moving more than the tolerance per update");
+
+  // About 222 m in 20 seconds
+  NS_TEST_ASSERT_MSG_GT (m_notifiedPositions.size (), 3, "Course changes of slow model not notified");
+
+  for (uint32_t i = 1; i < m_notifiedPositions.size (); ++i)
+    {
+      double distance = (m_notifiedPositions[i].ToVector () - m_notifiedPositions[i - 1].ToVector ()).GetLength ();
+      NS_TEST_ASSERT_MSG_GT (distance, tolerance, "Course change " << i << " notified within the tolerance");
+      NS_TEST_ASSERT_MSG_LT (distance, tolerance + step * 1.01, "Course change " << i << " notified too late");
+    }
+
+  double drift = (model->GetGeoPosition ().ToVector () - m_notifiedPositions.back ().ToVector ()).GetLength ();
+  NS_TEST_ASSERT_MSG_LT_OR_EQ (drift, tolerance, "Drift beyond the tolerance not notified");
+
+  model->Dispose ();
+  Simulator::Destroy ();
+
+  Singleton<SatTracedMobilityEngine>::Get ()->SetAttribute ("PositionTolerance", DoubleValue (0.0));
+  Config::SetDefault ("ns3::SatTracedMobilityModel::UpdateInterval", TimeValue (MilliSeconds (1)));
+  Config::SetDefault ("ns3::SatTracedMobilityModel::EnableUpdateEngine", BooleanValue (false));
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test models disposed by a course change callback
+ * while the update engine updates them.
+ *
+ *  Test steps:
+ *    1.  Write a trace file moving one degree of latitude in one second and then staying still.
+ *    2.  Create four traced mobility models with the update engine.
+ *    3.  Dispose the last three models in the course change callback of the first
+ *        model at its first update by the engine.
+ *    4.  Run the simulation for three seconds.
+ *
+ *  Expected result:
+ *    The disposed models are not updated anymore and are removed from the engine.
+ *    The first model is still updated and ends at the last position of the trace.
+ */
+class SatMobilityTracedEngineRemoveTestCase : public TestCase
+{
+public:
+  SatMobilityTracedEngineRemoveTestCase ();
+  virtual ~SatMobilityTracedEngineRemoveTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void FirstCourseChange (Ptr<const SatMobilityModel> model);
+  void OtherCourseChange (Ptr<const SatMobilityModel> model);
+
+  std::vector<Ptr<SatTracedMobilityModel> > m_models;
+  bool m_disposed;
+  uint32_t m_nChangesAfterDispose;
+};
+
+SatMobilityTracedEngineRemoveTestCase::SatMobilityTracedEngineRemoveTestCase ()
+  : TestCase ("Test satellite mobility (traced model) disposed during engine update."),
+  m_models (),
+  m_disposed (false),
+  m_nChangesAfterDispose (0)
+{
+}
+
+SatMobilityTracedEngineRemoveTestCase::~SatMobilityTracedEngineRemoveTestCase ()
+{
+}
+
+void
+SatMobilityTracedEngineRemoveTestCase::FirstCourseChange (Ptr<const SatMobilityModel> model)
+{
+  if (m_disposed || Simulator::Now () < MilliSeconds (100))
+    {
+      return;
+    }
+
+  for (uint32_t i = 1; i < m_models.size (); ++i)
+    {
+      m_models[i]->Dispose ();
+    }
+  m_disposed = true;
+
+  NS_TEST_EXPECT_MSG_EQ (Singleton<SatTracedMobilityEngine>::Get ()->GetNModels (), 1, "Models not removed from the engine");
+}
+
+void
+SatMobilityTracedEngineRemoveTestCase::OtherCourseChange (Ptr<const SatMobilityModel> model)
+{
+  if (m_disposed)
+    {
+      m_nChangesAfterDispose++;
+    }
+}
+
+void
+SatMobilityTracedEngineRemoveTestCase::DoRun (void)
+{
+  std::string filename = CreateTempDirFilename ("sat-traced-mobility-engine-remove.txt");
+  std::ofstream traceFile (filename.c_str ());
+  traceFile << "0 10 20 0" << std::endl
+            << "1 11 20 0" << std::endl
+            << "2 11 20 0" << std::endl;
+  traceFile.close ();
+
+  Config::SetDefault ("ns3::SatTracedMobilityModel::UpdateInterval", TimeValue (MilliSeconds (100)));
+  Config::SetDefault ("ns3::SatTracedMobilityModel::EnableUpdateEngine", BooleanValue (true));
+
+  for (uint32_t i = 0; i < 4; ++i)
+    {
+      Ptr<SatTracedMobilityModel> model = CreateObject<SatTracedMobilityModel> (filename, Ptr<SatAntennaGainPatternContainer> ());
+
+      if (i == 0)
+        {
+          model->TraceConnectWithoutContext ("SatCourseChange", MakeCallback (&SatMobilityTracedEngineRemoveTestCase::FirstCourseChange, this));
+        }
+      else
+        {
+          model->TraceConnectWithoutContext ("SatCourseChange", MakeCallback (&SatMobilityTracedEngineRemoveTestCase::OtherCourseChange, this));
+        }
+
+      m_models.push_back (model);
+    }
+
+  Simulator::Stop (Seconds (3));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_disposed, true, "Models not disposed");
+  NS_TEST_ASSERT_MSG_EQ (m_nChangesAfterDispose, 0, "Disposed models updated");
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatTracedMobilityEngine>::Get ()->GetNModels (), 1, "Models not removed from the engine");
+
+  GeoCoordinate pos = m_models[0]->GetGeoPosition ();
+  NS_TEST_ASSERT_MSG_EQ_TOL (pos.GetLatitude (), 11, 0.000001, "Wrong latitude");
+  NS_TEST_ASSERT_MSG_EQ_TOL (pos.GetLongitude (), 20, 0.000001, "Wrong longitude");
+
+  m_models[0]->Dispose ();
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatTracedMobilityEngine>::Get ()->GetNModels (), 0, "Model not removed from the engine");
+
+  m_models.clear ();
+  Simulator::Destroy ();
+
+  Config::SetDefault ("ns3::SatTracedMobilityModel::UpdateInterval", TimeValue (MilliSeconds (1)));
+  Config::SetDefault ("ns3::SatTracedMobilityModel::EnableUpdateEngine", BooleanValue (false));
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the trajectories read from the position trace files.
+ *
+ *  This case tests that the trajectories interpolate the positions of irregularly
+ *  sampled trace files, and that the binary trajectory format gives the same positions.
+ *
+ *  Test steps:
+ *    1.  Write a text trace file with irregular time samples.
+ *    2.  Read the file and check the positions before, between, at and after the samples.
+ *    3.  Convert the file to the binary format and read both files in parallel.
+ *
+ *  Expected result:
+ *    Positions are interpolated linearly between the samples and are the same
+ *    from the text and binary files.
+ */
+class SatMobilityTrajectoryTestCase : public TestCase
+{
+public:
+  SatMobilityTrajectoryTestCase ();
+  virtual ~SatMobilityTrajectoryTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatMobilityTrajectoryTestCase::SatMobilityTrajectoryTestCase ()
+  : TestCase ("Test satellite mobility trajectories from text and binary files.")
+{
+}
+
+SatMobilityTrajectoryTestCase::~SatMobilityTrajectoryTestCase ()
+{
+}
+
+void
+SatMobilityTrajectoryTestCase::DoRun (void)
+{
+  std::string textFilename = CreateTempDirFilename ("sat-trajectory.txt");
+  std::string binaryFilename = CreateTempDirFilename ("sat-trajectory.bin");
+
+  std::ofstream traceFile (textFilename.c_str ());
+  traceFile << "0 10 20 100" << std::endl
+            << "0.5 10 21 100" << std::endl
+            << "0.6 12 21 100" << std::endl
+            << "4 12 21 300" << std::endl;
+  traceFile.close ();
+
+  Ptr<SatTrajectory> trajectory = SatTrajectory::Load (textFilename);
+  NS_TEST_ASSERT_MSG_EQ (trajectory->GetNSamples (), 4, "Wrong number of samples");
+  NS_TEST_ASSERT_MSG_EQ (SatTrajectory::IsBinaryFile (textFilename), false, "Text file detected as binary");
+
+  NS_TEST_ASSERT_MSG_EQ (trajectory->GetSampleIndex (-1.0), 0, "Wrong sample before the first sample");
+  NS_TEST_ASSERT_MSG_EQ (trajectory->GetSampleIndex (0.55), 1, "Wrong sample between samples");
+  NS_TEST_ASSERT_MSG_EQ (trajectory->GetSampleIndex (0.6), 2, "Wrong sample at a sample");
+  NS_TEST_ASSERT_MSG_EQ (trajectory->GetSampleIndex (3.0), 2, "Wrong sample in a long interval");
+  NS_TEST_ASSERT_MSG_EQ (trajectory->GetSampleIndex (10.0), 3, "Wrong sample after the last sample");
+
+  GeoCoordinate pos = trajectory->GetPosition (0.25, GeoCoordinate::SPHERE);
+  NS_TEST_ASSERT_MSG_EQ_TOL (pos.GetLongitude (), 20.5, 0.000001, "Wrong interpolated longitude");
+  pos = trajectory->GetPosition (0.55, GeoCoordinate::SPHERE);
+  NS_TEST_ASSERT_MSG_EQ_TOL (pos.GetLatitude (), 11, 0.000001, "Wrong interpolated latitude");
+  pos = trajectory->GetPosition (2.3, GeoCoordinate::SPHERE);
+  NS_TEST_ASSERT_MSG_EQ_TOL (pos.GetAltitude (), 200, 0.000001, "Wrong interpolated altitude");
+  pos = trajectory->GetPosition (10.0, GeoCoordinate::SPHERE);
+  NS_TEST_ASSERT_MSG_EQ_TOL (pos.GetAltitude (), 300, 0.000001, "Wrong altitude after the last sample");
+
+  SatTrajectory::ConvertToBinary (textFilename, binaryFilename);
+  NS_TEST_ASSERT_MSG_EQ (SatTrajectory::IsBinaryFile (binaryFilename), true, "Binary file not detected");
+
+  std::vector<std::string> filenames;
+  filenames.push_back (textFilename);
+  filenames.push_back (binaryFilename);
+
+  std::vector<Ptr<SatTrajectory> > trajectories;
+  SatTrajectory::LoadFiles (filenames, 2, trajectories);
+  NS_TEST_ASSERT_MSG_EQ (trajectories.size (), 2, "Wrong number of trajectories");
+  NS_TEST_ASSERT_MSG_EQ (trajectories[1]->GetNSamples (), 4, "Wrong number of samples in binary file");
+
+  for (double time = -0.5; time < 5.0; time += 0.05)
+    {
+      GeoCoordinate textPos = trajectories[0]->GetPosition (time, GeoCoordinate::SPHERE);
+      GeoCoordinate binaryPos = trajectories[1]->GetPosition (time, GeoCoordinate::SPHERE);
+      NS_TEST_ASSERT_MSG_EQ (textPos.GetLatitude (), binaryPos.GetLatitude (), "Different latitude from binary file");
+      NS_TEST_ASSERT_MSG_EQ (textPos.GetLongitude (), binaryPos.GetLongitude (), "Different longitude from binary file");
+      NS_TEST_ASSERT_MSG_EQ (textPos.GetAltitude (), binaryPos.GetAltitude (), "Different altitude from binary file");
+    }
+}
+
 /**
  * \ingroup satellite
  * \brief Test suite for Satellite mobility unit test cases.
@@ -327,6 +849,11 @@ SatMobilityTestSuite::SatMobilityTestSuite ()
   AddTestCase (new SatMobilityRandomTestCase, TestCase::QUICK);
   AddTestCase (new SatMobilityList1TestCase, TestCase::QUICK);
   AddTestCase (new SatMobilityList2TestCase, TestCase::QUICK);
+  AddTestCase (new SatMobilityTracedEngineTestCase, TestCase::QUICK);
+  AddTestCase (new SatMobilityTracedEngineJoinTestCase, TestCase::QUICK);
+  AddTestCase (new SatMobilityTracedEngineToleranceTestCase, TestCase::QUICK);
+  AddTestCase (new SatMobilityTracedEngineRemoveTestCase, TestCase::QUICK);
+  AddTestCase (new SatMobilityTrajectoryTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
@@ -0,0 +1,188 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup satellite
+ * \file satellite-object-pool-test.cc
+ * \brief Object pool test suite
+ */
+
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/ptr.h"
+#include "ns3/uinteger.h"
+#include "../model/satellite-object-pool.h"
+#include "../model/satellite-signal-parameters.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the pool reuses the released blocks and
+ * passes the requests of other sizes to the heap.
+ */
+class SatObjectPoolTestCase : public TestCase
+{
+public:
+  SatObjectPoolTestCase ();
+  virtual ~SatObjectPoolTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatObjectPoolTestCase::SatObjectPoolTestCase ()
+  : TestCase ("Test reuse of the memory blocks in the object pool.")
+{
+}
+
+SatObjectPoolTestCase::~SatObjectPoolTestCase ()
+{
+}
+
+void
+SatObjectPoolTestCase::DoRun (void)
+{
+  SatObjectPool pool (64);
+  std::vector<void*> blocks;
+
+  for (uint32_t i = 0; i < 10; ++i)
+    {
+      blocks.push_back (pool.Allocate (64));
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (pool.GetNAllocations (), 10, "Wrong number of allocations");
+  NS_TEST_ASSERT_MSG_EQ (pool.GetNHeapAllocations (), 10, "Wrong number of heap allocations");
+  NS_TEST_ASSERT_MSG_EQ (pool.GetNInUse (), 10, "Wrong number of blocks in use");
+
+  void* lastBlock = blocks.back ();
+
+  for (uint32_t i = 0; i < blocks.size (); ++i)
+    {
+      pool.Deallocate (blocks[i], 64);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (pool.GetNInUse (), 0, "Wrong number of blocks in use after release");
+  NS_TEST_ASSERT_MSG_EQ (pool.GetNFree (), 10, "Wrong number of free blocks");
+
+  // The last released block is reused first
+  void* block = pool.Allocate (64);
+  NS_TEST_ASSERT_MSG_EQ ((block == lastBlock), true, "Released block not reused");
+  NS_TEST_ASSERT_MSG_EQ (pool.GetNHeapAllocations (), 10, "Heap used although free blocks exist");
+  pool.Deallocate (block, 64);
+
+  // Other sizes are not pooled
+  void* other = pool.Allocate (128);
+  NS_TEST_ASSERT_MSG_EQ (pool.GetNAllocations (), 11, "Other size counted as pool allocation");
+  pool.Deallocate (other, 128);
+  NS_TEST_ASSERT_MSG_EQ (pool.GetNFree (), 10, "Other size added to free blocks");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the signal parameters are allocated from
+ * their pool and that the counters are available as attributes.
+ */
+class SatSignalParametersPoolTestCase : public TestCase
+{
+public:
+  SatSignalParametersPoolTestCase ();
+  virtual ~SatSignalParametersPoolTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatSignalParametersPoolTestCase::SatSignalParametersPoolTestCase ()
+  : TestCase ("Test allocation of signal parameters from the pool.")
+{
+}
+
+SatSignalParametersPoolTestCase::~SatSignalParametersPoolTestCase ()
+{
+}
+
+void
+SatSignalParametersPoolTestCase::DoRun (void)
+{
+  const SatObjectPool& pool = SatSignalParameters::GetPool ();
+
+  Ptr<SatSignalParameters> txParams = Create<SatSignalParameters> ();
+  txParams->m_beamId = 7;
+
+  uint64_t inUse = pool.GetNInUse ();
+
+  // Copy and release as the channel does per receiver
+  for (uint32_t i = 0; i < 100; ++i)
+    {
+      Ptr<SatSignalParameters> rxParams = txParams->Copy ();
+      NS_TEST_ASSERT_MSG_EQ (rxParams->m_beamId, 7, "Wrong copy");
+    }
+
+  uint64_t heapAllocations = pool.GetNHeapAllocations ();
+  uint64_t allocations = pool.GetNAllocations ();
+
+  for (uint32_t i = 0; i < 100; ++i)
+    {
+      Ptr<SatSignalParameters> rxParams = txParams->Copy ();
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (pool.GetNHeapAllocations (), heapAllocations, "Released signal parameters not reused");
+  NS_TEST_ASSERT_MSG_EQ (pool.GetNInUse (), inUse, "Signal parameters not released");
+
+  // The counters of the allocate and release cycle are available as attributes
+  UintegerValue allocationsValue;
+  UintegerValue heapAllocationsValue;
+  UintegerValue inUseValue;
+  txParams->GetAttribute ("PoolAllocations", allocationsValue);
+  txParams->GetAttribute ("PoolHeapAllocations", heapAllocationsValue);
+  txParams->GetAttribute ("PoolInUse", inUseValue);
+  NS_TEST_ASSERT_MSG_EQ (allocationsValue.Get (), allocations + 100, "Wrong allocation attribute");
+  NS_TEST_ASSERT_MSG_EQ (heapAllocationsValue.Get (), heapAllocations, "Wrong heap allocation attribute");
+  NS_TEST_ASSERT_MSG_EQ (inUseValue.Get (), inUse, "Wrong in use attribute");
+
+  Ptr<SatSignalParameters> rxParams = txParams->Copy ();
+  rxParams->GetAttribute ("PoolInUse", inUseValue);
+  NS_TEST_ASSERT_MSG_EQ (inUseValue.Get (), inUse + 1, "Wrong in use attribute of a copy");
+  rxParams = 0;
+
+  txParams = 0;
+  NS_TEST_ASSERT_MSG_EQ (pool.GetNInUse (), inUse - 1, "Signal parameters not released");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the object pool.
+ */
+class SatObjectPoolTestSuite : public TestSuite
+{
+public:
+  SatObjectPoolTestSuite ();
+};
+
+SatObjectPoolTestSuite::SatObjectPoolTestSuite ()
+  : TestSuite ("sat-object-pool-test", UNIT)
+{
+  AddTestCase (new SatObjectPoolTestCase, TestCase::QUICK);
+  AddTestCase (new SatSignalParametersPoolTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatObjectPoolTestSuite satObjectPoolTestSuite;
@@ -0,0 +1,393 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup satellite
+ * \file satellite-output-stream-test.cc
+ * \brief Streamed output trace test suite
+ */
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/ptr.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "../utils/satellite-output-fstream-double-container.h"
+#include "../utils/satellite-output-stream-writer.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Base of the streamed output trace test cases, with the helpers to
+ * create the containers and read the output files.
+ */
+class SatOutputStreamTestCaseBase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param name name of the test case
+   */
+  SatOutputStreamTestCaseBase (std::string name);
+  virtual ~SatOutputStreamTestCaseBase ();
+
+protected:
+  /**
+   * \brief Create a container with two values in a row
+   * \param filename name of the output file
+   * \param streaming enable streaming
+   * \param binary enable binary output
+   * \return the container
+   */
+  Ptr<SatOutputFileStreamDoubleContainer> CreateContainer (std::string filename, bool streaming, bool binary);
+
+  /**
+   * \brief Get the rows added to the containers of the test
+   * \return the rows
+   */
+  std::vector<std::vector<double> > GetRows ();
+
+  /**
+   * \brief Read an output file
+   * \param filename name of the output file
+   * \return contents of the file
+   */
+  std::string ReadFile (std::string filename);
+
+  /**
+   * \brief Count the rows of a text output file
+   * \param filename name of the output file
+   * \return number of rows
+   */
+  uint32_t CountRows (std::string filename);
+
+  /**
+   * \brief Read a binary output file
+   * \param filename name of the output file
+   * \param values row-major values read from the file
+   * \return the number of values in a row of the header, or zero if the
+   * header is not valid
+   */
+  uint32_t ReadBinaryFile (std::string filename, std::vector<double>& values);
+};
+
+SatOutputStreamTestCaseBase::SatOutputStreamTestCaseBase (std::string name)
+  : TestCase (name)
+{
+}
+
+SatOutputStreamTestCaseBase::~SatOutputStreamTestCaseBase ()
+{
+}
+
+Ptr<SatOutputFileStreamDoubleContainer>
+SatOutputStreamTestCaseBase::CreateContainer (std::string filename, bool streaming, bool binary)
+{
+  Ptr<SatOutputFileStreamDoubleContainer> container = CreateObject<SatOutputFileStreamDoubleContainer> (filename, std::ios::out, 2);
+  container->SetAttribute ("EnableStreaming", BooleanValue (streaming));
+  container->SetAttribute ("StreamBufferSize", UintegerValue (2));
+  container->SetAttribute ("BinaryOutput", BooleanValue (binary));
+  return container;
+}
+
+std::vector<std::vector<double> >
+SatOutputStreamTestCaseBase::GetRows ()
+{
+  std::vector<std::vector<double> > rows;
+
+  // Values which need the whole precision, and an odd number of rows so that
+  // the last buffer is only partially filled
+  for (uint32_t i = 0; i < 7; ++i)
+    {
+      std::vector<double> row;
+      row.push_back (i * 0.1 + 1e-9);
+      row.push_back ((i % 2 ? -1.0 : 1.0) * std::pow (10.0, i) / 3.0);
+      rows.push_back (row);
+    }
+
+  return rows;
+}
+
+std::string
+SatOutputStreamTestCaseBase::ReadFile (std::string filename)
+{
+  std::ifstream ifs (filename.c_str (), std::ios::in | std::ios::binary);
+  std::ostringstream contents;
+  contents << ifs.rdbuf ();
+  return contents.str ();
+}
+
+uint32_t
+SatOutputStreamTestCaseBase::CountRows (std::string filename)
+{
+  std::ifstream ifs (filename.c_str ());
+  std::string line;
+  uint32_t rows = 0;
+
+  while (std::getline (ifs, line))
+    {
+      ++rows;
+    }
+
+  return rows;
+}
+
+uint32_t
+SatOutputStreamTestCaseBase::ReadBinaryFile (std::string filename, std::vector<double>& values)
+{
+  std::string contents = ReadFile (filename);
+  values.clear ();
+
+  if (contents.size () < SatOutputFileStreamDoubleContainer::BINARY_HEADER_SIZE
+      || contents.compare (0, 8, std::string ("SNS3TRC\0", 8)) != 0)
+    {
+      return 0;
+    }
+
+  uint32_t version;
+  uint32_t valuesInRow;
+  std::memcpy (&version, contents.data () + 8, sizeof (uint32_t));
+  std::memcpy (&valuesInRow, contents.data () + 12, sizeof (uint32_t));
+
+  uint32_t rowSize = valuesInRow * sizeof (double);
+  uint32_t dataSize = contents.size () - SatOutputFileStreamDoubleContainer::BINARY_HEADER_SIZE;
+
+  if (version != SatOutputFileStreamDoubleContainer::BINARY_FORMAT_VERSION || valuesInRow == 0 || dataSize % rowSize != 0)
+    {
+      return 0;
+    }
+
+  values.resize (dataSize / sizeof (double));
+  std::memcpy (values.data (), contents.data () + SatOutputFileStreamDoubleContainer::BINARY_HEADER_SIZE, dataSize);
+
+  return valuesInRow;
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that streaming containers keep the background
+ * writer alive until they are disposed, i.e. the containers may be written
+ * and disposed after the other users of the writer are gone, as happens
+ * in the destruction of the static trace containers.
+ */
+class SatOutputStreamWriterLifetimeTestCase : public SatOutputStreamTestCaseBase
+{
+public:
+  SatOutputStreamWriterLifetimeTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatOutputStreamWriterLifetimeTestCase::SatOutputStreamWriterLifetimeTestCase ()
+  : SatOutputStreamTestCaseBase ("Test disposing streaming containers after the writer has been used.")
+{
+}
+
+void
+SatOutputStreamWriterLifetimeTestCase::DoRun (void)
+{
+  std::string filenameA = CreateTempDirFilename ("sat-output-stream-a.txt");
+  std::string filenameB = CreateTempDirFilename ("sat-output-stream-b.txt");
+
+  // An outside reference, released before the containers like a static
+  // singleton destroyed before them
+  std::shared_ptr<SatOutputStreamWriter> writer = SatOutputStreamWriter::Get ();
+  std::weak_ptr<SatOutputStreamWriter> weakWriter = writer;
+
+  Ptr<SatOutputFileStreamDoubleContainer> containerA = CreateContainer (filenameA, true, false);
+  Ptr<SatOutputFileStreamDoubleContainer> containerB = CreateContainer (filenameB, true, false);
+
+  // Five rows with a buffer of two rows, so the writer thread is used
+  for (uint32_t i = 0; i < 5; ++i)
+    {
+      std::vector<double> row (2, i);
+      containerA->AddToContainer (row);
+      containerB->AddToContainer (row);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ ((SatOutputStreamWriter::Get () == writer), true, "Containers do not share the writer");
+  NS_TEST_ASSERT_MSG_EQ (writer.use_count (), 3, "Containers do not hold the writer");
+
+  writer.reset ();
+  NS_TEST_ASSERT_MSG_EQ (weakWriter.expired (), false, "Writer released while containers stream");
+
+  containerA->WriteContainerToFile ();
+  containerA->Dispose ();
+  NS_TEST_ASSERT_MSG_EQ (CountRows (filenameA), 5, "Wrong number of rows written");
+  NS_TEST_ASSERT_MSG_EQ (weakWriter.expired (), false, "Writer released while a container streams");
+
+  containerB->WriteContainerToFile ();
+  containerB->Dispose ();
+  NS_TEST_ASSERT_MSG_EQ (CountRows (filenameB), 5, "Wrong number of rows written");
+
+  // The last container stopped the writer
+  NS_TEST_ASSERT_MSG_EQ (weakWriter.expired (), true, "Writer not released by the containers");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the streamed output files are byte-identical
+ * to the output files written at the end, in the text and binary formats,
+ * and that the binary files hold the header and the values added.
+ */
+class SatOutputStreamFormatTestCase : public SatOutputStreamTestCaseBase
+{
+public:
+  SatOutputStreamFormatTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatOutputStreamFormatTestCase::SatOutputStreamFormatTestCase ()
+  : SatOutputStreamTestCaseBase ("Test that streamed output equals the output written at the end.")
+{
+}
+
+void
+SatOutputStreamFormatTestCase::DoRun (void)
+{
+  std::vector<std::vector<double> > rows = GetRows ();
+
+  for (uint32_t binary = 0; binary < 2; ++binary)
+    {
+      std::string suffix = binary ? ".bin" : ".txt";
+      std::string filenames[2] = { CreateTempDirFilename ("sat-output-stored" + suffix),
+                                   CreateTempDirFilename ("sat-output-streamed" + suffix) };
+
+      for (uint32_t streaming = 0; streaming < 2; ++streaming)
+        {
+          Ptr<SatOutputFileStreamDoubleContainer> container = CreateContainer (filenames[streaming], streaming, binary);
+
+          for (uint32_t i = 0; i < rows.size (); ++i)
+            {
+              container->AddToContainer (rows[i]);
+            }
+
+          container->WriteContainerToFile ();
+          container->Dispose ();
+        }
+
+      std::string stored = ReadFile (filenames[0]);
+      NS_TEST_ASSERT_MSG_EQ (stored.empty (), false, "Nothing written to " << filenames[0]);
+      NS_TEST_EXPECT_MSG_EQ ((ReadFile (filenames[1]) == stored), true, "Streamed output differs from stored output in " << suffix << " format");
+
+      if (binary)
+        {
+          for (uint32_t streaming = 0; streaming < 2; ++streaming)
+            {
+              std::vector<double> values;
+              NS_TEST_ASSERT_MSG_EQ (ReadBinaryFile (filenames[streaming], values), 2, "Invalid binary header in " << filenames[streaming]);
+              NS_TEST_ASSERT_MSG_EQ (values.size (), 2 * rows.size (), "Wrong number of values in " << filenames[streaming]);
+
+              for (uint32_t i = 0; i < rows.size (); ++i)
+                {
+                  NS_TEST_EXPECT_MSG_EQ (values[2 * i], rows[i][0], "Wrong first value of row " << i << " in " << filenames[streaming]);
+                  NS_TEST_EXPECT_MSG_EQ (values[2 * i + 1], rows[i][1], "Wrong second value of row " << i << " in " << filenames[streaming]);
+                }
+            }
+        }
+      else
+        {
+          NS_TEST_EXPECT_MSG_EQ (CountRows (filenames[0]), rows.size (), "Wrong number of rows written");
+        }
+    }
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that streaming containers do not keep their files
+ * open, i.e. more containers than the default limit of 1024 open files per
+ * process may stream at the same time.
+ */
+class SatOutputStreamManyContainersTestCase : public SatOutputStreamTestCaseBase
+{
+public:
+  SatOutputStreamManyContainersTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatOutputStreamManyContainersTestCase::SatOutputStreamManyContainersTestCase ()
+  : SatOutputStreamTestCaseBase ("Test streaming more containers than the default open file limit.")
+{
+}
+
+void
+SatOutputStreamManyContainersTestCase::DoRun (void)
+{
+  const uint32_t nContainers = 1100;
+
+  std::vector<std::vector<double> > rows = GetRows ();
+  std::vector<Ptr<SatOutputFileStreamDoubleContainer> > containers;
+  std::vector<std::string> filenames;
+
+  for (uint32_t c = 0; c < nContainers; ++c)
+    {
+      filenames.push_back (CreateTempDirFilename ("sat-output-stream-" + std::to_string (c) + ".txt"));
+      containers.push_back (CreateContainer (filenames.back (), true, false));
+    }
+
+  // All the containers stream at the same time
+  for (uint32_t i = 0; i < rows.size (); ++i)
+    {
+      for (uint32_t c = 0; c < nContainers; ++c)
+        {
+          containers[c]->AddToContainer (rows[i]);
+        }
+    }
+
+  for (uint32_t c = 0; c < nContainers; ++c)
+    {
+      containers[c]->WriteContainerToFile ();
+      containers[c]->Dispose ();
+      NS_TEST_EXPECT_MSG_EQ (CountRows (filenames[c]), rows.size (), "Wrong number of rows written to " << filenames[c]);
+    }
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the streamed output traces.
+ */
+class SatOutputStreamTestSuite : public TestSuite
+{
+public:
+  SatOutputStreamTestSuite ();
+};
+
+SatOutputStreamTestSuite::SatOutputStreamTestSuite ()
+  : TestSuite ("sat-output-stream-test", UNIT)
+{
+  AddTestCase (new SatOutputStreamWriterLifetimeTestCase, TestCase::QUICK);
+  AddTestCase (new SatOutputStreamFormatTestCase, TestCase::QUICK);
+  AddTestCase (new SatOutputStreamManyContainersTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatOutputStreamTestSuite satOutputStreamTestSuite;
@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup satellite
+ * \file satellite-signal-parameters-test.cc
+ * \brief Signal parameters test suite
+ */
+
+#include <string>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/ptr.h"
+#include "ns3/packet.h"
+#include "ns3/mac48-address.h"
+#include "../model/satellite-mac-tag.h"
+#include "../model/satellite-signal-parameters.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check the packet addresses given by the signal
+ * parameters with and without the packet metadata.
+ *
+ *  Test steps:
+ *    1.  Create signal parameters with a burst of packets with MAC tags and
+ *        one packet without a MAC tag.
+ *    2.  Get the packet addresses without the packet metadata, i.e. as with
+ *        the SatPhy attribute EnablePacketMetadata set to false.
+ *    3.  Fill the packet metadata, copy the signal parameters and get the
+ *        packet addresses of both.
+ *    4.  Add a packet to the burst of the copy and get its packet addresses.
+ *
+ *  Expected result:
+ *    The packet addresses equal the MAC tag contents in all the steps, and
+ *    false is returned for the packet without a MAC tag. The copy shares the
+ *    packet metadata of the original signal parameters. After the burst has
+ *    changed, the addresses are peeked from the MAC tags.
+ */
+class SatSignalParametersPacketAddressesTestCase : public TestCase
+{
+public:
+  SatSignalParametersPacketAddressesTestCase ();
+  virtual ~SatSignalParametersPacketAddressesTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Check the packet addresses of the signal parameters against the
+   * MAC tags of the packets
+   * \param params signal parameters
+   * \param step name of the step checked
+   */
+  void CheckPacketAddresses (Ptr<SatSignalParameters> params, std::string step);
+};
+
+SatSignalParametersPacketAddressesTestCase::SatSignalParametersPacketAddressesTestCase ()
+  : TestCase ("Test that the packet addresses equal the MAC tags with and without the packet metadata")
+{
+}
+
+SatSignalParametersPacketAddressesTestCase::~SatSignalParametersPacketAddressesTestCase ()
+{
+}
+
+void
+SatSignalParametersPacketAddressesTestCase::CheckPacketAddresses (Ptr<SatSignalParameters> params, std::string step)
+{
+  for (uint32_t i = 0; i < params->m_packetsInBurst.size (); ++i)
+    {
+      SatMacTag macTag;
+      bool hasMacTag = params->m_packetsInBurst[i]->PeekPacketTag (macTag);
+
+      Mac48Address source;
+      Mac48Address dest;
+      bool found = params->GetPacketAddresses (i, source, dest);
+
+      NS_TEST_EXPECT_MSG_EQ (found, hasMacTag, "Wrong MAC tag presence of packet " << i << " " << step);
+
+      if (hasMacTag)
+        {
+          NS_TEST_EXPECT_MSG_EQ (source, macTag.GetSourceAddress (), "Wrong source address of packet " << i << " " << step);
+          NS_TEST_EXPECT_MSG_EQ (dest, macTag.GetDestAddress (), "Wrong destination address of packet " << i << " " << step);
+        }
+    }
+}
+
+void
+SatSignalParametersPacketAddressesTestCase::DoRun (void)
+{
+  Ptr<SatSignalParameters> params = Create<SatSignalParameters> ();
+
+  for (uint32_t i = 0; i < 3; ++i)
+    {
+      SatMacTag macTag;
+      macTag.SetSourceAddress (Mac48Address::Allocate ());
+      macTag.SetDestAddress (Mac48Address::Allocate ());
+
+      Ptr<Packet> packet = Create<Packet> (100 + i);
+      packet->AddPacketTag (macTag);
+      params->m_packetsInBurst.push_back (packet);
+    }
+
+  params->m_packetsInBurst.push_back (Create<Packet> (50));
+
+  NS_TEST_ASSERT_MSG_EQ ((params->m_packetMetadata == 0), true, "Packet metadata filled at creation");
+  CheckPacketAddresses (params, "without metadata");
+
+  params->FillPacketMetadata ();
+
+  NS_TEST_ASSERT_MSG_EQ ((params->m_packetMetadata != 0), true, "Packet metadata not filled");
+  NS_TEST_EXPECT_MSG_EQ (params->m_packetMetadata->m_packets.size (), params->m_packetsInBurst.size (), "Wrong packet metadata size");
+  CheckPacketAddresses (params, "with metadata");
+
+  Ptr<SatSignalParameters> copy = params->Copy ();
+
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (copy->m_packetMetadata), PeekPointer (params->m_packetMetadata), "Packet metadata not shared by the copy");
+  CheckPacketAddresses (copy, "with metadata of the copy");
+
+  SatMacTag macTag;
+  macTag.SetSourceAddress (Mac48Address::Allocate ());
+  macTag.SetDestAddress (Mac48Address::Allocate ());
+
+  Ptr<Packet> packet = Create<Packet> (200);
+  packet->AddPacketTag (macTag);
+  copy->m_packetsInBurst.push_back (packet);
+
+  CheckPacketAddresses (copy, "after changing the burst");
+  CheckPacketAddresses (params, "after changing the burst of the copy");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the signal parameters
+ */
+class SatSignalParametersTestSuite : public TestSuite
+{
+public:
+  SatSignalParametersTestSuite ();
+};
+
+SatSignalParametersTestSuite::SatSignalParametersTestSuite ()
+  : TestSuite ("sat-signal-parameters-test", UNIT)
+{
+  AddTestCase (new SatSignalParametersPacketAddressesTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatSignalParametersTestSuite satSignalParametersTestSuite;
@@ -0,0 +1,244 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2018 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup satellite
+ * \file satellite-ut-tx-plan-test.cc
+ * \brief UT superframe transmission plan test suite
+ */
+
+#include <utility>
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/ptr.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "../model/satellite-ut-tx-plan.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the superframe transmission plan transmits
+ * the time slots at the same times and in the same order as scheduling one
+ * simulator event per time slot.
+ *
+ *  The time slots are identified by their carrier ids. Two TBTPs are
+ *  received at different times:
+ *    1.  TBTP 1 at 0 ms with slots at 30 ms (carrier 0), 10 ms (carrier 1),
+ *        10 ms (carrier 2) and 40 ms (carrier 3).
+ *    2.  TBTP 2 at 5 ms with slots at 10 ms (carrier 4), 20 ms (carrier 5),
+ *        30 ms (carrier 6) and 2 ms after its reception (carrier 7).
+ *
+ *  Expected result:
+ *    The slots are transmitted in the order and at the times of the per slot
+ *    events, i.e. sorted by the time and the slots starting at the same time
+ *    in the TBTP order. The slot of TBTP 2 at 7 ms, earlier than any slot of
+ *    TBTP 1, reschedules the plan event.
+ */
+class SatUtTxPlanOrderTestCase : public TestCase
+{
+public:
+  SatUtTxPlanOrderTestCase ();
+  virtual ~SatUtTxPlanOrderTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Add the time slots of a TBTP to the plan and schedule one event
+   * per time slot as a reference
+   * \param slots start times and carrier ids of the time slots
+   */
+  void ReceiveTbtp (std::vector<std::pair<Time, uint32_t> > slots);
+
+  /**
+   * \brief Store a time slot transmitted by the plan
+   */
+  void PlanTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf,
+                     SatUtScheduler::SatCompliancePolicy_t policy);
+
+  /**
+   * \brief Store a time slot transmitted by its own event
+   */
+  void SlotTransmit (uint32_t carrierId);
+
+  Ptr<SatUtTxPlan> m_plan;
+  std::vector<std::pair<Time, uint32_t> > m_planTransmissions;
+  std::vector<std::pair<Time, uint32_t> > m_slotTransmissions;
+};
+
+SatUtTxPlanOrderTestCase::SatUtTxPlanOrderTestCase ()
+  : TestCase ("Test the time slot order of the superframe transmission plan"),
+  m_plan (),
+  m_planTransmissions (),
+  m_slotTransmissions ()
+{
+}
+
+SatUtTxPlanOrderTestCase::~SatUtTxPlanOrderTestCase ()
+{
+}
+
+void
+SatUtTxPlanOrderTestCase::PlanTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf,
+                                        SatUtScheduler::SatCompliancePolicy_t policy)
+{
+  m_planTransmissions.push_back (std::make_pair (Simulator::Now (), carrierId));
+}
+
+void
+SatUtTxPlanOrderTestCase::SlotTransmit (uint32_t carrierId)
+{
+  m_slotTransmissions.push_back (std::make_pair (Simulator::Now (), carrierId));
+}
+
+void
+SatUtTxPlanOrderTestCase::ReceiveTbtp (std::vector<std::pair<Time, uint32_t> > slots)
+{
+  for (std::vector<std::pair<Time, uint32_t> >::const_iterator it = slots.begin (); it != slots.end (); ++it)
+    {
+      m_plan->Add (it->first, MilliSeconds (1), NULL, NULL, it->second);
+      Simulator::Schedule (it->first - Simulator::Now (), &SatUtTxPlanOrderTestCase::SlotTransmit, this, it->second);
+    }
+
+  m_plan->Schedule ();
+}
+
+void
+SatUtTxPlanOrderTestCase::DoRun (void)
+{
+  m_plan = Create<SatUtTxPlan> (MakeCallback (&SatUtTxPlanOrderTestCase::PlanTransmit, this));
+
+  std::vector<std::pair<Time, uint32_t> > tbtp1;
+  tbtp1.push_back (std::make_pair (MilliSeconds (30), 0));
+  tbtp1.push_back (std::make_pair (MilliSeconds (10), 1));
+  tbtp1.push_back (std::make_pair (MilliSeconds (10), 2));
+  tbtp1.push_back (std::make_pair (MilliSeconds (40), 3));
+
+  std::vector<std::pair<Time, uint32_t> > tbtp2;
+  tbtp2.push_back (std::make_pair (MilliSeconds (10), 4));
+  tbtp2.push_back (std::make_pair (MilliSeconds (20), 5));
+  tbtp2.push_back (std::make_pair (MilliSeconds (30), 6));
+  tbtp2.push_back (std::make_pair (MilliSeconds (7), 7));
+
+  Simulator::Schedule (MilliSeconds (0), &SatUtTxPlanOrderTestCase::ReceiveTbtp, this, tbtp1);
+  Simulator::Schedule (MilliSeconds (5), &SatUtTxPlanOrderTestCase::ReceiveTbtp, this, tbtp2);
+
+  Simulator::Run ();
+
+  // 7 ms: 7, 10 ms: 1, 2, 4, 20 ms: 5, 30 ms: 0, 6, 40 ms: 3
+  uint32_t expectedCarriers[] = { 7, 1, 2, 4, 5, 0, 6, 3 };
+  uint32_t expectedTimes[] = { 7, 10, 10, 10, 20, 30, 30, 40 };
+
+  NS_TEST_ASSERT_MSG_EQ (m_slotTransmissions.size (), 8, "Wrong number of slots transmitted by per slot events");
+  NS_TEST_ASSERT_MSG_EQ (m_planTransmissions.size (), m_slotTransmissions.size (), "Wrong number of slots transmitted by plan");
+
+  for (uint32_t i = 0; i < m_slotTransmissions.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (m_slotTransmissions[i].first, MilliSeconds (expectedTimes[i]), "Wrong time of per slot event " << i);
+      NS_TEST_ASSERT_MSG_EQ (m_slotTransmissions[i].second, expectedCarriers[i], "Wrong order of per slot event " << i);
+      NS_TEST_ASSERT_MSG_EQ (m_planTransmissions[i].first, m_slotTransmissions[i].first, "Wrong time of planned slot " << i);
+      NS_TEST_ASSERT_MSG_EQ (m_planTransmissions[i].second, m_slotTransmissions[i].second, "Wrong order of planned slot " << i);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (m_plan->GetSize (), 0, "Transmitted slots left in plan");
+
+  m_plan = NULL;
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that clearing the superframe transmission plan
+ * cancels its event.
+ */
+class SatUtTxPlanClearTestCase : public TestCase
+{
+public:
+  SatUtTxPlanClearTestCase ();
+  virtual ~SatUtTxPlanClearTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Count a time slot transmitted by the plan
+   */
+  void PlanTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf,
+                     SatUtScheduler::SatCompliancePolicy_t policy);
+
+  uint32_t m_transmissions;
+};
+
+SatUtTxPlanClearTestCase::SatUtTxPlanClearTestCase ()
+  : TestCase ("Test that clearing the superframe transmission plan cancels its event"),
+  m_transmissions (0)
+{
+}
+
+SatUtTxPlanClearTestCase::~SatUtTxPlanClearTestCase ()
+{
+}
+
+void
+SatUtTxPlanClearTestCase::PlanTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf,
+                                        SatUtScheduler::SatCompliancePolicy_t policy)
+{
+  m_transmissions++;
+}
+
+void
+SatUtTxPlanClearTestCase::DoRun (void)
+{
+  Ptr<SatUtTxPlan> plan = Create<SatUtTxPlan> (MakeCallback (&SatUtTxPlanClearTestCase::PlanTransmit, this));
+
+  plan->Add (MilliSeconds (10), MilliSeconds (1), NULL, NULL, 0);
+  plan->Add (MilliSeconds (20), MilliSeconds (1), NULL, NULL, 0);
+  plan->Schedule ();
+
+  Simulator::Schedule (MilliSeconds (15), &SatUtTxPlan::Clear, plan);
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_transmissions, 1, "Slot transmitted after clearing the plan");
+  NS_TEST_ASSERT_MSG_EQ (plan->GetSize (), 0, "Slots left in cleared plan");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the UT superframe transmission plan
+ */
+class SatUtTxPlanTestSuite : public TestSuite
+{
+public:
+  SatUtTxPlanTestSuite ();
+};
+
+SatUtTxPlanTestSuite::SatUtTxPlanTestSuite ()
+  : TestSuite ("sat-ut-tx-plan-test", UNIT)
+{
+  AddTestCase (new SatUtTxPlanOrderTestCase, TestCase::QUICK);
+  AddTestCase (new SatUtTxPlanClearTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatUtTxPlanTestSuite satUtTxPlanTestSuite;
@@ -203,6 +203,96 @@ SatDvbS2BbFrameConfTestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the ACM MODCOD selection of BBFrame conf.
+ *
+ * Expected result:
+ * - Creates SatBbFrameConf with ACM enabled
+ * - Selects the MODCODs for a range of C/Nos with both the single and the batch method
+ * - The selected MODCODs shall match a linear search over the C/No requirements
+ *   computed from the link results
+ */
+class SatDvbS2AcmModcodTestCase : public TestCase
+{
+public:
+  SatDvbS2AcmModcodTestCase ();
+  virtual ~SatDvbS2AcmModcodTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+};
+
+SatDvbS2AcmModcodTestCase::SatDvbS2AcmModcodTestCase ()
+  : TestCase ("Test DVB-S2 ACM MODCOD selection.")
+{
+}
+
+SatDvbS2AcmModcodTestCase::~SatDvbS2AcmModcodTestCase ()
+{
+}
+
+
+void
+SatDvbS2AcmModcodTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-waveform-conf", "dvbs2acm", true);
+
+  // Enable ACM
+  Config::SetDefault ("ns3::SatBbFrameConf::AcmEnabled", BooleanValue (true));
+
+  double symbolRate (93750000);
+  double targetBler (0.00001);
+  SatEnums::SatBbFrameType_t frameType = SatEnums::NORMAL_FRAME;
+
+  Ptr<SatLinkResultsDvbS2> lr = CreateObject<SatLinkResultsDvbS2> ();
+  lr->Initialize ();
+
+  Ptr<SatBbFrameConf> bbFrameConf = CreateObject<SatBbFrameConf> (symbolRate, SatEnums::DVB_S2);
+  bbFrameConf->InitializeCNoRequirements (lr);
+
+  std::vector<SatEnums::SatModcod_t> modcods = bbFrameConf->GetModCodsUsed ();
+
+  std::vector<double> cnos;
+  for (double d = 75.0; d <= 95.0; d += 0.25)
+    {
+      cnos.push_back (SatUtils::DbToLinear (d));
+    }
+  cnos.push_back (std::numeric_limits<double>::quiet_NaN ());
+
+  std::vector<SatEnums::SatModcod_t> batch;
+  bbFrameConf->GetBestModcods (cnos, frameType, batch);
+
+  NS_TEST_ASSERT_MSG_EQ (batch.size (), cnos.size (), "Wrong number of MODCODs");
+
+  for (uint32_t i = 0; i < cnos.size (); ++i)
+    {
+      // Reference: the highest MODCOD whose requirement is met
+      SatEnums::SatModcod_t ref = bbFrameConf->GetDefaultModCod ();
+      for (std::vector<SatEnums::SatModcod_t>::reverse_iterator rit = modcods.rbegin ();
+           rit != modcods.rend ();
+           ++rit)
+        {
+          double cnoReq = SatUtils::DbToLinear (lr->GetEsNoDb (*rit, frameType, targetBler)) * symbolRate;
+          if (cnoReq <= cnos[i])
+            {
+              ref = *rit;
+              break;
+            }
+        }
+
+      NS_TEST_ASSERT_MSG_EQ (bbFrameConf->GetBestModcod (cnos[i], frameType), ref, "Not expected MODCOD");
+      NS_TEST_ASSERT_MSG_EQ (batch[i], ref, "Not expected MODCOD in batch");
+    }
+
+  Config::SetDefault ("ns3::SatBbFrameConf::AcmEnabled", BooleanValue (false));
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
 
 /**
  * \ingroup satellite
@@ -219,6 +309,7 @@ SatWaveformConfTestSuite::SatWaveformConfTestSuite ()
 {
   AddTestCase (new SatDvbRcs2WaveformTableTestCase, TestCase::QUICK);
   AddTestCase (new SatDvbS2BbFrameConfTestCase, TestCase::QUICK);
+  AddTestCase (new SatDvbS2AcmModcodTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
@@ -18,21 +18,43 @@
  * Author: Frans Laakso <frans.laakso@magister.fi>
  */
 
+#include <sstream>
 #include "satellite-output-fstream-double-container.h"
+#include "satellite-output-stream-writer.h"
 #include "ns3/log.h"
 #include "ns3/abort.h"
 #include "ns3/simulator.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
 
 NS_LOG_COMPONENT_DEFINE ("SatOutputFileStreamDoubleContainer");
 
 namespace ns3 {
 
+NS_OBJECT_ENSURE_REGISTERED (SatOutputFileStreamDoubleContainer);
+
 TypeId
 SatOutputFileStreamDoubleContainer::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::SatOutputFileStreamDoubleContainer")
     .SetParent<Object> ()
-    .AddConstructor<SatOutputFileStreamDoubleContainer> ();
+    .AddConstructor<SatOutputFileStreamDoubleContainer> ()
+    .AddAttribute ("EnableStreaming",
+                   "Write the values to the file during the simulation instead of storing them until the end.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatOutputFileStreamDoubleContainer::m_enableStreaming),
+                   MakeBooleanChecker ())
+    .AddAttribute ("StreamBufferSize",
+                   "Number of rows buffered in streaming mode before they are written to the file.",
+                   UintegerValue (4096),
+                   MakeUintegerAccessor (&SatOutputFileStreamDoubleContainer::m_streamBufferSize),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("BinaryOutput",
+                   "Write the values as raw doubles instead of text rows.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatOutputFileStreamDoubleContainer::m_binaryOutput),
+                   MakeBooleanChecker ())
+  ;
   return tid;
 }
 
@@ -45,7 +67,12 @@ SatOutputFileStreamDoubleContainer::SatOutputFileStreamDoubleContainer (std::str
   m_valuesInRow (valuesInRow),
   m_printFigure (false),
   m_figureUnitConversionType (RAW),
-  m_style (Gnuplot2dDataset::LINES)
+  m_style (Gnuplot2dDataset::LINES),
+  m_enableStreaming (false),
+  m_streamBufferSize (4096),
+  m_binaryOutput (false),
+  m_streamBuffer (),
+  m_writer ()
 {
   NS_LOG_FUNCTION (this << m_fileName << m_fileMode);
 
@@ -64,7 +91,12 @@ SatOutputFileStreamDoubleContainer::SatOutputFileStreamDoubleContainer ()
   m_valuesInRow (),
   m_printFigure (),
   m_figureUnitConversionType (),
-  m_style ()
+  m_style (),
+  m_enableStreaming (),
+  m_streamBufferSize (),
+  m_binaryOutput (),
+  m_streamBuffer (),
+  m_writer ()
 {
   NS_LOG_FUNCTION (this);
   NS_FATAL_ERROR ("SatOutputFileStreamDoubleContainer::SatOutputFileStreamDoubleContainer - Constructor not in use");
@@ -91,24 +123,52 @@ SatOutputFileStreamDoubleContainer::WriteContainerToFile ()
 {
   NS_LOG_FUNCTION (this);
 
+  if (m_enableStreaming)
+    {
+      if (!m_writer)
+        {
+          OpenStream ();
+        }
+
+      CloseStream ();
+
+      if (m_printFigure)
+        {
+          PrintStreamedFigure ();
+        }
+
+      Reset ();
+      return;
+    }
+
   OpenStream ();
 
   if (m_outputFileStream->is_open ())
     {
-      for (uint32_t i = 0; i < m_container.size (); i++)
+      if (m_binaryOutput)
         {
-          for (uint32_t j = 0; j < m_valuesInRow; j++ )
+          for (uint32_t i = 0; i < m_container.size (); i++)
             {
-              if (j + 1 == m_valuesInRow)
-                {
-                  *m_outputFileStream << m_container[i].at (j);
-                }
-              else
+              m_outputFileStream->write (reinterpret_cast<const char*> (m_container[i].data ()), m_valuesInRow * sizeof (double));
+            }
+        }
+      else
+        {
+          for (uint32_t i = 0; i < m_container.size (); i++)
+            {
+              for (uint32_t j = 0; j < m_valuesInRow; j++ )
                 {
-                  *m_outputFileStream << m_container[i].at (j) << "\t";
+                  if (j + 1 == m_valuesInRow)
+                    {
+                      *m_outputFileStream << m_container[i].at (j);
+                    }
+                  else
+                    {
+                      *m_outputFileStream << m_container[i].at (j) << "\t";
+                    }
                 }
+              *m_outputFileStream << std::endl;
             }
-          *m_outputFileStream << std::endl;
         }
       m_outputFileStream->close ();
     }
@@ -125,6 +185,38 @@ SatOutputFileStreamDoubleContainer::WriteContainerToFile ()
   Reset ();
 }
 
+void
+SatOutputFileStreamDoubleContainer::WriteBinaryHeader (std::ofstream& stream)
+{
+  NS_LOG_FUNCTION (this);
+
+  uint32_t version = BINARY_FORMAT_VERSION;
+  stream.write ("SNS3TRC", 8);
+  stream.write (reinterpret_cast<const char*> (&version), sizeof (uint32_t));
+  stream.write (reinterpret_cast<const char*> (&m_valuesInRow), sizeof (uint32_t));
+}
+
+void
+SatOutputFileStreamDoubleContainer::FlushStreamBuffer ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (!m_streamBuffer.empty ())
+    {
+      m_writer->Write (m_fileName, m_streamBuffer, m_valuesInRow, m_binaryOutput);
+      m_streamBuffer.reserve (m_streamBufferSize * m_valuesInRow);
+    }
+}
+
+void
+SatOutputFileStreamDoubleContainer::CloseStream ()
+{
+  NS_LOG_FUNCTION (this);
+
+  FlushStreamBuffer ();
+  m_writer->Flush ();
+}
+
 void
 SatOutputFileStreamDoubleContainer::PrintFigure ()
 {
@@ -159,7 +251,24 @@ SatOutputFileStreamDoubleContainer::AddToContainer (std::vector<double> newItem)
       NS_FATAL_ERROR ("SatOutputFileStreamDoubleContainer::AddToContainer - Invalid vector size");
     }
 
-  m_container.push_back (newItem);
+  if (!m_enableStreaming)
+    {
+      m_container.push_back (newItem);
+      return;
+    }
+
+  if (!m_writer)
+    {
+      OpenStream ();
+      m_streamBuffer.reserve (m_streamBufferSize * m_valuesInRow);
+    }
+
+  m_streamBuffer.insert (m_streamBuffer.end (), newItem.begin (), newItem.end ());
+
+  if (m_streamBuffer.size () >= m_streamBufferSize * m_valuesInRow)
+    {
+      FlushStreamBuffer ();
+    }
 }
 
 void
@@ -167,8 +276,35 @@ SatOutputFileStreamDoubleContainer::OpenStream ()
 {
   NS_LOG_FUNCTION (this);
 
-  m_outputFileStreamWrapper = new SatOutputFileStreamWrapper (m_fileName, m_fileMode);
+  std::ios::openmode fileMode = m_binaryOutput ? (m_fileMode | std::ios::binary) : m_fileMode;
+
+  if (m_enableStreaming)
+    {
+      // The file is created here and the writer appends the buffered
+      // values to it, so the file is not kept open between the flushes
+      std::ofstream stream (m_fileName.c_str (), fileMode);
+
+      if (!stream.is_open ())
+        {
+          NS_FATAL_ERROR ("SatOutputFileStreamDoubleContainer::OpenStream - Unable to open " << m_fileName);
+        }
+
+      if (m_binaryOutput)
+        {
+          WriteBinaryHeader (stream);
+        }
+
+      m_writer = SatOutputStreamWriter::Get ();
+      return;
+    }
+
+  m_outputFileStreamWrapper = new SatOutputFileStreamWrapper (m_fileName, fileMode);
   m_outputFileStream = m_outputFileStreamWrapper->GetStream ();
+
+  if (m_binaryOutput)
+    {
+      WriteBinaryHeader (*m_outputFileStream);
+    }
 }
 
 void
@@ -190,7 +326,18 @@ SatOutputFileStreamDoubleContainer::ResetStream ()
       delete m_outputFileStreamWrapper;
       m_outputFileStreamWrapper = 0;
     }
+
+  if (m_writer)
+    {
+      // The background writer may still write the queued values to the
+      // file, which may be reopened by the next stream
+      m_writer->Flush ();
+
+      // The writer is stopped when the last container releases it
+      m_writer.reset ();
+    }
   m_outputFileStream = 0;
+  m_streamBuffer.clear ();
 
   m_fileName = "";
   m_fileMode = std::ofstream::out;
@@ -216,6 +363,80 @@ SatOutputFileStreamDoubleContainer::ClearContainer ()
   m_valuesInRow = 0;
 }
 
+void
+SatOutputFileStreamDoubleContainer::PrintStreamedFigure ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_valuesInRow != 2)
+    {
+      NS_ABORT_MSG ("SatOutputFileStreamDoubleContainer::PrintStreamedFigure - Figure output not implemented for " << m_valuesInRow << " columns.");
+    }
+
+  std::string styles[] = { "lines", "points", "linespoints", "dots", "impulses", "steps", "fsteps", "histeps" };
+
+  std::string plotFileName = m_fileName + ".plt";
+  std::ofstream plotFile (plotFileName.c_str ());
+
+  plotFile << "set terminal png" << std::endl;
+  plotFile << "set output \"" << m_fileName << ".png\"" << std::endl;
+  plotFile << "set title \"" << m_title << "\"" << std::endl;
+  plotFile << "set xlabel \"" << m_legendY << "\"" << std::endl;
+  plotFile << "set ylabel \"" << m_legendX << "\"" << std::endl;
+  plotFile << m_keyPosition << std::endl;
+  plotFile << "set grid xtics mxtics ytics" << std::endl;
+  plotFile << "plot \"" << m_fileName << "\"";
+
+  if (m_binaryOutput)
+    {
+      plotFile << " binary skip=" << BINARY_HEADER_SIZE << " format=\"%2double\"";
+    }
+
+  plotFile << " using 1:" << GetGnuplotConversion () << " title \"" << m_title << "\" with " << styles[m_style] << std::endl;
+  plotFile.close ();
+
+  std::string conversionCommand = "gnuplot " + m_fileName + ".plt";
+
+  int result = system (conversionCommand.c_str ());
+
+  if (result < 0)
+    {
+      std::cout << "Unable to open shell process for Gnuplot file conversion for " << m_fileName << ", conversion not done!" << std::endl;
+    }
+}
+
+std::string
+SatOutputFileStreamDoubleContainer::GetGnuplotConversion ()
+{
+  NS_LOG_FUNCTION (this);
+
+  std::ostringstream minimum;
+  minimum.precision (17);
+  minimum << std::numeric_limits<double>::min ();
+
+  switch (m_figureUnitConversionType)
+    {
+    case RAW:
+      {
+        return "2";
+      }
+    case DECIBEL:
+      {
+        return "($2 > 0 ? 10.0 * log10 ($2) : 10.0 * log10 (" + minimum.str () + "))";
+      }
+    case DECIBEL_AMPLITUDE:
+      {
+        return "($2 > 0 ? 20.0 * log10 ($2) : 20.0 * log10 (" + minimum.str () + "))";
+      }
+    default:
+      {
+        NS_ABORT_MSG ("SatOutputFileStreamDoubleContainer::GetGnuplotConversion - Invalid conversion type.");
+        break;
+      }
+    }
+  return "2";
+}
+
 Gnuplot2dDataset
 SatOutputFileStreamDoubleContainer::GetGnuplotDataset ()
 {
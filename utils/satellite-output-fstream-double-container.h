@@ -22,18 +22,32 @@
 #define SAT_OUTPUT_FSTREAM_DOUBLE_CONTAINER_H
 
 #include <fstream>
+#include <memory>
 #include "ns3/object.h"
 #include "satellite-output-fstream-wrapper.h"
 #include <ns3/gnuplot.h>
 
 namespace ns3 {
 
+class SatOutputStreamWriter;
+
 /**
  * \ingroup satellite
  *
  * \brief Class for output file stream container for double values.
  * The class implements storing the values and writing the stored
  * values into a file. A figure output in two dimensions is also supported.
+ *
+ * In streaming mode (attribute EnableStreaming) the values are collected into
+ * a fixed-size buffer, which is handed to SatOutputStreamWriter whenever it is
+ * full. The memory used by the container is then bounded regardless of the
+ * simulation length. The file is created at the first value and the writer
+ * appends each buffer to it, so a streaming container does not keep the
+ * file open. The values may also be written in a compact binary
+ * format (attribute BinaryOutput): a 16-byte header (magic "SNS3TRC\0",
+ * version and number of values in a row as uint32) followed by the rows as
+ * raw doubles. ext-utils/convert_binary_trace.py converts such files back
+ * to the text format.
  */
 class SatOutputFileStreamDoubleContainer : public Object
 {
@@ -100,6 +114,16 @@ public:
                            FigureUnitConversion_t figureUnitConversionType,
                            Gnuplot2dDataset::Style style);
 
+  /**
+   * \brief Version of the binary output format
+   */
+  static const uint32_t BINARY_FORMAT_VERSION = 1;
+
+  /**
+   * \brief Size of the binary output header in bytes
+   */
+  static const uint32_t BINARY_HEADER_SIZE = 16;
+
 private:
   /**
    * \brief Function for resetting the variables
@@ -117,15 +141,46 @@ private:
   void ClearContainer ();
 
   /**
-   * \brief Function for opening the output file stream
+   * \brief Function for opening the output file stream. In streaming mode
+   * the file is only created and the background writer is got.
    */
   void OpenStream ();
 
+  /**
+   * \brief Function for writing the binary header into an output file stream
+   * \param stream output file stream
+   */
+  void WriteBinaryHeader (std::ofstream& stream);
+
+  /**
+   * \brief Function for handing the stream buffer to the background writer
+   */
+  void FlushStreamBuffer ();
+
+  /**
+   * \brief Function for writing the rest of the streamed values and waiting
+   * until the background writer has written them
+   */
+  void CloseStream ();
+
   /**
    * \brief Function for printing the container contents into a figure
    */
   void PrintFigure ();
 
+  /**
+   * \brief Function for printing a figure plotted directly from the streamed
+   * output file
+   */
+  void PrintStreamedFigure ();
+
+  /**
+   * \brief Function for creating the Gnuplot expression converting the data
+   * samples in the same way as ConvertValue
+   * \return expression
+   */
+  std::string GetGnuplotConversion ();
+
   /**
    * \brief Function for converting the container data samples
    * \param value original data sample value
@@ -209,6 +264,32 @@ private:
    * \brief 2D dataset figure style
    */
   Gnuplot2dDataset::Style m_style;
+
+  /**
+   * \brief Enable / disable streaming the values to the file during the simulation
+   */
+  bool m_enableStreaming;
+
+  /**
+   * \brief Number of rows buffered before handing them to the background writer
+   */
+  uint32_t m_streamBufferSize;
+
+  /**
+   * \brief Enable / disable the binary output format
+   */
+  bool m_binaryOutput;
+
+  /**
+   * \brief Buffer for the streamed row-major values
+   */
+  std::vector<double> m_streamBuffer;
+
+  /**
+   * \brief Background writer of the streamed values, held from the first
+   * streamed value until the container is written or reset
+   */
+  std::shared_ptr<SatOutputStreamWriter> m_writer;
 };
 
 } // namespace ns3
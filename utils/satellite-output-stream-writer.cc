@@ -0,0 +1,185 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <fstream>
+#include "satellite-output-stream-writer.h"
+#include "ns3/log.h"
+#include "ns3/fatal-error.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatOutputStreamWriter");
+
+namespace ns3 {
+
+SatOutputStreamWriter::SatOutputStreamWriter ()
+  : m_pendingBlocks (0),
+  m_stop (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SatOutputStreamWriter::~SatOutputStreamWriter ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_thread.joinable ())
+    {
+      {
+        std::lock_guard<std::mutex> lock (m_mutex);
+        m_stop = true;
+      }
+      m_condition.notify_all ();
+      m_thread.join ();
+    }
+}
+
+std::shared_ptr<SatOutputStreamWriter>
+SatOutputStreamWriter::Get ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  // Only a weak reference is kept here, the users of the writer own it
+  static std::weak_ptr<SatOutputStreamWriter> sharedWriter;
+
+  std::shared_ptr<SatOutputStreamWriter> writer = sharedWriter.lock ();
+
+  if (!writer)
+    {
+      writer = std::make_shared<SatOutputStreamWriter> ();
+      sharedWriter = writer;
+    }
+
+  return writer;
+}
+
+void
+SatOutputStreamWriter::Write (std::string fileName, std::vector<double>& values, uint32_t valuesInRow, bool binary)
+{
+  NS_LOG_FUNCTION (this << fileName << values.size () << valuesInRow << binary);
+
+  std::unique_lock<std::mutex> lock (m_mutex);
+
+  if (!m_thread.joinable ())
+    {
+      m_thread = std::thread (&SatOutputStreamWriter::Run, this);
+    }
+
+  // Bound the memory by waiting for the writer to catch up
+  while (m_queue.size () >= MAX_QUEUED_BLOCKS)
+    {
+      m_condition.wait (lock);
+    }
+
+  m_queue.push_back (Block_t ());
+  Block_t& block = m_queue.back ();
+  block.fileName = fileName;
+  block.values.swap (values);
+  block.valuesInRow = valuesInRow;
+  block.binary = binary;
+  ++m_pendingBlocks;
+
+  m_condition.notify_all ();
+}
+
+void
+SatOutputStreamWriter::Flush ()
+{
+  NS_LOG_FUNCTION (this);
+
+  std::unique_lock<std::mutex> lock (m_mutex);
+
+  while (m_pendingBlocks > 0)
+    {
+      m_condition.wait (lock);
+    }
+}
+
+void
+SatOutputStreamWriter::Run ()
+{
+  std::unique_lock<std::mutex> lock (m_mutex);
+
+  while (true)
+    {
+      while (m_queue.empty () && !m_stop)
+        {
+          m_condition.wait (lock);
+        }
+
+      if (m_queue.empty ())
+        {
+          return;
+        }
+
+      Block_t block;
+      block.fileName.swap (m_queue.front ().fileName);
+      block.values.swap (m_queue.front ().values);
+      block.valuesInRow = m_queue.front ().valuesInRow;
+      block.binary = m_queue.front ().binary;
+      m_queue.pop_front ();
+      m_condition.notify_all ();
+
+      lock.unlock ();
+      WriteBlock (block);
+      lock.lock ();
+
+      --m_pendingBlocks;
+      m_condition.notify_all ();
+    }
+}
+
+void
+SatOutputStreamWriter::WriteBlock (Block_t& block)
+{
+  std::ios::openmode fileMode = std::ios::out | std::ios::app;
+
+  if (block.binary)
+    {
+      fileMode |= std::ios::binary;
+    }
+
+  std::ofstream stream (block.fileName.c_str (), fileMode);
+
+  if (!stream.is_open ())
+    {
+      NS_FATAL_ERROR ("SatOutputStreamWriter::WriteBlock - Unable to open " << block.fileName << " for appending");
+    }
+
+  if (block.binary)
+    {
+      stream.write (reinterpret_cast<const char*> (block.values.data ()), block.values.size () * sizeof (double));
+      return;
+    }
+
+  // Same layout as SatOutputFileStreamDoubleContainer::WriteContainerToFile
+  for (uint32_t i = 0; i < block.values.size (); i++)
+    {
+      stream << block.values[i];
+
+      if ((i + 1) % block.valuesInRow == 0)
+        {
+          stream << "\n";
+        }
+      else
+        {
+          stream << "\t";
+        }
+    }
+}
+
+} // namespace ns3
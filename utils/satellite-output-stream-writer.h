@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SAT_OUTPUT_STREAM_WRITER_H
+#define SAT_OUTPUT_STREAM_WRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Background writer for streamed output traces.
+ *
+ * The writer owns a single thread which appends blocks of value rows to
+ * output files in the order the blocks were queued. The file of a block is
+ * opened only while the block is written, so the number of open file
+ * descriptors does not grow with the number of streamed traces. The number of
+ * queued blocks is bounded: Write blocks the caller when the queue is full,
+ * so the memory used by the streamed traces stays bounded even if the disk
+ * cannot keep up with the simulation.
+ *
+ * The class is not an ns3::Object. The shared writer is got with Get and
+ * each streaming container keeps a reference to it while its stream is
+ * open, so that the writer outlives the containers also when they are
+ * destroyed as static objects. The thread is started at the first write and
+ * stopped when the last reference is released.
+ */
+class SatOutputStreamWriter
+{
+public:
+  /**
+   * \brief Constructor
+   */
+  SatOutputStreamWriter ();
+
+  /**
+   * \brief Destructor. Writes the queued blocks and stops the thread.
+   */
+  ~SatOutputStreamWriter ();
+
+  /**
+   * \brief Get the shared writer. A new writer is created if no reference
+   * to the previous one is held.
+   * \return the writer
+   */
+  static std::shared_ptr<SatOutputStreamWriter> Get ();
+
+  /**
+   * \brief Queue a block of rows to be appended to a file. The values
+   * are swapped out of the given vector, which is left empty.
+   * \param fileName Name of the output file, which must already exist
+   * \param values Row-major values of the rows
+   * \param valuesInRow Number of values in a row
+   * \param binary Write the values as raw doubles instead of text rows
+   */
+  void Write (std::string fileName, std::vector<double>& values, uint32_t valuesInRow, bool binary);
+
+  /**
+   * \brief Wait until all the queued blocks have been written.
+   */
+  void Flush ();
+
+  /**
+   * \brief Maximum number of blocks waiting in the queue
+   */
+  static const uint32_t MAX_QUEUED_BLOCKS = 64;
+
+private:
+  /**
+   * \brief Block of rows queued for writing
+   */
+  typedef struct
+  {
+    std::string fileName;
+    std::vector<double> values;
+    uint32_t valuesInRow;
+    bool binary;
+  } Block_t;
+
+  /**
+   * \brief Main loop of the writer thread
+   */
+  void Run ();
+
+  /**
+   * \brief Append a block to its file
+   * \param block Block to write
+   */
+  static void WriteBlock (Block_t& block);
+
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::deque<Block_t> m_queue;
+
+  /**
+   * \brief Number of blocks queued or being written
+   */
+  uint32_t m_pendingBlocks;
+
+  /**
+   * \brief Flag telling the thread to stop after the queue is empty
+   */
+  bool m_stop;
+};
+
+} // namespace ns3
+
+#endif /* SAT_OUTPUT_STREAM_WRITER_H */